@@ -0,0 +1,521 @@
+// Host-side microbenchmark suite for the firmware's hot paths, built against
+// the native platform (lib/Hal/NativePlatform.h) and the real src/main.cpp.
+//
+// Covers the request path (HTTP parsing, the dashboard, /api/now, /history,
+// /daily and the air-quality label), the uplink (batch encoding and reply
+// parsing) and the buffering behind them (sample queue, history tiers,
+// daily aggregates, flash log, series decoding, on-device forecast).
+// Responses go to a socketpair that is drained after every call, so each
+// operation includes handing its bytes to the kernel.
+//
+// Every benchmark is calibrated to --min-time and repeated five times; the
+// median is reported as ns/op, with heap allocations and bytes allocated per
+// op and the peak heap in use above the starting point (counted by
+// interposing malloc and operator new), and send() calls per op. The
+// server sets TCP_NODELAY, so on a real socket each send() leaves as at
+// least one segment: sends/op is the packet count of a response.
+//
+// --json FILE writes the results, one benchmark per line, for comparison
+// between commits; --baseline FILE compares against such a file and exits
+// with status 1 if any benchmark got slower by more than --threshold
+// percent (default 10), allocates more or calls send() more than before.
+//
+// Build and run from Weather/:
+//   g++ -O2 -std=gnu++17 -pthread -Iinclude $(for d in lib/*/; do echo -I$d; done) bench/firmware_bench.cpp src/main.cpp $(ls lib/*/*.cpp | grep -v NativeMain) -o firmware_bench
+//   ./firmware_bench --json before.json
+//   ./firmware_bench --baseline before.json
+
+#include <malloc.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "DailyAggregates.h"
+#include "Hal.h"
+#include "dashboard_html.h"
+#include "HttpParser.h"
+#include "NextDayModel.h"
+#include "PredictionParser.h"
+#include "SampleHistory.h"
+#include "SampleLog.h"
+#include "SensorSampler.h"
+#include "SimulatedFlash.h"
+#include "SpscRing.h"
+#include "Telemetry.h"
+
+// Firmware entry points and state from src/main.cpp
+bool handleRequest(NetClient &client, const HttpRequest &request);
+const char *interpretAirQuality(float raw);
+size_t encodeRamBatch();
+extern SensorSampler sampler;
+extern SampleHistory history;
+extern SemaphoreHandle_t historyLock;
+extern DailyAggregates daily;
+extern SpscRing<SensorReading, 256> pendingSamples;
+extern uint8_t batchBuffer[];
+
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *p, size_t size);
+extern "C" void __libc_free(void *p);
+
+static size_t sends = 0;
+static size_t allocations = 0;
+static size_t allocatedBytes = 0;
+static size_t heapInUse = 0;
+static size_t heapPeak = 0;
+
+static void *counted(void *p) {
+  if (!p) return p;
+  size_t size = malloc_usable_size(p);
+  allocations++;
+  allocatedBytes += size;
+  heapInUse += size;
+  if (heapInUse > heapPeak) heapPeak = heapInUse;
+  return p;
+}
+
+static void uncount(void *p) {
+  if (p) heapInUse -= malloc_usable_size(p);
+}
+
+extern "C" void *malloc(size_t size) {
+  return counted(__libc_malloc(size));
+}
+
+extern "C" void *calloc(size_t count, size_t size) {
+  return counted(__libc_calloc(count, size));
+}
+
+extern "C" void *realloc(void *p, size_t size) {
+  uncount(p);
+  return counted(__libc_realloc(p, size));
+}
+
+extern "C" void free(void *p) {
+  uncount(p);
+  __libc_free(p);
+}
+
+extern "C" ssize_t send(int fd, const void *data, size_t length, int flags) {
+  sends++;
+  return sendto(fd, data, length, flags, NULL, 0);
+}
+
+void *operator new(size_t size) {
+  void *p = malloc(size);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void *operator new[](size_t size) {
+  void *p = malloc(size);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+static volatile uintptr_t benchSink;
+static const size_t REPLAY_BATCH_SIZE = 120;  // REPLAY_BATCH_SAMPLES in main.cpp
+
+static NetClient client;
+static int peer = -1;
+
+static void drain() {
+  static char discard[65536];
+  while (recv(peer, discard, sizeof(discard), MSG_DONTWAIT) > 0) {
+  }
+}
+
+static HttpRequest request(const char *path, const char *ifNoneMatch = NULL) {
+  char head[512];
+  int length = snprintf(head, sizeof(head),
+                        "GET %s HTTP/1.1\r\nHost: 192.168.1.42\r\nAccept-Encoding: gzip, deflate\r\n%s%s%s\r\n",
+                        path, ifNoneMatch ? "If-None-Match: " : "", ifNoneMatch ? ifNoneMatch : "",
+                        ifNoneMatch ? "\r\n" : "");
+  HttpParser parser;
+  if (parser.feed(head, length) != HttpParser::DONE) {
+    fprintf(stderr, "bad fixture request %s\n", path);
+    exit(1);
+  }
+  return parser.request();
+}
+
+static const char BROWSER_REQUEST[] =
+    "GET /api/now HTTP/1.1\r\n"
+    "Host: 192.168.1.42\r\n"
+    "Connection: keep-alive\r\n"
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) "
+    "Chrome/124.0.0.0 Safari/537.36\r\n"
+    "Accept: */*\r\n"
+    "Referer: http://192.168.1.42/\r\n"
+    "Accept-Encoding: gzip, deflate\r\n"
+    "Accept-Language: en-GB,en-US;q=0.9,en;q=0.8\r\n"
+    "\r\n";
+
+static const char PREDICTION_REPLY[] =
+    "{\"ingested\":30,\"next_day_predictions\":{\"temperature\":29.84,\"humidity\":71.2,\"aqi\":93.5}}";
+
+static SensorReading reading(uint32_t i) {
+  SensorReading sample = {i * 2000, 28.0f + (i % 50) * 0.1f, 65.0f + (i % 80) * 0.1f, (int)(80 + i % 40), true};
+  return sample;
+}
+
+// 72 hours of history and a week of daily aggregates, a full uplink batch
+// waiting and a live reading, as on a board that has run for a while
+static void setUpFirmware() {
+  int fds[2];
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+    perror("socketpair");
+    exit(1);
+  }
+  client = NetClient(fds[0]);
+  peer = fds[1];
+
+  historyLock = xSemaphoreCreateMutex();
+  sampler.begin();
+  sampler.poll(true);
+
+  for (uint32_t t = 0; t < 72 * 3600; t += 2) {
+    SensorReading sample = reading(t / 2);
+    history.add(t, sample.temperature, sample.humidity, sample.mq135Raw);
+  }
+  uint32_t today = 0;
+  time_t now = wallClock();
+  struct tm local;
+  localtime_r(&now, &local);
+  today = DailyAggregates::dayNumber(local.tm_year + 1900, local.tm_mon + 1, local.tm_mday);
+  for (uint32_t day = today - 7; day <= today; day++) {
+    for (uint32_t i = 0; i < 2000; i++) {
+      SensorReading sample = reading(i);
+      daily.add(day, sample.temperature, sample.humidity, sample.mq135Raw);
+    }
+  }
+  for (uint32_t i = 0; i < 30; i++) pendingSamples.push(reading(i));
+}
+
+static void benchParseRequest(long iterations) {
+  HttpParser parser;
+  for (long n = 0; n < iterations; n++) {
+    parser.reset();
+    parser.feed(BROWSER_REQUEST, sizeof(BROWSER_REQUEST) - 1);
+    benchSink = parser.request().acceptsGzip;
+  }
+}
+
+static void serve(const HttpRequest &request, long iterations) {
+  for (long n = 0; n < iterations; n++) {
+    handleRequest(client, request);
+    drain();
+  }
+}
+
+static void benchDashboard(long iterations) {
+  serve(request("/"), iterations);
+}
+
+static void benchDashboardCached(long iterations) {
+  char etag[64];
+  snprintf(etag, sizeof(etag), "%s", DASHBOARD_ETAG);
+  serve(request("/", etag), iterations);
+}
+
+static void benchLiveData(long iterations) {
+  serve(request("/api/now"), iterations);
+}
+
+static void benchHistoryMinutes(long iterations) {
+  serve(request("/history?res=60&from=255600"), iterations);  // the last of 72 hours
+}
+
+static void benchHistoryAll(long iterations) {
+  serve(request("/history?res=300"), iterations);
+}
+
+static void benchHistoryBinary(long iterations) {
+  serve(request("/history?res=300&format=bin"), iterations);
+}
+
+static void benchDaily(long iterations) {
+  serve(request("/daily"), iterations);
+}
+
+static void benchAirQuality(long iterations) {
+  for (long n = 0; n < iterations; n++) benchSink = (uintptr_t)interpretAirQuality((float)(n & 1023));
+}
+
+static void benchEncodeBatch(long iterations) {
+  for (long n = 0; n < iterations; n++) benchSink = encodeRamBatch() + batchBuffer[0];
+}
+
+static void benchParseReply(long iterations) {
+  PredictionParser parser;
+  for (long n = 0; n < iterations; n++) {
+    parser.reset();
+    parser.feed(PREDICTION_REPLY, sizeof(PREDICTION_REPLY) - 1);
+    benchSink = parser.complete();
+  }
+}
+
+static void benchDecodeBatch(long iterations) {
+  static uint8_t message[TELEMETRY_HEADER_SIZE + 30 * TELEMETRY_MAX_RECORD_SIZE];
+  static size_t length = 0;
+  if (length == 0) {
+    length = encodeRamBatch();
+    memcpy(message, batchBuffer, length);
+  }
+  TelemetryRecord record;
+  for (long n = 0; n < iterations; n++) {
+    TelemetryDecoder decoder;
+    decoder.begin(message, length);
+    while (decoder.next(record)) benchSink = record.mq135Raw;
+  }
+}
+
+static void benchQueue(long iterations) {
+  static SpscRing<SensorReading, 256> queue;
+  SensorReading sample = reading(1);
+  for (long n = 0; n < iterations; n++) {
+    queue.push(sample);
+    benchSink = queue.peek(0).mq135Raw;
+    queue.pop(1);
+  }
+}
+
+static void benchHistoryAdd(long iterations) {
+  static SampleHistory scratch;
+  static uint32_t t = 0;
+  for (long n = 0; n < iterations; n++, t += 2) scratch.add(t, 28.5f, 66.1f, 90 + (t & 15));
+}
+
+static void benchDailyAdd(long iterations) {
+  static DailyAggregates scratch;
+  for (long n = 0; n < iterations; n++) scratch.add(20000 + (uint32_t)(n / 43200), 28.5f, 66.1f, 90);
+}
+
+static void benchLogAppend(long iterations) {
+  static SimulatedFlash flash(0x160000);
+  static SampleLog log(flash);
+  static bool ready = log.begin();
+  static uint32_t seq = 0;
+  static LogRecord block[SampleLog::MAX_BLOCK];
+  static size_t filled = 0;
+  LogRecord out[REPLAY_BATCH_SIZE];
+  for (long n = 0; n < iterations && ready; n++, seq++) {
+    LogRecord record = {seq, seq * 2000, 2850, 6610, 90, false, 0};
+    block[filled++] = record;
+    if (filled < SampleLog::MAX_BLOCK) continue;
+    log.append(block, filled);
+    filled = 0;
+    if (log.size() >= REPLAY_BATCH_SIZE) {
+      size_t count = log.peek(out, REPLAY_BATCH_SIZE);
+      log.consume(count, count > 0 ? out[count - 1].seq + 1 : log.acked());
+    }
+  }
+}
+
+static void benchForecast(long iterations) {
+  float features[NEXT_DAY_FEATURES] = {28.7f, 70.1f, 92.0f, 28.9f, 69.4f, 95.0f, 29.1f, 68.8f, 90.0f};
+  int16_t quantized[NEXT_DAY_FEATURES];
+  float outputs[NEXT_DAY_OUTPUTS];
+  for (long n = 0; n < iterations; n++) {
+    features[0] = 28.0f + (n & 15) * 0.1f;
+    quantizeFeatures(NEXT_DAY_QUANTIZED, features, quantized);
+    quantizedPredict(NEXT_DAY_QUANTIZED, quantized, outputs);
+    benchSink = (uintptr_t)outputs[0];
+  }
+}
+
+struct Benchmark {
+  const char *name;
+  void (*run)(long iterations);
+};
+
+static const Benchmark BENCHMARKS[] = {
+    {"http.parse_request", benchParseRequest},
+    {"http.dashboard", benchDashboard},
+    {"http.dashboard_304", benchDashboardCached},
+    {"http.api_now", benchLiveData},
+    {"http.history_1h_1min", benchHistoryMinutes},
+    {"http.history_72h_5min", benchHistoryAll},
+    {"http.history_72h_5min_bin", benchHistoryBinary},
+    {"http.daily", benchDaily},
+    {"aqi.interpret", benchAirQuality},
+    {"uplink.encode_batch30", benchEncodeBatch},
+    {"uplink.parse_reply", benchParseReply},
+    {"uplink.decode_batch30", benchDecodeBatch},
+    {"buffer.queue_push_pop", benchQueue},
+    {"buffer.history_add", benchHistoryAdd},
+    {"buffer.daily_add", benchDailyAdd},
+    {"buffer.log_append", benchLogAppend},
+    {"forecast.quantized", benchForecast},
+};
+
+static const int REPEATS = 5;
+
+struct Result {
+  std::string name;
+  long iterations;
+  double nsPerOp;
+  double allocsPerOp;
+  double bytesPerOp;
+  size_t peakHeap;
+  double sendsPerOp;  // -1 in baselines from before it was measured
+};
+
+static double timeRun(const Benchmark &benchmark, long iterations) {
+  auto start = std::chrono::steady_clock::now();
+  benchmark.run(iterations);
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static Result measure(const Benchmark &benchmark, double minTime) {
+  // Warm up, then grow the count until one run takes a tenth of minTime and
+  // scale it so that each repetition takes about minTime
+  timeRun(benchmark, 1);
+  long iterations = 1;
+  double seconds;
+  while ((seconds = timeRun(benchmark, iterations)) < minTime / 10 && iterations < (1L << 40)) iterations *= 4;
+  iterations = std::max(1L, (long)(iterations * minTime / std::max(seconds, 1e-9)));
+
+  std::vector<double> times;
+  times.reserve(REPEATS);
+  size_t allocationsBefore = allocations, bytesBefore = allocatedBytes, sendsBefore = sends;
+  size_t heapBase = heapInUse;
+  heapPeak = heapInUse;
+  for (int r = 0; r < REPEATS; r++) times.push_back(timeRun(benchmark, iterations));
+  size_t allocated = allocations - allocationsBefore, bytes = allocatedBytes - bytesBefore;
+  size_t sent = sends - sendsBefore;
+  size_t peak = heapPeak - heapBase;
+  std::sort(times.begin(), times.end());
+
+  Result result;
+  result.name = benchmark.name;
+  result.iterations = iterations;
+  result.nsPerOp = times[REPEATS / 2] * 1e9 / iterations;
+  result.allocsPerOp = (double)allocated / (REPEATS * iterations);
+  result.bytesPerOp = (double)bytes / (REPEATS * iterations);
+  result.peakHeap = peak;
+  result.sendsPerOp = (double)sent / (REPEATS * iterations);
+  return result;
+}
+
+static bool writeJson(const char *path, const std::vector<Result> &results) {
+  FILE *out = strcmp(path, "-") == 0 ? stdout : fopen(path, "w");
+  if (!out) return false;
+  fprintf(out, "{\"suite\": \"firmware_bench\", \"benchmarks\": [\n");
+  for (size_t i = 0; i < results.size(); i++) {
+    const Result &r = results[i];
+    fprintf(out,
+            "  {\"name\": \"%s\", \"iterations\": %ld, \"ns_per_op\": %.2f, \"allocs_per_op\": %.3f, "
+            "\"bytes_per_op\": %.1f, \"peak_heap_bytes\": %zu, \"sends_per_op\": %.2f}%s\n",
+            r.name.c_str(), r.iterations, r.nsPerOp, r.allocsPerOp, r.bytesPerOp, r.peakHeap, r.sendsPerOp,
+            i + 1 < results.size() ? "," : "");
+  }
+  fprintf(out, "]}\n");
+  if (out != stdout) fclose(out);
+  return true;
+}
+
+// Reads a file written by writeJson: one benchmark object per line
+static bool readJson(const char *path, std::vector<Result> &results) {
+  FILE *in = fopen(path, "r");
+  if (!in) return false;
+  char line[512];
+  while (fgets(line, sizeof(line), in)) {
+    char name[128];
+    Result r;
+    r.sendsPerOp = -1;
+    if (sscanf(line,
+               " {\"name\": \"%127[^\"]\", \"iterations\": %ld, \"ns_per_op\": %lf, \"allocs_per_op\": %lf, "
+               "\"bytes_per_op\": %lf, \"peak_heap_bytes\": %zu, \"sends_per_op\": %lf",
+               name, &r.iterations, &r.nsPerOp, &r.allocsPerOp, &r.bytesPerOp, &r.peakHeap, &r.sendsPerOp) >= 6) {
+      r.name = name;
+      results.push_back(r);
+    }
+  }
+  fclose(in);
+  return true;
+}
+
+static void usage(const char *program) {
+  fprintf(stderr,
+          "usage: %s [--filter TEXT] [--min-time SECONDS] [--json FILE|-] [--baseline FILE] [--threshold PERCENT]\n",
+          program);
+  exit(2);
+}
+
+int main(int argc, char **argv) {
+  const char *filter = NULL, *jsonPath = NULL, *baselinePath = NULL;
+  double minTime = 0.2, threshold = 10;
+  for (int i = 1; i < argc; i++) {
+    const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+    if (!value) usage(argv[0]);
+    if (strcmp(argv[i], "--filter") == 0) {
+      filter = value;
+    } else if (strcmp(argv[i], "--min-time") == 0) {
+      minTime = atof(value);
+    } else if (strcmp(argv[i], "--json") == 0) {
+      jsonPath = value;
+    } else if (strcmp(argv[i], "--baseline") == 0) {
+      baselinePath = value;
+    } else if (strcmp(argv[i], "--threshold") == 0) {
+      threshold = atof(value);
+    } else {
+      usage(argv[0]);
+    }
+    i++;
+  }
+
+  std::vector<Result> baseline;
+  if (baselinePath && !readJson(baselinePath, baseline)) {
+    fprintf(stderr, "%s: cannot read\n", baselinePath);
+    return 2;
+  }
+
+  setUpFirmware();
+  // The table goes to stderr when the JSON goes to stdout
+  FILE *table = jsonPath && strcmp(jsonPath, "-") == 0 ? stderr : stdout;
+  fprintf(table, "%-28s %12s %10s %10s %10s %9s %s\n", "benchmark", "ns/op", "allocs/op", "bytes/op", "peak heap",
+          "sends/op", baselinePath ? "  vs baseline" : "");
+
+  std::vector<Result> results;
+  bool regressed = false;
+  for (const Benchmark &benchmark : BENCHMARKS) {
+    if (filter && !strstr(benchmark.name, filter)) continue;
+    Result r = measure(benchmark, minTime);
+    results.push_back(r);
+    fprintf(table, "%-28s %12.1f %10.2f %10.1f %10zu %9.2f", r.name.c_str(), r.nsPerOp, r.allocsPerOp,
+            r.bytesPerOp, r.peakHeap, r.sendsPerOp);
+
+    for (const Result &old : baseline) {
+      if (old.name != r.name) continue;
+      double change = (r.nsPerOp - old.nsPerOp) * 100 / old.nsPerOp;
+      bool slower = change > threshold;
+      bool allocates = r.allocsPerOp > old.allocsPerOp + 1e-3 || r.bytesPerOp > old.bytesPerOp + 0.5;
+      bool chattier = old.sendsPerOp >= 0 && r.sendsPerOp > old.sendsPerOp + 1e-3;
+      fprintf(table, "  %+7.1f%%%s%s%s", change, slower ? "  SLOWER" : "", allocates ? "  MORE ALLOCATION" : "",
+              chattier ? "  MORE SENDS" : "");
+      regressed = regressed || slower || allocates || chattier;
+    }
+    fprintf(table, "\n");
+  }
+
+  if (jsonPath && !writeJson(jsonPath, results)) {
+    fprintf(stderr, "%s: cannot write\n", jsonPath);
+    return 2;
+  }
+  return regressed ? 1 : 0;
+}
@@ -0,0 +1,71 @@
+// Host-side check: the exported next-day forest against the Python model.
+//
+// Runs forestPredict() on the vectors in forest_parity_vectors.h and compares
+// every output with what the Python side computed for the same input (see
+// scripts/export_forest.py), then times a prediction and reports the model's
+// flash footprint. The expected outputs are scikit-learn's predict(), or
+// without scikit-learn the script's replay of it, which it checks against
+// predict() whenever both are available. Exits non-zero if any output is off
+// by more than the tolerance; regenerate both files together after retraining.
+//
+// Build and run from Weather/:
+//   g++ -O2 -std=c++17 -Ilib/Forecast bench/forest_parity.cpp lib/Forecast/RandomForest.cpp lib/Forecast/NextDayModel.cpp -o forest_parity
+//   ./forest_parity
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include "NextDayModel.h"
+#include "forest_parity_vectors.h"
+
+// Leaves are stored as float and summed in float, against double in Python
+static const double TOLERANCE = 1e-3;
+
+int main() {
+  static const char *NAMES[] = {"temperature", "humidity", "aqi"};
+  double maxError[NEXT_DAY_OUTPUTS] = {};
+  size_t failures = 0;
+
+  for (size_t i = 0; i < PARITY_COUNT; i++) {
+    float outputs[NEXT_DAY_OUTPUTS];
+    forestPredict(NEXT_DAY_MODEL, PARITY_INPUTS[i], outputs);
+    for (size_t o = 0; o < NEXT_DAY_OUTPUTS; o++) {
+      double error = fabs(outputs[o] - PARITY_EXPECTED[i][o]);
+      if (error > maxError[o]) maxError[o] = error;
+      if (error > TOLERANCE) {
+        if (failures++ < 10) {
+          printf("vector %zu %s: got %.6f, expected %.6f\n", i, NAMES[o], outputs[o], PARITY_EXPECTED[i][o]);
+        }
+      }
+    }
+  }
+
+  printf("reference: %s\n", PARITY_SOURCE);
+  printf("%zu vectors, max abs error:", PARITY_COUNT);
+  for (size_t o = 0; o < NEXT_DAY_OUTPUTS; o++) printf(" %s %.2g", NAMES[o], maxError[o]);
+  printf("\n");
+
+  const int rounds = 2000;
+  float sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; r++) {
+    float outputs[NEXT_DAY_OUTPUTS];
+    forestPredict(NEXT_DAY_MODEL, PARITY_INPUTS[r % PARITY_COUNT], outputs);
+    sink += outputs[0];
+  }
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  size_t bytes = NEXT_DAY_MODEL.nodeCount * sizeof(ForestNode) + NEXT_DAY_MODEL.treeCount * sizeof(uint16_t) +
+                 NEXT_DAY_MODEL.leafCount * NEXT_DAY_MODEL.outputCount * sizeof(float);
+  printf("%u trees, %u nodes, %u leaves: %zu bytes (node %zu B)\n", NEXT_DAY_MODEL.treeCount,
+         NEXT_DAY_MODEL.nodeCount, NEXT_DAY_MODEL.leafCount, bytes, sizeof(ForestNode));
+  printf("%.0f ns/prediction (checksum %.1f)\n", ns / rounds, sink);
+
+  if (failures) {
+    printf("FAIL: %zu outputs outside %.0e\n", failures, TOLERANCE);
+    return 1;
+  }
+  printf("ok\n");
+  return 0;
+}
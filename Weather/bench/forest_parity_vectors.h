@@ -0,0 +1,204 @@
+// Generated by scripts/export_forest.py - do not edit.
+// Expected outputs from: scikit-learn 1.7.1 RandomForestRegressor.predict(), replayed on the pickled trees (scikit-learn not installed)
+#pragma once
+
+static const char PARITY_SOURCE[] = "scikit-learn 1.7.1 RandomForestRegressor.predict(), replayed on the pickled trees (scikit-learn not installed)";
+static const size_t PARITY_COUNT = 96;
+// Inputs past the first PARITY_TYPICAL have one feature exactly on a split threshold
+static const size_t PARITY_TYPICAL = 64;
+static const float PARITY_INPUTS[][9] = {
+    {29.83704948425293f, 75.8004150390625f, 96.21180725097656f, 28.948333740234375f, 75.84402465820312f, 94.65972137451172f, 27.87420082092285f, 77.66802215576172f, 91.22222137451172f},
+    {30.509445190429688f, 74.7236099243164f, 98.33680725097656f, 29.83704948425293f, 75.8004150390625f, 96.21180725097656f, 28.948333740234375f, 75.84402465820312f, 94.65972137451172f},
+    {30.899166107177734f, 74.58902740478516f, 98.59027862548828f, 30.509445190429688f, 74.7236099243164f, 98.33680725097656f, 29.83704948425293f, 75.8004150390625f, 96.21180725097656f},
+    {31.242048263549805f, 74.45260620117188f, 100.07986450195312f, 30.899166107177734f, 74.58902740478516f, 98.59027862548828f, 30.509445190429688f, 74.7236099243164f, 98.33680725097656f},
+    {31.40913200378418f, 74.0670166015625f, 102.22222137451172f, 31.242048263549805f, 74.45260620117188f, 100.07986450195312f, 30.899166107177734f, 74.58902740478516f, 98.59027862548828f},
+    {31.559825897216797f, 73.81121826171875f, 101.98958587646484f, 31.40913200378418f, 74.0670166015625f, 102.22222137451172f, 31.242048263549805f, 74.45260620117188f, 100.07986450195312f},
+    {31.69649314880371f, 73.00680541992188f, 104.04513549804688f, 31.559825897216797f, 73.81121826171875f, 101.98958587646484f, 31.40913200378418f, 74.0670166015625f, 102.22222137451172f},
+    {31.762290954589844f, 73.27423858642578f, 103.84722137451172f, 31.69649314880371f, 73.00680541992188f, 104.04513549804688f, 31.559825897216797f, 73.81121826171875f, 101.98958587646484f},
+    {31.7762508392334f, 72.99742889404297f, 105.26388549804688f, 31.762290954589844f, 73.27423858642578f, 103.84722137451172f, 31.69649314880371f, 73.00680541992188f, 104.04513549804688f},
+    {31.873056411743164f, 73.20979309082031f, 104.57291412353516f, 31.7762508392334f, 72.99742889404297f, 105.26388549804688f, 31.762290954589844f, 73.27423858642578f, 103.84722137451172f},
+    {31.889375686645508f, 72.63111114501953f, 105.25694274902344f, 31.873056411743164f, 73.20979309082031f, 104.57291412353516f, 31.7762508392334f, 72.99742889404297f, 105.26388549804688f},
+    {31.834617614746094f, 73.1297607421875f, 104.67708587646484f, 31.889375686645508f, 72.63111114501953f, 105.25694274902344f, 31.873056411743164f, 73.20979309082031f, 104.57291412353516f},
+    {33.33174133300781f, 71.8470458984375f, 99.02842712402344f, 31.630992889404297f, 72.40782928466797f, 107.77848052978516f, 30.17357635498047f, 73.7203369140625f, 103.92691802978516f},
+    {31.271333694458008f, 71.20405578613281f, 105.20002746582031f, 31.630666732788086f, 70.86712646484375f, 106.669677734375f, 33.45534896850586f, 79.3597183227539f, 106.24634552001953f},
+    {28.888633728027344f, 67.752685546875f, 109.38746643066406f, 30.18105125427246f, 75.34326171875f, 97.15335083007812f, 29.76329231262207f, 76.683837890625f, 92.76315307617188f},
+    {31.630142211914062f, 78.33076477050781f, 100.22158813476562f, 33.69996643066406f, 73.9879150390625f, 93.75413513183594f, 33.08926773071289f, 71.52949523925781f, 110.80484771728516f},
+    {30.504783630371094f, 80.77388000488281f, 93.00093078613281f, 30.281570434570312f, 78.93304443359375f, 86.38616180419922f, 30.19901466369629f, 73.34507751464844f, 96.75658416748047f},
+    {33.31365203857422f, 73.2962646484375f, 93.64466857910156f, 30.11767578125f, 74.57084655761719f, 108.74345397949219f, 28.48320960998535f, 75.35382080078125f, 102.66326904296875f},
+    {32.19931411743164f, 79.48612976074219f, 88.0859603881836f, 31.92128562927246f, 75.2752456665039f, 104.12527465820312f, 26.156883239746094f, 79.84393310546875f, 98.90675354003906f},
+    {30.430368423461914f, 68.7223129272461f, 97.34076690673828f, 32.41139602661133f, 75.29424285888672f, 103.55677032470703f, 28.97081184387207f, 77.61402893066406f, 109.67491149902344f},
+    {32.599098205566406f, 80.6741943359375f, 106.65772247314453f, 30.07932472229004f, 74.15245819091797f, 100.16194152832031f, 27.649330139160156f, 80.57106018066406f, 101.27616882324219f},
+    {34.29396438598633f, 78.20518493652344f, 84.12580108642578f, 31.8743953704834f, 77.40097045898438f, 108.29498291015625f, 28.680814743041992f, 77.5662612915039f, 95.4316635131836f},
+    {31.157346725463867f, 76.39056396484375f, 106.98692321777344f, 29.31117057800293f, 78.0423355102539f, 91.04090881347656f, 28.803726196289062f, 79.12606811523438f, 95.0432357788086f},
+    {28.07239532470703f, 69.43853759765625f, 102.2244644165039f, 27.123273849487305f, 76.92023468017578f, 104.10147857666016f, 29.14632797241211f, 78.5833511352539f, 85.69917297363281f},
+    {30.568309783935547f, 86.00008392333984f, 98.54523468017578f, 27.62203598022461f, 79.10353088378906f, 92.47042846679688f, 28.23275375366211f, 75.6496353149414f, 110.81014251708984f},
+    {28.813661575317383f, 71.96871948242188f, 113.42211151123047f, 31.872785568237305f, 70.59370422363281f, 89.68656158447266f, 26.50806999206543f, 75.32675170898438f, 89.736572265625f},
+    {31.30205535888672f, 79.6426773071289f, 97.29407501220703f, 29.881591796875f, 75.5833740234375f, 104.15486145019531f, 27.0481014251709f, 76.70580291748047f, 109.46736145019531f},
+    {33.77040481567383f, 84.88677215576172f, 93.59542846679688f, 34.863563537597656f, 80.89171600341797f, 85.46722412109375f, 34.25534439086914f, 76.47109985351562f, 107.31034088134766f},
+    {29.343542098999023f, 79.1499252319336f, 108.75035095214844f, 28.669939041137695f, 75.93087768554688f, 112.15703582763672f, 34.07249069213867f, 79.10303497314453f, 107.14430236816406f},
+    {35.58271026611328f, 68.2680892944336f, 100.2286605834961f, 28.546567916870117f, 75.90620422363281f, 104.24154663085938f, 27.431983947753906f, 70.48966217041016f, 98.52542877197266f},
+    {30.695316314697266f, 75.00762939453125f, 97.39936828613281f, 36.71211242675781f, 75.9670639038086f, 96.02442932128906f, 34.516204833984375f, 69.92747497558594f, 108.90826416015625f},
+    {29.865488052368164f, 82.20018005371094f, 110.893798828125f, 28.03441047668457f, 70.04586029052734f, 99.12297058105469f, 28.812536239624023f, 83.3713150024414f, 108.86251831054688f},
+    {30.29519271850586f, 77.59988403320312f, 96.97786712646484f, 31.4991455078125f, 67.95036315917969f, 97.26202392578125f, 28.400257110595703f, 70.61091613769531f, 96.74237823486328f},
+    {32.30274963378906f, 83.90957641601562f, 99.80595397949219f, 25.449134826660156f, 67.60747528076172f, 105.81846618652344f, 26.218584060668945f, 88.75243377685547f, 119.18653869628906f},
+    {29.34881591796875f, 87.59770965576172f, 99.88382720947266f, 27.392257690429688f, 78.99300384521484f, 114.29582214355469f, 26.5169677734375f, 79.44442749023438f, 105.44284057617188f},
+    {28.23358154296875f, 74.83195495605469f, 115.30438232421875f, 32.74256134033203f, 72.45542907714844f, 100.06597137451172f, 34.180389404296875f, 74.57459259033203f, 102.04783630371094f},
+    {29.288999557495117f, 78.30644226074219f, 102.51437377929688f, 29.219247817993164f, 69.35855102539062f, 104.2670669555664f, 33.73661804199219f, 78.50080871582031f, 96.90605926513672f},
+    {34.352508544921875f, 86.34195709228516f, 92.12307739257812f, 23.69029426574707f, 72.35676574707031f, 96.13179016113281f, 24.675546646118164f, 84.48644256591797f, 114.7697982788086f},
+    {30.53400230407715f, 75.13043212890625f, 92.86079406738281f, 28.47474479675293f, 80.01742553710938f, 107.3361587524414f, 30.384218215942383f, 84.91261291503906f, 88.10116577148438f},
+    {30.157672882080078f, 64.97069549560547f, 99.6806869506836f, 25.989713668823242f, 71.35823822021484f, 99.3414077758789f, 28.19913673400879f, 76.49620056152344f, 78.73538970947266f},
+    {27.357023239135742f, 61.97713851928711f, 92.69139862060547f, 26.42348861694336f, 69.3731460571289f, 109.06301879882812f, 26.110376358032227f, 70.60440826416016f, 82.36543273925781f},
+    {30.041603088378906f, 79.7690658569336f, 104.65673065185547f, 29.679704666137695f, 79.59484100341797f, 94.63139343261719f, 28.121479034423828f, 75.63269805908203f, 97.96651458740234f},
+    {36.63177490234375f, 85.6539077758789f, 81.4952163696289f, 31.74107551574707f, 80.49073791503906f, 106.70381164550781f, 27.54450035095215f, 81.20801544189453f, 102.95930480957031f},
+    {32.69771957397461f, 70.8236312866211f, 115.24710083007812f, 32.75835037231445f, 66.8527603149414f, 95.8864517211914f, 33.364234924316406f, 66.59053802490234f, 94.90278625488281f},
+    {29.139108657836914f, 68.9434585571289f, 122.95303344726562f, 33.71049880981445f, 73.62085723876953f, 84.61485290527344f, 24.300813674926758f, 71.11053466796875f, 98.69419860839844f},
+    {36.25632858276367f, 85.15425109863281f, 89.51636505126953f, 21.623828887939453f, 77.61824798583984f, 100.01559448242188f, 26.664447784423828f, 83.66881561279297f, 118.8308334350586f},
+    {31.743789672851562f, 69.70548248291016f, 106.7756576538086f, 34.847381591796875f, 77.34973907470703f, 106.61328887939453f, 29.06426239013672f, 73.19722747802734f, 99.16737365722656f},
+    {29.353466033935547f, 74.61894226074219f, 104.31987762451172f, 32.182376861572266f, 75.01746368408203f, 103.64785766601562f, 31.897146224975586f, 75.9021224975586f, 111.90123748779297f},
+    {32.8411865234375f, 84.420654296875f, 119.20415496826172f, 28.274436950683594f, 76.08820343017578f, 89.40306091308594f, 29.997272491455078f, 87.4905014038086f, 104.90557098388672f},
+    {29.5704345703125f, 75.00065612792969f, 101.47163391113281f, 31.788833618164062f, 79.22942352294922f, 101.82359313964844f, 28.855567932128906f, 85.5190200805664f, 92.49267578125f},
+    {31.66415023803711f, 79.94513702392578f, 93.14411926269531f, 29.087961196899414f, 71.11097717285156f, 107.51526641845703f, 30.920812606811523f, 79.84153747558594f, 106.09757232666016f},
+    {29.805686950683594f, 77.71615600585938f, 102.19169616699219f, 29.856639862060547f, 72.17052459716797f, 86.88386535644531f, 29.77583885192871f, 75.90495300292969f, 99.92863464355469f},
+    {32.96052551269531f, 80.07801055908203f, 96.21369934082031f, 31.46334457397461f, 75.9210205078125f, 106.5989990234375f, 30.789249420166016f, 78.93070983886719f, 96.39307403564453f},
+    {32.522010803222656f, 92.64105987548828f, 83.28813934326172f, 25.515655517578125f, 75.8406753540039f, 92.3334732055664f, 25.022319793701172f, 81.65928649902344f, 114.6208267211914f},
+    {33.207183837890625f, 77.58824157714844f, 91.29107666015625f, 32.15925598144531f, 72.02259063720703f, 88.82199096679688f, 27.94810676574707f, 70.22187805175781f, 103.14137268066406f},
+    {34.00298309326172f, 74.17460632324219f, 92.89221954345703f, 33.30906295776367f, 76.11014556884766f, 90.34062957763672f, 31.72186851501465f, 79.36078643798828f, 95.44121551513672f},
+    {31.58989143371582f, 72.89859008789062f, 89.65864562988281f, 30.33181381225586f, 69.51339721679688f, 89.14163208007812f, 30.53762435913086f, 77.77071380615234f, 88.61670684814453f},
+    {29.074899673461914f, 70.26681518554688f, 121.84022521972656f, 34.55951690673828f, 66.81835174560547f, 91.26338195800781f, 35.553192138671875f, 76.27982330322266f, 110.90386199951172f},
+    {27.784420013427734f, 82.68110656738281f, 107.21113586425781f, 31.39261817932129f, 73.65880584716797f, 102.42491912841797f, 29.805063247680664f, 81.93875885009766f, 105.26570129394531f},
+    {35.85892105102539f, 65.46302795410156f, 123.55485534667969f, 36.00693893432617f, 60.67803192138672f, 93.81581115722656f, 32.50731658935547f, 62.468284606933594f, 92.18009948730469f},
+    {25.03353500366211f, 56.332767486572266f, 100.74237823486328f, 26.350374221801758f, 74.93785858154297f, 118.76490020751953f, 26.979909896850586f, 71.61824035644531f, 77.68673706054688f},
+    {33.30409240722656f, 79.49004364013672f, 104.5888442993164f, 31.42428970336914f, 74.41825866699219f, 102.36751556396484f, 34.0256233215332f, 69.17675018310547f, 107.92295837402344f},
+    {36.6265754699707f, 92.28473663330078f, 92.01631164550781f, 32.06897735595703f, 85.32164764404297f, 89.47187042236328f, 31.040143966674805f, 75.65620422363281f, 111.3112564086914f},
+    {30.488849639892578f, 80.16435241699219f, 94.88516998291016f, 28.360628128051758f, 73.5643539428711f, 88.92622375488281f, 30.05864715576172f, 73.4996109008789f, 88.5618896484375f},
+    {35.58271026611328f, 68.2680892944336f, 100.2286605834961f, 30.70430564880371f, 75.90620422363281f, 104.24154663085938f, 27.431983947753906f, 70.48966217041016f, 98.52542877197266f},
+    {31.743789672851562f, 69.70548248291016f, 101.03472900390625f, 34.847381591796875f, 77.34973907470703f, 106.61328887939453f, 29.06426239013672f, 73.19722747802734f, 99.16737365722656f},
+    {31.873056411743164f, 73.20979309082031f, 104.57291412353516f, 31.7762508392334f, 72.99742889404297f, 105.26388549804688f, 30.623090744018555f, 73.27423858642578f, 103.84722137451172f},
+    {32.19931411743164f, 79.48612976074219f, 88.0859603881836f, 31.92128562927246f, 75.2752456665039f, 99.20833587646484f, 26.156883239746094f, 79.84393310546875f, 98.90675354003906f},
+    {31.30205535888672f, 79.6426773071289f, 97.29407501220703f, 29.881591796875f, 75.5833740234375f, 104.15486145019531f, 27.0481014251709f, 76.70580291748047f, 96.49826049804688f},
+    {29.83704948425293f, 74.52081298828125f, 96.21180725097656f, 28.948333740234375f, 75.84402465820312f, 94.65972137451172f, 27.87420082092285f, 77.66802215576172f, 91.22222137451172f},
+    {31.30205535888672f, 79.6426773071289f, 97.29407501220703f, 29.881591796875f, 75.5833740234375f, 104.15486145019531f, 27.0481014251709f, 75.26200866699219f, 109.46736145019531f},
+    {31.070606231689453f, 78.33076477050781f, 100.22158813476562f, 33.69996643066406f, 73.9879150390625f, 93.75413513183594f, 33.08926773071289f, 71.52949523925781f, 110.80484771728516f},
+    {29.83704948425293f, 75.8004150390625f, 100.28993225097656f, 28.948333740234375f, 75.84402465820312f, 94.65972137451172f, 27.87420082092285f, 77.66802215576172f, 91.22222137451172f},
+    {34.352508544921875f, 86.34195709228516f, 92.12307739257812f, 23.69029426574707f, 72.35676574707031f, 96.13179016113281f, 24.675546646118164f, 75.21652221679688f, 114.7697982788086f},
+    {29.353466033935547f, 74.61894226074219f, 104.31987762451172f, 30.70430564880371f, 75.01746368408203f, 103.64785766601562f, 31.897146224975586f, 75.9021224975586f, 111.90123748779297f},
+    {31.242048263549805f, 74.45260620117188f, 100.40625f, 30.899166107177734f, 74.58902740478516f, 98.59027862548828f, 30.509445190429688f, 74.7236099243164f, 98.33680725097656f},
+    {35.58271026611328f, 68.2680892944336f, 99.33506774902344f, 28.546567916870117f, 75.90620422363281f, 104.24154663085938f, 27.431983947753906f, 70.48966217041016f, 98.52542877197266f},
+    {32.19931411743164f, 79.48612976074219f, 100.16319274902344f, 31.92128562927246f, 75.2752456665039f, 104.12527465820312f, 26.156883239746094f, 79.84393310546875f, 98.90675354003906f},
+    {28.07239532470703f, 69.43853759765625f, 102.2244644165039f, 27.123273849487305f, 76.92023468017578f, 104.10147857666016f, 29.14632797241211f, 75.26200866699219f, 85.69917297363281f},
+    {27.784420013427734f, 74.58810424804688f, 107.21113586425781f, 31.39261817932129f, 73.65880584716797f, 102.42491912841797f, 29.805063247680664f, 81.93875885009766f, 105.26570129394531f},
+    {28.888633728027344f, 67.752685546875f, 109.38746643066406f, 31.15414810180664f, 75.34326171875f, 97.15335083007812f, 29.76329231262207f, 76.683837890625f, 92.76315307617188f},
+    {31.15414810180664f, 79.49004364013672f, 104.5888442993164f, 31.42428970336914f, 74.41825866699219f, 102.36751556396484f, 34.0256233215332f, 69.17675018310547f, 107.92295837402344f},
+    {29.139108657836914f, 68.9434585571289f, 122.95303344726562f, 33.71049880981445f, 73.62085723876953f, 84.61485290527344f, 24.300813674926758f, 74.32801818847656f, 98.69419860839844f},
+    {32.30274963378906f, 83.90957641601562f, 99.80595397949219f, 25.449134826660156f, 67.60747528076172f, 105.81846618652344f, 26.218584060668945f, 88.75243377685547f, 96.49826049804688f},
+    {30.504783630371094f, 80.77388000488281f, 93.00093078613281f, 30.281570434570312f, 75.21652221679688f, 86.38616180419922f, 30.19901466369629f, 73.34507751464844f, 96.75658416748047f},
+    {31.484477996826172f, 74.45260620117188f, 100.07986450195312f, 30.899166107177734f, 74.58902740478516f, 98.59027862548828f, 30.509445190429688f, 74.7236099243164f, 98.33680725097656f},
+    {31.30205535888672f, 79.6426773071289f, 97.29407501220703f, 29.881591796875f, 75.5833740234375f, 104.15486145019531f, 27.0481014251709f, 75.26200866699219f, 109.46736145019531f},
+    {31.743789672851562f, 74.32801818847656f, 106.7756576538086f, 34.847381591796875f, 77.34973907470703f, 106.61328887939453f, 29.06426239013672f, 73.19722747802734f, 99.16737365722656f},
+    {36.63177490234375f, 85.6539077758789f, 81.4952163696289f, 31.74107551574707f, 80.49073791503906f, 106.70381164550781f, 27.54450035095215f, 75.26200866699219f, 102.95930480957031f},
+    {25.03353500366211f, 56.332767486572266f, 100.74237823486328f, 26.350374221801758f, 74.93785858154297f, 118.76490020751953f, 29.72888946533203f, 71.61824035644531f, 77.68673706054688f},
+    {34.352508544921875f, 86.34195709228516f, 97.40104675292969f, 23.69029426574707f, 72.35676574707031f, 96.13179016113281f, 24.675546646118164f, 84.48644256591797f, 114.7697982788086f},
+    {34.352508544921875f, 86.34195709228516f, 92.12307739257812f, 23.69029426574707f, 72.35676574707031f, 96.13179016113281f, 24.675546646118164f, 74.52081298828125f, 114.7697982788086f},
+    {30.041603088378906f, 79.7690658569336f, 104.65673065185547f, 29.679704666137695f, 79.59484100341797f, 94.63139343261719f, 30.173248291015625f, 75.63269805908203f, 97.96651458740234f},
+    {28.07239532470703f, 74.52081298828125f, 102.2244644165039f, 27.123273849487305f, 76.92023468017578f, 104.10147857666016f, 29.14632797241211f, 78.5833511352539f, 85.69917297363281f},
+    {31.889375686645508f, 74.52081298828125f, 105.25694274902344f, 31.873056411743164f, 73.20979309082031f, 104.57291412353516f, 31.7762508392334f, 72.99742889404297f, 105.26388549804688f},
+    {31.271333694458008f, 74.52081298828125f, 105.20002746582031f, 31.630666732788086f, 70.86712646484375f, 106.669677734375f, 33.45534896850586f, 79.3597183227539f, 106.24634552001953f},
+};
+static const double PARITY_EXPECTED[][3] = {
+    {30.67461302083343, 74.65976319444438, 98.60772569444408},
+    {30.97436163194452, 74.5474309027779, 99.03418402777754},
+    {31.211665972222264, 74.40714305555565, 100.15940972222208},
+    {31.408280729166655, 74.05224722222229, 101.8817708333335},
+    {31.562759027777712, 73.71787430555544, 102.35555555555563},
+    {31.685809375000087, 73.14795763888864, 103.83079861111133},
+    {31.74824687500008, 73.20304392361085, 104.07298611111139},
+    {31.758482291666663, 73.07582222222197, 104.72829861111133},
+    {31.757923958333336, 73.0868944444442, 104.67163194444467},
+    {31.75813333333333, 73.08274236111086, 104.69288194444466},
+    {31.757923958333336, 73.0868944444442, 104.67163194444467},
+    {31.757923958333336, 73.0868944444442, 104.67163194444467},
+    {31.632836805555556, 73.38077552083315, 103.63067708333342},
+    {31.631912326388893, 73.39699427083316, 103.5061631944446},
+    {31.172431770833374, 74.25978541666669, 100.45006944444431},
+    {31.496593229166695, 73.6509581597221, 102.58060763888896},
+    {31.07212309027784, 74.38099131944446, 100.00239583333318},
+    {31.367793055555595, 73.94585138888883, 101.5928298611111},
+    {31.20096354166672, 74.11953350694438, 100.8547916666666},
+    {31.30217829861116, 74.01492638888884, 101.24456597222219},
+    {31.289826562500025, 74.00738888888883, 101.23005208333326},
+    {31.137576388888945, 74.21140277777774, 100.49907986111103},
+    {31.01017656250005, 74.42879375000003, 99.73644097222201},
+    {31.13856736111115, 74.1990859375, 100.55840277777763},
+    {30.98965937500007, 74.46732621527782, 99.49890624999978},
+    {31.32702586805558, 73.98119513888886, 101.43394097222217},
+    {31.141235069444498, 74.26651944444446, 100.28553819444433},
+    {31.23045260416672, 74.08059184027772, 101.0257465277777},
+    {31.17627187500003, 74.14341909722219, 100.71024305555544},
+    {31.43906093750003, 73.7828029513888, 102.18282986111117},
+    {31.28598958333339, 74.0556565972222, 101.10081597222215},
+    {31.128253993055583, 74.22402968749998, 100.43729166666654},
+    {31.173103645833386, 74.15710208333331, 100.71598958333321},
+    {31.265473437500034, 74.00547847222215, 101.22279513888886},
+    {31.03212430555561, 74.33913767361109, 99.99637152777763},
+    {31.468087326388904, 73.73033715277768, 102.2589930555556},
+    {31.19081093750002, 74.09805069444442, 100.85060763888877},
+    {31.086892534722292, 74.22204114583327, 100.36319444444428},
+    {30.927636111111184, 74.46681041666668, 99.48374999999979},
+    {31.182073437500026, 74.18663003472221, 100.68177083333325},
+    {31.228801041666706, 74.03729531249995, 101.20880208333327},
+    {31.01041076388893, 74.4288029513889, 99.7302604166665},
+    {31.21375121527782, 74.06821649305546, 101.01001736111104},
+    {31.61418454861111, 73.45653819444428, 103.40607638888899},
+    {31.475440104166687, 73.71102152777769, 102.33781249999997},
+    {31.070934548611177, 74.28737777777773, 100.21309027777761},
+    {31.57278993055557, 73.52929687499984, 103.02055555555563},
+    {31.397973437500017, 73.89310642361106, 101.71894097222226},
+    {31.177130555555596, 74.18764618055552, 100.65510416666655},
+    {31.124325520833374, 74.2395251736111, 100.34972222222208},
+    {31.240647222222275, 74.02326822916659, 101.15279513888883},
+    {31.145329513888914, 74.2502138888889, 100.36156249999985},
+    {31.207372569444505, 74.1399053819444, 100.80298611111105},
+    {30.992235937500077, 74.35630972222216, 99.88944444444422},
+    {31.350141840277814, 73.8468703124999, 101.83869791666659},
+    {31.28237586805561, 74.0581067708333, 101.21930555555554},
+    {31.247196180555612, 74.06726788194439, 101.08274305555551},
+    {31.47125468750002, 73.72037829861102, 102.34961805555552},
+    {31.32008263888892, 73.92971354166659, 101.43765624999997},
+    {31.601586284722224, 73.47241597222207, 103.343888888889},
+    {31.28522829861114, 74.01985468749996, 101.35293402777772},
+    {31.57889791666669, 73.50307916666648, 103.0740972222224},
+    {31.24707725694449, 74.09967465277772, 100.98960069444432},
+    {31.046666319444515, 74.32186041666665, 100.03374999999981},
+    {31.476582812500027, 73.7399982638888, 102.37348958333338},
+    {31.56335399305557, 73.53717638888874, 102.98789930555564},
+    {31.725376041666653, 73.18072152777754, 104.29828125000014},
+    {31.168344618055606, 74.19205954861107, 100.6471701388888},
+    {31.07220138888895, 74.37611302083339, 99.86145833333322},
+    {30.85722899305563, 74.54683194444446, 99.28986111111088},
+    {31.205792534722267, 74.19447187500002, 100.66144097222215},
+    {31.430349479166697, 73.81086249999993, 102.05828124999998},
+    {30.8123802083334, 74.5738435763889, 99.05706597222193},
+    {31.214760243055615, 74.10281145833329, 100.90348958333325},
+    {31.342145833333344, 74.02288437499998, 101.30673611111109},
+    {31.427627256944426, 74.01902604166672, 101.9989583333335},
+    {31.4060072916667, 73.85586180555549, 101.91772569444448},
+    {31.280288368055597, 74.03971111111106, 101.19529513888887},
+    {31.219335416666695, 74.11434253472221, 100.94902777777769},
+    {31.404942534722235, 73.8477137152777, 101.80140625},
+    {31.23580798611114, 74.17392256944447, 100.81682291666655},
+    {31.522666145833362, 73.63717864583319, 102.61098958333343},
+    {31.47204045138892, 73.715548611111, 102.26781249999996},
+    {31.185126388888936, 74.1342598958333, 100.75041666666658},
+    {31.10699531250006, 74.36494930555558, 100.09607638888876},
+    {31.421290277777768, 74.0229633680556, 101.90720486111124},
+    {31.205792534722267, 74.19447187500002, 100.66144097222215},
+    {31.545051215277784, 73.60732916666652, 102.77404513888898},
+    {31.301454166666705, 73.98213593749992, 101.40569444444444},
+    {31.30243020833336, 74.01182447916663, 101.40595486111107},
+    {31.12469375000007, 74.20853680555553, 100.41944444444427},
+    {31.239013368055616, 74.0428416666666, 101.06069444444438},
+    {31.075300520833363, 74.37746267361115, 100.01444444444432},
+    {31.095477256944474, 74.28758350694447, 100.2725520833332},
+    {31.715712847222232, 73.1895677083331, 104.28312500000021},
+    {31.58648020833334, 73.48834374999984, 103.16546875000014},
+};
@@ -0,0 +1,158 @@
+// Host-side benchmark: the quantized next-day forest, at each byte budget
+// scripts/export_forest.py was run with, against the float one.
+//
+// For the float forest and every budget's prefix of NEXT_DAY_QUANTIZED
+// (forest_quantized_budgets.h, full, 50% and 25% by default) it reports
+// flash size, time per prediction, the mean absolute and largest difference
+// from the float forest on the typical inputs of forest_parity_vectors.h,
+// and the mean absolute error against the actual next-day means in
+// sensor_data.csv (lag vectors built the way the model was trained: daily
+// means of the three previous days, t-1 first). The first budget is the one
+// the firmware runs, NextDayModelQuantized.cpp.
+//
+// Build and run from Weather/:
+//   g++ -O2 -std=c++17 -Ilib/Forecast bench/forest_quantized_bench.cpp lib/Forecast/RandomForest.cpp lib/Forecast/QuantizedForest.cpp lib/Forecast/NextDayModel.cpp lib/Forecast/NextDayModelQuantized.cpp -o forest_quantized_bench
+//   ./forest_quantized_bench ../sensor_data.csv
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "NextDayModel.h"
+#include "forest_parity_vectors.h"
+#include "forest_quantized_budgets.h"
+
+struct DayMean {
+  float values[NEXT_DAY_OUTPUTS];
+};
+
+// Daily means of temperature, humidity and AQI; rows are in time order
+static bool loadDays(const char *path, std::vector<DayMean> &days) {
+  FILE *file = fopen(path, "r");
+  if (!file) return false;
+
+  char line[256], day[16] = "";
+  double sums[NEXT_DAY_OUTPUTS] = {};
+  int count = 0;
+  if (!fgets(line, sizeof(line), file)) return false;  // header
+  for (bool more = true; more;) {
+    more = fgets(line, sizeof(line), file) != NULL;
+    char date[16];
+    float values[NEXT_DAY_OUTPUTS];
+    bool parsed = more && sscanf(line, "%15[^ ] %*[^,],%f,%f,%f", date, &values[0], &values[1], &values[2]) == 4;
+    if (more && !parsed) continue;
+    if (count > 0 && (!more || strcmp(date, day) != 0)) {
+      DayMean mean;
+      for (int o = 0; o < NEXT_DAY_OUTPUTS; o++) mean.values[o] = sums[o] / count;
+      days.push_back(mean);
+      memset(sums, 0, sizeof(sums));
+      count = 0;
+    }
+    if (!more) break;
+    strcpy(day, date);
+    for (int o = 0; o < NEXT_DAY_OUTPUTS; o++) sums[o] += values[o];
+    count++;
+  }
+  fclose(file);
+  return days.size() > NEXT_DAY_LAGS;
+}
+
+// The float forest when `quantized` is NULL
+struct Engine {
+  char name[16];
+  const QuantizedForest *quantized;
+  unsigned trees;
+  size_t bytes;
+};
+
+static void predict(const Engine &engine, const float *features, float *outputs) {
+  if (!engine.quantized) {
+    forestPredict(NEXT_DAY_MODEL, features, outputs);
+    return;
+  }
+  int16_t quantized[NEXT_DAY_FEATURES];
+  quantizeFeatures(*engine.quantized, features, quantized);
+  quantizedPredict(*engine.quantized, quantized, outputs);
+}
+
+static double nsPerPrediction(const Engine &engine) {
+  const int rounds = 20000;
+  float sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; r++) {
+    float outputs[NEXT_DAY_OUTPUTS];
+    predict(engine, PARITY_INPUTS[r % PARITY_TYPICAL], outputs);
+    sink += outputs[0];
+  }
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  if (sink == 12345) printf(" ");  // keeps the loop from being optimized away
+  return ns / rounds;
+}
+
+int main(int argc, char **argv) {
+  const char *path = argc > 1 ? argv[1] : "../sensor_data.csv";
+  std::vector<DayMean> days;
+  if (!loadDays(path, days)) {
+    fprintf(stderr, "cannot read at least %u days from %s\n", NEXT_DAY_LAGS + 1, path);
+    return 1;
+  }
+
+  // The table must describe the exported model, or the prefixes below are
+  // not whole trees
+  if (NEXT_DAY_QUANTIZED.treeCount != BUDGETS[0].trees || NEXT_DAY_QUANTIZED.nodeCount != BUDGETS[0].nodes ||
+      NEXT_DAY_QUANTIZED.leafCount != BUDGETS[0].leaves) {
+    fprintf(stderr, "forest_quantized_budgets.h does not match NextDayModelQuantized.cpp; re-run export_forest.py\n");
+    return 1;
+  }
+
+  std::vector<QuantizedForest> pruned(BUDGET_COUNT, NEXT_DAY_QUANTIZED);
+  std::vector<Engine> engines;
+  size_t floatBytes = NEXT_DAY_MODEL.nodeCount * sizeof(ForestNode) + NEXT_DAY_MODEL.treeCount * sizeof(uint16_t) +
+                      NEXT_DAY_MODEL.leafCount * NEXT_DAY_MODEL.outputCount * sizeof(float);
+  engines.push_back({"float", NULL, NEXT_DAY_MODEL.treeCount, floatBytes});
+  for (size_t b = 0; b < BUDGET_COUNT; b++) {
+    // Trees are stored in order, so the first `trees` of them form a forest
+    pruned[b].treeCount = BUDGETS[b].trees;
+    pruned[b].nodeCount = BUDGETS[b].nodes;
+    pruned[b].leafCount = BUDGETS[b].leaves;
+    Engine engine = {"", &pruned[b], BUDGETS[b].trees, quantizedForestBytes(pruned[b])};
+    snprintf(engine.name, sizeof(engine.name), "q %s%s", BUDGETS[b].label, b == 0 ? "*" : "");
+    engines.push_back(engine);
+  }
+
+  printf("%s: %zu days, %zu with a full lag window\n", path, days.size(), days.size() - NEXT_DAY_LAGS);
+  printf("  %-10s %5s %6s %8s   %-26s %-26s %s\n", "engine", "trees", "bytes", "ns/pred", "MAE vs next day (t/h/aqi)",
+         "MAE vs float (t/h/aqi)", "max diff from float");
+  for (const Engine &engine : engines) {
+    double mae[NEXT_DAY_OUTPUTS] = {};
+    for (size_t day = NEXT_DAY_LAGS; day < days.size(); day++) {
+      float features[NEXT_DAY_FEATURES], outputs[NEXT_DAY_OUTPUTS];
+      for (int lag = 0; lag < NEXT_DAY_LAGS; lag++) {
+        memcpy(&features[lag * 3], days[day - 1 - lag].values, sizeof(DayMean));
+      }
+      predict(engine, features, outputs);
+      for (int o = 0; o < NEXT_DAY_OUTPUTS; o++) {
+        mae[o] += fabs(outputs[o] - days[day].values[o]) / (days.size() - NEXT_DAY_LAGS);
+      }
+    }
+
+    double drift[NEXT_DAY_OUTPUTS] = {}, diff[NEXT_DAY_OUTPUTS] = {};
+    for (size_t i = 0; i < PARITY_TYPICAL; i++) {
+      float reference[NEXT_DAY_OUTPUTS], outputs[NEXT_DAY_OUTPUTS];
+      forestPredict(NEXT_DAY_MODEL, PARITY_INPUTS[i], reference);
+      predict(engine, PARITY_INPUTS[i], outputs);
+      for (int o = 0; o < NEXT_DAY_OUTPUTS; o++) {
+        drift[o] += fabs(outputs[o] - reference[o]) / PARITY_TYPICAL;
+        diff[o] = fmax(diff[o], fabs(outputs[o] - reference[o]));
+      }
+    }
+
+    printf("  %-10s %5u %6zu %8.0f   %6.3f/%6.3f/%6.3f      %6.3f/%6.3f/%6.3f      %6.3f/%6.3f/%6.3f\n", engine.name,
+           engine.trees, engine.bytes, nsPerPrediction(engine), mae[0], mae[1], mae[2], drift[0], drift[1], drift[2],
+           diff[0], diff[1], diff[2]);
+  }
+  printf("  (* is NextDayModelQuantized.cpp; MAE vs float over %zu inputs)\n", PARITY_TYPICAL);
+  return 0;
+}
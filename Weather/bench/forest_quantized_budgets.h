@@ -0,0 +1,21 @@
+// Generated by scripts/export_forest.py from forecast_model.pkl - do not edit.
+// The prefix of NEXT_DAY_QUANTIZED's trees each --budget keeps; the first budget
+// is the one NextDayModelQuantized.cpp was exported with.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct ForestBudget {
+  const char *label;
+  uint16_t trees;  // the first `trees` of NEXT_DAY_QUANTIZED
+  uint16_t nodes;
+  uint16_t leaves;
+};
+
+static const ForestBudget BUDGETS[] = {
+    {"100%", 200, 1928, 1064},
+    {"50%", 99, 961, 530},
+    {"25%", 47, 469, 258},
+};
+static const size_t BUDGET_COUNT = 3;
@@ -0,0 +1,81 @@
+// Host-side microbenchmark for HttpParser.
+//
+// Feeds a typical browser request through the parser whole, in TCP-sized
+// pieces and byte by byte, and reports throughput plus heap allocations per
+// request (counted by interposing malloc/operator new). What the parser
+// extracts is checked by test/test_http_parser.
+//
+// Build and run from Weather/:
+//   g++ -O2 -std=c++17 -Ilib/HttpServer bench/http_parser_bench.cpp lib/HttpServer/HttpParser.cpp -o http_parser_bench
+//   ./http_parser_bench
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "HttpParser.h"
+
+extern "C" void *__libc_malloc(size_t size);
+
+static size_t allocations = 0;
+
+extern "C" void *malloc(size_t size) {
+  allocations++;
+  return __libc_malloc(size);
+}
+
+void *operator new(size_t size) {
+  allocations++;
+  void *p = __libc_malloc(size);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+static const char REQUEST[] =
+    "GET /api/now HTTP/1.1\r\n"
+    "Host: 192.168.1.42\r\n"
+    "Connection: keep-alive\r\n"
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) "
+    "Chrome/124.0.0.0 Safari/537.36\r\n"
+    "Accept: */*\r\n"
+    "Referer: http://192.168.1.42/\r\n"
+    "Accept-Encoding: gzip, deflate\r\n"
+    "Accept-Language: en-GB,en-US;q=0.9,en;q=0.8\r\n"
+    "If-None-Match: \"33e1fff039c275eb\"\r\n"
+    "\r\n";
+
+static void run(const char *label, size_t chunk, long iterations) {
+  const size_t length = sizeof(REQUEST) - 1;
+  HttpParser parser;
+
+  size_t before = allocations;
+  auto start = std::chrono::steady_clock::now();
+  for (long n = 0; n < iterations; n++) {
+    parser.reset();
+    for (size_t offset = 0; offset < length; offset += chunk) {
+      size_t piece = (length - offset < chunk) ? length - offset : chunk;
+      if (parser.feed(REQUEST + offset, piece) != HttpParser::NEED_MORE) break;
+    }
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  size_t mallocs = allocations - before;
+
+  std::printf("%-12s %10.1f MB/s %12.0f req/s %8.1f ns/req %6.2f mallocs/req\n", label,
+              length * iterations / seconds / 1e6, iterations / seconds,
+              seconds * 1e9 / iterations, (double)mallocs / iterations);
+}
+
+int main() {
+  const long iterations = 2000000;
+  std::printf("request head: %zu bytes, %ld iterations\n", sizeof(REQUEST) - 1, iterations);
+  run("whole", sizeof(REQUEST), iterations);
+  run("536B chunks", 536, iterations);
+  run("64B chunks", 64, iterations);
+  run("1B chunks", 1, iterations / 4);
+  return 0;
+}
@@ -0,0 +1,137 @@
+// Host-side benchmark: streaming PredictionParser vs. the original
+// String/indexOf/substring extraction from getPredictions().
+//
+// The legacy path is reproduced with std::string, which like the ESP32
+// Arduino String keeps short strings inline and heap-allocates longer ones.
+// Reports time and heap allocations per response, for the reply as Flask
+// sends it and formatted differently. test/test_prediction_parser checks
+// the values the streaming parser extracts.
+//
+// Build and run from Weather/:
+//   g++ -O2 -std=c++17 -Ilib/Uplink bench/prediction_parse_bench.cpp lib/Uplink/PredictionParser.cpp -o prediction_parse_bench
+//   ./prediction_parse_bench
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+
+#include "PredictionParser.h"
+
+extern "C" void *__libc_malloc(size_t size);
+
+static size_t allocations = 0;
+
+extern "C" void *malloc(size_t size) {
+  allocations++;
+  return __libc_malloc(size);
+}
+
+void *operator new(size_t size) {
+  allocations++;
+  void *p = __libc_malloc(size);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+struct Values {
+  float temperature, humidity, aqi;
+};
+
+static std::string trimmed(const std::string &s) {
+  size_t begin = s.find_first_not_of(" \t\r\n");
+  size_t end = s.find_last_not_of(" \t\r\n");
+  return begin == std::string::npos ? std::string() : s.substr(begin, end - begin + 1);
+}
+
+// Mirrors the original firmware code step for step
+static bool legacyParse(const char *body, Values &out) {
+  std::string response = body;  // http.getString()
+  size_t predStart = response.find("\"next_day_predictions\":");
+  if (predStart == std::string::npos) return false;
+  std::string predSection = response.substr(predStart);
+
+  size_t aqiIndex = predSection.find("\"aqi\":");
+  size_t humidityIndex = predSection.find("\"humidity\":");
+  size_t temperatureIndex = predSection.find("\"temperature\":");
+  if (aqiIndex == std::string::npos || humidityIndex == std::string::npos ||
+      temperatureIndex == std::string::npos) {
+    return false;
+  }
+
+  size_t aqiStart = aqiIndex + 6;
+  size_t aqiEnd = predSection.find(",", aqiStart);
+  if (aqiEnd == std::string::npos) aqiEnd = predSection.find("}", aqiStart);
+  std::string aqiStr = trimmed(predSection.substr(aqiStart, aqiEnd - aqiStart));
+  out.aqi = atof(aqiStr.c_str());
+
+  size_t humStart = humidityIndex + 11;
+  size_t humEnd = predSection.find(",", humStart);
+  if (humEnd == std::string::npos) humEnd = predSection.find("}", humStart);
+  std::string humStr = trimmed(predSection.substr(humStart, humEnd - humStart));
+  out.humidity = atof(humStr.c_str());
+
+  size_t tempStart = temperatureIndex + 14;
+  size_t tempEnd = predSection.find("}", tempStart);
+  if (tempEnd == std::string::npos) tempEnd = predSection.find(",", tempStart);
+  std::string tempStr = trimmed(predSection.substr(tempStart, tempEnd - tempStart));
+  out.temperature = atof(tempStr.c_str());
+  return true;
+}
+
+static bool streamingParse(const char *body, size_t chunk, Values &out) {
+  static PredictionParser parser;
+  parser.reset();
+  size_t length = strlen(body);
+  for (size_t offset = 0; offset < length; offset += chunk) {
+    size_t piece = (length - offset < chunk) ? length - offset : chunk;
+    parser.feed(body + offset, piece);
+  }
+  if (!parser.complete()) return false;
+  out.temperature = parser.result().temperature;
+  out.humidity = parser.result().humidity;
+  out.aqi = parser.result().aqi;
+  return true;
+}
+
+template <typename Parse>
+static void run(const char *label, const char *body, Parse parse) {
+  const long iterations = 1000000;
+  Values values = {0, 0, 0};
+
+  size_t before = allocations;
+  auto start = std::chrono::steady_clock::now();
+  for (long n = 0; n < iterations; n++) {
+    parse(body, values);
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::printf("  %-22s %8.1f ns/response %6.2f mallocs/response\n", label, seconds * 1e9 / iterations,
+              (double)(allocations - before) / iterations);
+}
+
+int main() {
+  const char *bodies[][2] = {
+      {"flask jsonify", "{\"next_day_predictions\":{\"aqi\":104.18,\"humidity\":73.21,\"temperature\":31.71}}\n"},
+      {"pretty-printed",
+       "{\n  \"next_day_predictions\" : {\n    \"aqi\" : 104.18,\n    \"humidity\" : 73.21,\n"
+       "    \"temperature\" : 31.71\n  }\n}\n"},
+      {"reordered + extra",
+       "{\"model\":{\"temperature\":1,\"trees\":200},\"next_day_predictions\":"
+       "{\"temperature\":31.71,\"humidity\":73.21,\"aqi\":104.18,\"label\":\"Clear\"}}"},
+  };
+
+  for (auto &body : bodies) {
+    std::printf("%s (%zu bytes)\n", body[0], strlen(body[1]));
+    run("legacy String", body[1], legacyParse);
+    run("streaming, whole", body[1], [](const char *b, Values &v) { return streamingParse(b, 4096, v); });
+    run("streaming, 16B chunks", body[1], [](const char *b, Values &v) { return streamingParse(b, 16, v); });
+  }
+  std::printf("sizeof(PredictionParser) = %zu bytes\n", sizeof(PredictionParser));
+  return 0;
+}
@@ -0,0 +1,149 @@
+// Host-side benchmark for the offline SampleLog on simulated NOR flash.
+//
+// Uses the size of the "samplelog" partition from partitions.csv and
+// reports:
+//   - capacity in samples and hours at the 2 s sample interval, for a
+//     noisy synthetic series in SeriesCodec blocks, against one 16-byte
+//     slot per sample as the log stored them before
+//   - write amplification over repeated outage / replay cycles, as flash
+//     bytes programmed and erased per record
+//   - wear spread, as min/max erase cycles per sector, including restarts
+//
+// Correctness (delivery order, wrap-around, restarts, CRC rejection) is
+// covered by test/test_sample_log.
+//
+// Build and run from Weather/:
+//   g++ -O2 -std=c++17 -Ilib/FlashLog -Ilib/Telemetry bench/sample_log_bench.cpp lib/FlashLog/SampleLog.cpp lib/Telemetry/SeriesCodec.cpp -o sample_log_bench
+//   ./sample_log_bench
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include "SampleLog.h"
+#include "SimulatedFlash.h"
+
+static const size_t PARTITION_SIZE = 0x160000;
+static const size_t REPLAY_BATCH = 120;
+
+static LogRecord sample(uint32_t seq) {
+  LogRecord record = {seq, seq * 2000, (int16_t)(2500 + seq % 300), (uint16_t)(6000 + seq % 900),
+                      (uint16_t)(1200 + seq % 400), false, 0};
+  return record;
+}
+
+// A day-long cycle with the noise of SimulatedWeather: DHT11 values in 0.1
+// steps, MQ-135 counts jumping by a few each read, and sample times
+// jittering by a few ms around the 2 s interval
+static LogRecord noisy(uint32_t seq) {
+  static uint32_t state = 1;
+  auto noise = [](float scale) {
+    float sum = 0;
+    for (int i = 0; i < 3; i++) {
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+      sum += (state & 0xffff) / 65535.0f - 0.5f;
+    }
+    return sum * 2 * scale;
+  };
+  float day = seq * 2 / 86400.0f * 6.2831853f;
+  float temperature = roundf((30.0f + 4.5f * cosf(day) + noise(0.5f)) * 10) / 10;
+  float humidity = roundf((72.0f + 15.0f * cosf(day - 1.0f) + noise(2.0f)) * 10) / 10;
+  float raw = 100.0f + 15.0f * sinf(day - 2.0f) + noise(5.0f);
+  LogRecord record = {seq, seq * 2000 + (uint32_t)(noise(3.0f) + 3), (int16_t)lroundf(temperature * 100),
+                      (uint16_t)lroundf(humidity * 100), (uint16_t)raw, false, 0};
+  return record;
+}
+
+// Appends records [from, to) in blocks, as spillToFlash() does
+static void appendRange(SampleLog &log, uint32_t from, uint32_t to, LogRecord (*make)(uint32_t) = sample) {
+  LogRecord block[SampleLog::MAX_BLOCK];
+  while (from < to) {
+    size_t count = std::min<size_t>(to - from, SampleLog::MAX_BLOCK);
+    for (size_t i = 0; i < count; i++) block[i] = make(from + i);
+    log.append(block, count);
+    from += count;
+  }
+}
+
+static void capacity() {
+  SimulatedFlash flash(PARTITION_SIZE);
+  SampleLog log(flash);
+  log.begin();
+  uint32_t seq = 0;
+  while (log.dropped() == 0) {
+    appendRange(log, seq, seq + SampleLog::MAX_BLOCK, noisy);
+    seq += SampleLog::MAX_BLOCK;
+  }
+  size_t stored = log.size();
+  size_t uncompressed = log.capacity();
+  std::printf("capacity: %zu samples (%.1f days at 2 s, %.2f bytes each), %zu at one slot per sample "
+              "(%.1f days): %.2fx\n",
+              stored, stored * 2.0 / 86400, (double)log.capacity() * SampleLog::SLOT_SIZE / stored, uncompressed,
+              uncompressed * 2.0 / 86400, (double)stored / uncompressed);
+}
+
+// Outages of varying length, each followed by draining the backlog in
+// REPLAY_BATCH batches
+static void cycles() {
+  SimulatedFlash flash(PARTITION_SIZE);
+  SampleLog log(flash);
+  log.begin();
+
+  static LogRecord batch[REPLAY_BATCH];
+  uint32_t seq = 0, appended = 0, replayed = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int outage = 0; outage < 400; outage++) {
+    uint32_t length = 500 + (outage * 7919) % 60000;
+    appendRange(log, seq, seq + length);
+    seq += length;
+    appended += length;
+
+    while (log.size() > 0) {
+      size_t count = log.peek(batch, REPLAY_BATCH);
+      replayed += count;
+      log.consume(count, count > 0 ? batch[count - 1].seq + 1 : log.acked());
+    }
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  const std::vector<uint32_t> &erases = flash.erases();
+  uint64_t erasedBytes = 0;
+  for (uint32_t e : erases) erasedBytes += (uint64_t)e * flash.sectorSize();
+  std::printf("outage/replay cycles: %u appended, %u replayed, %u dropped, %.0f ns per append+replay\n",
+              appended, replayed, log.dropped(), seconds * 1e9 / appended);
+  std::printf("  programmed %.2f bytes/record, erased %.2f bytes/record\n",
+              (double)flash.bytesWritten() / appended, (double)erasedBytes / appended);
+  std::printf("  erase cycles per sector %u..%u, illegal writes %zu\n",
+              *std::min_element(erases.begin(), erases.end()),
+              *std::max_element(erases.begin(), erases.end()), flash.badWrites());
+}
+
+// Restarting every few hundred samples should keep spreading wear rather
+// than hammer one sector. Each boot delivers one batch, which ends part way
+// into a block.
+static void restarts() {
+  SimulatedFlash flash(PARTITION_SIZE);
+  static LogRecord batch[REPLAY_BATCH];
+  uint32_t seq = 0;
+  for (int boot = 0; boot < 500; boot++) {
+    SampleLog log(flash);
+    log.begin();
+    appendRange(log, seq, seq + 300);
+    seq += 300;
+    size_t count = log.peek(batch, REPLAY_BATCH);
+    log.consume(count, batch[count - 1].seq + 1);
+  }
+  const std::vector<uint32_t> &erases = flash.erases();
+  std::printf("500 restarts: erase cycles per sector %u..%u\n", *std::min_element(erases.begin(), erases.end()),
+              *std::max_element(erases.begin(), erases.end()));
+}
+
+int main() {
+  capacity();
+  cycles();
+  restarts();
+  return 0;
+}
@@ -0,0 +1,132 @@
+// Host-side benchmark: SeriesCodec compression on the recorded series in
+// sensor_data.csv.
+//
+// Replays every row as a telemetry record (ms since the first row, values in
+// 0.01 units, AQI as the raw field), compresses the series in blocks of
+// several sizes and reports bytes per sample against the fixed 10-byte
+// packing and the plain telemetry records, plus encode/decode throughput.
+// The round trip itself is checked by test/test_telemetry.
+//
+// Build and run from Weather/:
+//   g++ -O2 -std=c++17 -Ilib/Telemetry bench/series_codec_bench.cpp lib/Telemetry/Telemetry.cpp lib/Telemetry/SeriesCodec.cpp -o series_codec_bench
+//   ./series_codec_bench ../sensor_data.csv
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "SeriesCodec.h"
+#include "Telemetry.h"
+
+// Days since 1970-01-01 for a proleptic Gregorian date
+static long daysFromCivil(long year, long month, long day) {
+  year -= month <= 2;
+  long era = (year >= 0 ? year : year - 399) / 400;
+  long yoe = year - era * 400;
+  long doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + doe - 719468;
+}
+
+static bool loadCsv(const char *path, std::vector<TelemetryRecord> &records) {
+  FILE *file = fopen(path, "r");
+  if (!file) return false;
+
+  char line[256];
+  long firstMinute = -1;
+  if (!fgets(line, sizeof(line), file)) return false;  // header
+  while (fgets(line, sizeof(line), file)) {
+    int day, month, year, hour, minute, aqi;
+    float temperature, humidity;
+    if (sscanf(line, "%d-%d-%d %d:%d,%f,%f,%d", &day, &month, &year, &hour, &minute, &temperature,
+               &humidity, &aqi) != 8) {
+      continue;
+    }
+    long minutes = daysFromCivil(year, month, day) * 1440 + hour * 60 + minute;
+    if (firstMinute < 0) firstMinute = minutes;
+    records.push_back(telemetryRecord((uint32_t)(minutes - firstMinute) * 60000, temperature, humidity, aqi));
+  }
+  fclose(file);
+  return !records.empty();
+}
+
+int main(int argc, char **argv) {
+  const char *path = argc > 1 ? argv[1] : "../sensor_data.csv";
+  std::vector<TelemetryRecord> records;
+  if (!loadCsv(path, records)) {
+    fprintf(stderr, "cannot read %s\n", path);
+    return 1;
+  }
+  size_t total = records.size();
+
+  // Plain telemetry records for comparison, as one message
+  std::vector<uint8_t> plain(TELEMETRY_HEADER_SIZE + total * TELEMETRY_MAX_RECORD_SIZE);
+  TelemetryEncoder plainEncoder(plain.data(), plain.size(), 0, 0);
+  for (const TelemetryRecord &record : records) plainEncoder.add(record);
+  double plainBytes = plainEncoder.finish() - TELEMETRY_HEADER_SIZE;
+
+  printf("%s: %zu samples\n", path, total);
+  printf("  %-16s %6.2f bytes/sample\n", "packed fields", 10.0);
+  printf("  %-16s %6.2f bytes/sample  %4.2fx\n", "plain records", plainBytes / total, 10.0 * total / plainBytes);
+
+  const size_t blockSizes[] = {30, 120, 1024, total};
+  for (size_t block : blockSizes) {
+    std::vector<uint8_t> buffer(block * TELEMETRY_MAX_RECORD_SIZE);
+    std::vector<uint8_t> encoded;
+    std::vector<size_t> blockBytes;
+
+    const int rounds = 200;
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+      encoded.clear();
+      blockBytes.clear();
+      for (size_t first = 0; first < total; first += block) {
+        SeriesEncoder encoder(buffer.data(), buffer.size());
+        for (size_t i = first; i < total && i < first + block; i++) encoder.add(records[i]);
+        encoded.insert(encoded.end(), buffer.begin(), buffer.begin() + encoder.bytes());
+        blockBytes.push_back(encoder.bytes());
+      }
+    }
+    double encodeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    uint32_t checksum = 0;
+    start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+      size_t offset = 0, index = 0;
+      for (size_t size : blockBytes) {
+        SeriesDecoder decoder;
+        decoder.begin(encoded.data() + offset, size);
+        TelemetryRecord record;
+        for (size_t i = 0; i < block && index < total; i++, index++) {
+          if (decoder.next(record)) checksum += record.time + record.mq135Raw;
+        }
+        offset += size;
+      }
+    }
+    double decodeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    double bytes = encoded.size();
+    char label[32];
+    snprintf(label, sizeof(label), "blocks of %zu", block);
+    printf("  %-16s %6.2f bytes/sample  %4.2fx  encode %5.1f ns/sample  decode %5.1f ns/sample\n", label,
+           bytes / total, 10.0 * total / bytes, encodeSeconds * 1e9 / (rounds * total),
+           decodeSeconds * 1e9 / (rounds * total));
+    if (checksum == 12345) printf(" ");  // keeps the decode loop from being optimized away
+  }
+
+  // A steady 2 s DHT11 series: whole-degree / whole-percent readings, as on the device
+  std::vector<uint8_t> buffer(total * TELEMETRY_MAX_RECORD_SIZE);
+  SeriesEncoder encoder(buffer.data(), buffer.size());
+  for (size_t i = 0; i < total; i++) {
+    TelemetryRecord record = records[i / 150];
+    record.time = i * 2000;
+    record.temperatureCenti = lround(record.temperatureCenti / 100.0) * 100;
+    record.humidityCenti = lround(record.humidityCenti / 100.0) * 100;
+    encoder.add(record);
+  }
+  printf("2 s DHT11-resolution series: %.2f bytes/sample, %.2fx\n", (double)encoder.bytes() / total,
+         10.0 * total / encoder.bytes());
+  return 0;
+}
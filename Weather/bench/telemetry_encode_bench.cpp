@@ -0,0 +1,104 @@
+// Host-side benchmark: binary telemetry encoding, plain and compressed, vs.
+// the snprintf JSON batch the uplink used to send.
+//
+// Encodes a full 30-sample batch each way and reports time, payload size
+// and heap allocations per batch. test/test_telemetry checks that both
+// binary encodings round-trip.
+//
+// Build and run from Weather/:
+//   g++ -O2 -std=c++17 -Ilib/Telemetry bench/telemetry_encode_bench.cpp lib/Telemetry/Telemetry.cpp lib/Telemetry/SeriesCodec.cpp -o telemetry_encode_bench
+//   ./telemetry_encode_bench
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "Telemetry.h"
+
+extern "C" void *__libc_malloc(size_t size);
+
+static size_t allocations = 0;
+
+extern "C" void *malloc(size_t size) {
+  allocations++;
+  return __libc_malloc(size);
+}
+
+void *operator new(size_t size) {
+  allocations++;
+  void *p = __libc_malloc(size);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+struct Sample {
+  unsigned long takenAt;
+  float temperature;
+  float humidity;
+  int mq135Raw;
+};
+
+static const size_t BATCH = 30;
+static Sample samples[BATCH];
+
+// Mirrors the previous sendBatch() formatting
+static size_t encodeJson(char *buffer, size_t capacity, unsigned long now) {
+  size_t length = snprintf(buffer, capacity, "{\"now\":%lu,\"samples\":[", now);
+  for (size_t i = 0; i < BATCH; i++) {
+    const Sample &sample = samples[i];
+    length += snprintf(buffer + length, capacity - length, "%s[%lu,%.2f,%.2f,%d]", i == 0 ? "" : ",",
+                       sample.takenAt, sample.temperature, sample.humidity, sample.mq135Raw);
+  }
+  length += snprintf(buffer + length, capacity - length, "]}");
+  return length;
+}
+
+static size_t encodeBinary(uint8_t *buffer, size_t capacity, unsigned long now, bool compressed) {
+  TelemetryEncoder encoder(buffer, capacity, 1000, now, compressed);
+  for (size_t i = 0; i < BATCH; i++) {
+    const Sample &sample = samples[i];
+    encoder.add(telemetryRecord(sample.takenAt, sample.temperature, sample.humidity, sample.mq135Raw));
+  }
+  return encoder.finish();
+}
+
+template <typename Encode>
+static size_t run(const char *label, Encode encode) {
+  const long iterations = 200000;
+  size_t length = encode(0);
+
+  size_t before = allocations;
+  auto start = std::chrono::steady_clock::now();
+  for (long n = 0; n < iterations; n++) {
+    length = encode(n);
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::printf("  %-10s %8.1f ns/batch %6zu bytes %6.2f mallocs/batch\n", label, seconds * 1e9 / iterations,
+              length, (double)(allocations - before) / iterations);
+  return length;
+}
+
+int main() {
+  for (size_t i = 0; i < BATCH; i++) {
+    samples[i].takenAt = 3600000 + i * 2000 + (i % 3);
+    samples[i].temperature = 28.0f + 3.0f * std::sin(i * 0.1f) + 0.01f * (i % 7);
+    samples[i].humidity = 70.0f + 5.0f * std::cos(i * 0.1f);
+    samples[i].mq135Raw = 1500 + (int)(i * 37 % 200);
+  }
+
+  static char json[BATCH * 40 + 64];
+  static uint8_t binary[2][TELEMETRY_HEADER_SIZE + BATCH * TELEMETRY_MAX_RECORD_SIZE];
+  volatile unsigned long now = 3700000;
+
+  std::printf("%zu-sample batch\n", BATCH);
+  run("json", [&](long) { return encodeJson(json, sizeof(json), now); });
+  run("binary", [&](long) { return encodeBinary(binary[0], sizeof(binary[0]), now, false); });
+  run("compressed", [&](long) { return encodeBinary(binary[1], sizeof(binary[1]), now, true); });
+  return 0;
+}
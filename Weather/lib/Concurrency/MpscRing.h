@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// Fixed-capacity multi-producer / single-consumer queue (Vyukov's bounded
+// queue with one reader).
+//
+// Any task may claim a slot, fill it in place and publish it; the consumer
+// takes slots in claim order once they are published. Producers only
+// contend on one compare-and-swap and never wait for the consumer: when the
+// queue is full the item is dropped and counted. A producer that claimed a
+// slot but has not published it yet holds up the consumer, not the other
+// producers.
+template <typename T, size_t N>
+class MpscRing {
+  static_assert((N & (N - 1)) == 0, "MpscRing capacity must be a power of two");
+
+public:
+  MpscRing() : head_(0), tail_(0), dropped_(0) {
+    for (uint32_t i = 0; i < N; i++) slots_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  // Producer side: reserves the next slot for item(ticket) and returns
+  // false when the queue is full
+  bool claim(uint32_t &ticket) {
+    uint32_t head = head_.load(std::memory_order_relaxed);
+    for (;;) {
+      Slot &slot = slots_[head & (N - 1)];
+      int32_t lag = (int32_t)(slot.sequence.load(std::memory_order_acquire) - head);
+      if (lag == 0) {
+        if (head_.compare_exchange_weak(head, head + 1, std::memory_order_relaxed)) {
+          ticket = head;
+          return true;
+        }
+      } else if (lag < 0) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      } else {
+        head = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  T &item(uint32_t ticket) { return slots_[ticket & (N - 1)].item; }
+
+  void publish(uint32_t ticket) {
+    slots_[ticket & (N - 1)].sequence.store(ticket + 1, std::memory_order_release);
+  }
+
+  // Consumer side: the oldest item, or NULL while it is not published yet
+  const T *front() const {
+    uint32_t tail = tail_.load(std::memory_order_relaxed);
+    const Slot &slot = slots_[tail & (N - 1)];
+    return slot.sequence.load(std::memory_order_acquire) == tail + 1 ? &slot.item : NULL;
+  }
+
+  void pop() {
+    uint32_t tail = tail_.load(std::memory_order_relaxed);
+    slots_[tail & (N - 1)].sequence.store(tail + N, std::memory_order_release);
+    tail_.store(tail + 1, std::memory_order_relaxed);
+  }
+
+  static size_t capacity() { return N; }
+  uint32_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+  struct Slot {
+    std::atomic<uint32_t> sequence;
+    T item;
+  };
+
+  std::atomic<uint32_t> head_;
+  std::atomic<uint32_t> tail_;
+  std::atomic<uint32_t> dropped_;
+  Slot slots_[N];
+};
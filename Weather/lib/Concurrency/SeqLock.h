@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+#include <string.h>
+
+// Single-writer sequence lock for publishing small plain structs between
+// tasks on different cores.
+//
+// The writer bumps the sequence to odd, copies the value in and bumps it to
+// even again; it never waits. Readers copy the value out and retry if the
+// sequence was odd or changed underneath them, so they never observe a
+// half-written struct and never hold anything the writer would wait on.
+template <typename T>
+class SeqLock {
+public:
+  SeqLock() : sequence_(0) {
+    memset(&value_, 0, sizeof(T));
+  }
+
+  explicit SeqLock(const T &initial) : sequence_(0) {
+    memcpy(&value_, &initial, sizeof(T));
+  }
+
+  // Only one task may call store() for a given SeqLock.
+  void store(const T &value) {
+    uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(&value_, &value, sizeof(T));
+    sequence_.store(sequence + 2, std::memory_order_release);
+  }
+
+  T load() const {
+    T copy;
+    uint32_t before, after;
+    do {
+      before = sequence_.load(std::memory_order_acquire);
+      memcpy(&copy, &value_, sizeof(T));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      after = sequence_.load(std::memory_order_relaxed);
+    } while ((before & 1) != 0 || before != after);
+    return copy;
+  }
+
+  // Even number that advances by 2 on every store; lets readers cheaply tell
+  // whether anything new has been published since they last looked.
+  uint32_t version() const {
+    return sequence_.load(std::memory_order_acquire) & ~1u;
+  }
+
+private:
+  std::atomic<uint32_t> sequence_;
+  T value_;
+};
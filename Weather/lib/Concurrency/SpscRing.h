@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// Fixed-capacity single-producer / single-consumer queue.
+//
+// One task pushes, another peeks and pops, and neither ever waits on the
+// other. The consumer can look at a run of items, try to send them, and only
+// pop them once they were delivered. When the queue is full new items are
+// dropped and counted rather than overwriting ones the consumer may be
+// reading.
+template <typename T, size_t N>
+class SpscRing {
+  static_assert((N & (N - 1)) == 0, "SpscRing capacity must be a power of two");
+
+public:
+  SpscRing() : head_(0), tail_(0), dropped_(0) {}
+
+  // Producer side
+  bool push(const T &item) {
+    uint32_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) >= N) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    items_[head & (N - 1)] = item;
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side
+  size_t size() const {
+    return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_relaxed);
+  }
+
+  // i-th oldest item; i must be below size()
+  const T &peek(size_t i) const {
+    return items_[(tail_.load(std::memory_order_relaxed) + i) & (N - 1)];
+  }
+
+  void pop(size_t count) {
+    tail_.store(tail_.load(std::memory_order_relaxed) + count, std::memory_order_release);
+  }
+
+  static size_t capacity() { return N; }
+  uint32_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+  std::atomic<uint32_t> head_;
+  std::atomic<uint32_t> tail_;
+  std::atomic<uint32_t> dropped_;
+  T items_[N];
+};
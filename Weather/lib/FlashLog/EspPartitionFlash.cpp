@@ -0,0 +1,27 @@
+#include "EspPartitionFlash.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+bool EspPartitionFlash::begin(const char *label) {
+  partition_ = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+  return partition_ != NULL;
+}
+
+size_t EspPartitionFlash::size() const {
+  return partition_ ? partition_->size : 0;
+}
+
+bool EspPartitionFlash::read(size_t offset, void *data, size_t length) {
+  return partition_ && esp_partition_read(partition_, offset, data, length) == ESP_OK;
+}
+
+bool EspPartitionFlash::write(size_t offset, const void *data, size_t length) {
+  return partition_ && esp_partition_write(partition_, offset, data, length) == ESP_OK;
+}
+
+bool EspPartitionFlash::eraseSector(size_t sector) {
+  return partition_ &&
+         esp_partition_erase_range(partition_, sector * SPI_FLASH_SEC_SIZE, SPI_FLASH_SEC_SIZE) == ESP_OK;
+}
+
+#endif
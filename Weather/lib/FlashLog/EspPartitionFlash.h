@@ -0,0 +1,26 @@
+#pragma once
+
+#include "FlashBackend.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include <esp_partition.h>
+
+// FlashBackend on a raw data partition from partitions.csv.
+class EspPartitionFlash : public FlashBackend {
+public:
+  EspPartitionFlash() : partition_(NULL) {}
+
+  // Looks the partition up by label; false if the partition table lacks it
+  bool begin(const char *label);
+
+  size_t size() const override;
+  size_t sectorSize() const override { return SPI_FLASH_SEC_SIZE; }
+
+  bool read(size_t offset, void *data, size_t length) override;
+  bool write(size_t offset, const void *data, size_t length) override;
+  bool eraseSector(size_t sector) override;
+
+private:
+  const esp_partition_t *partition_;
+};
+#endif
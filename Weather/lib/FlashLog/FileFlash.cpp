@@ -0,0 +1,53 @@
+#include "FileFlash.h"
+
+#if !defined(ARDUINO_ARCH_ESP32)
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "Hal.h"
+
+FileFlash::~FileFlash() {
+  if (file_) fclose(file_);
+}
+
+bool FileFlash::begin(const char *label) {
+  std::string path = nativeStatePath((std::string(label) + ".bin").c_str());
+  file_ = fopen(path.c_str(), "r+b");
+  if (!file_) file_ = fopen(path.c_str(), "w+b");
+  if (!file_) return false;
+
+  fseek(file_, 0, SEEK_END);
+  long length = ftell(file_);
+  if (length < 0 || (size_t)length < size_) {
+    std::vector<uint8_t> erased(size_ - (length < 0 ? 0 : length), 0xff);
+    if (fwrite(erased.data(), 1, erased.size(), file_) != erased.size()) return false;
+    fflush(file_);
+  }
+  return true;
+}
+
+bool FileFlash::read(size_t offset, void *data, size_t length) {
+  if (!file_ || offset + length > size_) return false;
+  return fseek(file_, offset, SEEK_SET) == 0 && fread(data, 1, length, file_) == length;
+}
+
+bool FileFlash::write(size_t offset, const void *data, size_t length) {
+  std::vector<uint8_t> current(length);
+  if (!read(offset, current.data(), length)) return false;
+  const uint8_t *bytes = (const uint8_t *)data;
+  for (size_t i = 0; i < length; i++) current[i] &= bytes[i];
+  if (fseek(file_, offset, SEEK_SET) != 0 || fwrite(current.data(), 1, length, file_) != length) return false;
+  return fflush(file_) == 0;
+}
+
+bool FileFlash::eraseSector(size_t sector) {
+  if (!file_ || (sector + 1) * sectorSize_ > size_) return false;
+  std::vector<uint8_t> erased(sectorSize_, 0xff);
+  if (fseek(file_, sector * sectorSize_, SEEK_SET) != 0) return false;
+  if (fwrite(erased.data(), 1, sectorSize_, file_) != sectorSize_) return false;
+  return fflush(file_) == 0;
+}
+
+#endif
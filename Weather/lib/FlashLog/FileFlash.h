@@ -0,0 +1,32 @@
+#pragma once
+
+#include "FlashBackend.h"
+
+#if !defined(ARDUINO_ARCH_ESP32)
+#include <stdio.h>
+
+// FlashBackend in a file for the native build, standing in for a raw data
+// partition. Keeps NOR semantics, erased bytes read 0xff and writes only
+// clear bits, so the log behaves as on the device and survives restarts.
+class FileFlash : public FlashBackend {
+public:
+  explicit FileFlash(size_t size, size_t sectorSize = 4096)
+      : file_(NULL), size_(size), sectorSize_(sectorSize) {}
+  ~FileFlash() override;
+
+  // Opens <state dir>/<label>.bin, creating it erased if needed
+  bool begin(const char *label);
+
+  size_t size() const override { return file_ ? size_ : 0; }
+  size_t sectorSize() const override { return sectorSize_; }
+
+  bool read(size_t offset, void *data, size_t length) override;
+  bool write(size_t offset, const void *data, size_t length) override;
+  bool eraseSector(size_t sector) override;
+
+private:
+  FILE *file_;
+  size_t size_;
+  size_t sectorSize_;
+};
+#endif
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Raw NOR flash region as seen by SampleLog. Erasing a sector sets every
+// byte to 0xff; writes can only clear bits, so a byte is written once
+// between erases. Offsets are relative to the start of the region.
+class FlashBackend {
+public:
+  virtual ~FlashBackend() {}
+
+  virtual size_t size() const = 0;
+  virtual size_t sectorSize() const = 0;
+
+  virtual bool read(size_t offset, void *data, size_t length) = 0;
+  virtual bool write(size_t offset, const void *data, size_t length) = 0;
+  virtual bool eraseSector(size_t sector) = 0;
+};
@@ -0,0 +1,430 @@
+#include "SampleLog.h"
+
+#include <string.h>
+
+#include "SeriesCodec.h"
+#include "Telemetry.h"
+
+static const uint32_t SECTOR_MAGIC = 0x33474c53;  // "SLG3"; earlier layouts held one record per slot
+
+// Entry header slot, CRC-16 of bytes 0..13 in 14..15:
+//   block   u32 first seq, u8 count, u8 payload slots, u16 payload CRC-16
+//   marker  u32 MARKER_SEQ, u32 kind, u32 value
+static const uint32_t MARKER_SEQ = 0xffffffff;
+static const uint32_t MARKER_ACK = 1;    // value: sequence number after the last delivered record
+static const uint32_t MARKER_CLOCK = 2;  // value: wall-clock time (s) at millis() 0 of the sector's boot
+
+// CRC-16/CCITT-FALSE
+static uint16_t crc16(const uint8_t *data, size_t length) {
+  uint16_t crc = 0xffff;
+  for (size_t i = 0; i < length; i++) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+static void putU16(uint8_t *p, uint16_t v) {
+  p[0] = v & 0xff;
+  p[1] = v >> 8;
+}
+
+static void putU32(uint8_t *p, uint32_t v) {
+  p[0] = v & 0xff;
+  p[1] = (v >> 8) & 0xff;
+  p[2] = (v >> 16) & 0xff;
+  p[3] = v >> 24;
+}
+
+static uint16_t getU16(const uint8_t *p) {
+  return p[0] | (p[1] << 8);
+}
+
+static uint32_t getU32(const uint8_t *p) {
+  return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+SampleLog::SampleLog(FlashBackend &flash)
+    : flash_(flash), ready_(false), sectors_(0), slotsPerSector_(0), generation_(0), firstSector_(0),
+      head_(0), tail_(0), tailSkip_(0), pending_(0), dropped_(0), nextSeq_(0), acked_(0), boot_(0),
+      bootEpoch_(0), sectorOpen_(false), clockCount_(0), runStart_(0), runLength_(0) {
+}
+
+static void encodeMarker(uint8_t *encoded, uint32_t kind, uint32_t value) {
+  memset(encoded, 0xff, SampleLog::SLOT_SIZE);
+  putU32(encoded, MARKER_SEQ);
+  putU32(encoded + 4, kind);
+  putU32(encoded + 8, value);
+  putU16(encoded + 14, crc16(encoded, 14));
+}
+
+bool SampleLog::begin() {
+  ready_ = false;
+  size_t sectorSize = flash_.sectorSize();
+  sectors_ = flash_.size() / sectorSize;
+  slotsPerSector_ = (sectorSize - HEADER_SIZE) / SLOT_SIZE;
+  if (sectors_ < 2 || slotsPerSector_ < 2 + MAX_PAYLOAD_SLOTS) return false;
+
+  // The sector with the newest generation is where the last boot stopped
+  bool found = false;
+  uint32_t newest = 0;
+  uint32_t newestSector = 0;
+  for (uint32_t sector = 0; sector < sectors_; sector++) {
+    uint32_t generation, boot;
+    if (!readHeader(sector, generation, boot)) continue;
+    if (!found || (int32_t)(generation - newest) > 0) {
+      found = true;
+      newest = generation;
+      newestSector = sector;
+    }
+  }
+
+  // The sectors before it are live as long as the generations count down
+  // without a gap; a gap is a sector erased but never rewritten, or the
+  // oldest one, about to be reused
+  uint32_t live = found ? 1 : 0;
+  while (found && live < sectors_) {
+    uint32_t generation, boot;
+    uint32_t sector = (newestSector + sectors_ - live) % sectors_;
+    if (!readHeader(sector, generation, boot) || generation != newest - live) break;
+    live++;
+  }
+
+  // This boot starts in a fresh sector after them
+  generation_ = found ? newest + 1 : 0;
+  firstSector_ = found ? (newestSector + 1 + sectors_ - live) % sectors_ : 0;
+  head_ = tail_ = live * slotsPerSector_;
+  tailSkip_ = 0;
+  pending_ = 0;
+  dropped_ = 0;
+  boot_ = generation_;
+  bootEpoch_ = 0;
+  sectorOpen_ = false;
+  clockCount_ = 0;
+  runLength_ = 0;
+
+  // The newest acknowledgement says which records were delivered; each
+  // boot's clock markers date its records
+  bool acked = false;
+  bool logged = false;
+  uint32_t lastSeq = 0;
+  uint32_t boot = 0;
+  acked_ = 0;
+  for (uint32_t slot = 0; slot < head_;) {
+    Entry entry;
+    if (slot % slotsPerSector_ == 0 && !sectorBoot(slot, boot)) return false;
+    if (!readEntry(slot, entry, true)) {
+      slot++;
+      continue;
+    }
+    if (entry.count > 0) {
+      logged = true;
+      lastSeq = entry.seq + entry.count - 1;
+    } else if (entry.kind == MARKER_ACK) {
+      acked = true;
+      acked_ = entry.value;
+    } else if (entry.kind == MARKER_CLOCK) {
+      rememberClock(boot, entry.value);
+    }
+    slot += entry.slots;
+  }
+  nextSeq_ = logged ? lastSeq + 1 : acked_;
+  if ((int32_t)(acked_ - nextSeq_) > 0) nextSeq_ = acked_;
+
+  // Delivery resumes at the oldest record not acknowledged, which may be
+  // part way into a block
+  bool resumed = false;
+  for (uint32_t slot = 0; logged && slot < head_;) {
+    Entry entry;
+    if (!readEntry(slot, entry, true)) {
+      slot++;
+      continue;
+    }
+    uint32_t last = entry.seq + entry.count - 1;
+    if (entry.count > 0 && (!acked || (int32_t)(last - acked_) >= 0)) {
+      if (!resumed) {
+        resumed = true;
+        tail_ = slot;
+        tailSkip_ = acked && (int32_t)(acked_ - entry.seq) > 0 ? acked_ - entry.seq : 0;
+      }
+      pending_ += entry.count - (slot == tail_ ? tailSkip_ : 0);
+    }
+    slot += entry.slots;
+  }
+
+  ready_ = true;
+  return true;
+}
+
+bool SampleLog::readHeader(uint32_t sector, uint32_t &generation, uint32_t &boot) {
+  uint8_t header[HEADER_SIZE];
+  if (!flash_.read(sector * flash_.sectorSize(), header, sizeof(header))) return false;
+  if (getU32(header) != SECTOR_MAGIC || getU16(header + 12) != crc16(header, 12)) return false;
+  generation = getU32(header + 4);
+  boot = getU32(header + 8);
+  return true;
+}
+
+bool SampleLog::sectorBoot(uint32_t slot, uint32_t &boot) {
+  uint32_t generation;
+  return readHeader((firstSector_ + slot / slotsPerSector_) % sectors_, generation, boot);
+}
+
+bool SampleLog::readSlot(uint32_t slot, uint8_t *out) {
+  // Slots within a sector are contiguous, so read runs of them at once
+  if (slot < runStart_ || slot >= runStart_ + runLength_) {
+    uint32_t length = slotsPerSector_ - slot % slotsPerSector_;
+    if (length > RUN) length = RUN;
+    runLength_ = 0;
+    if (!flash_.read(slotOffset(slot), run_, length * SLOT_SIZE)) return false;
+    runStart_ = slot;
+    runLength_ = length;
+  }
+  memcpy(out, run_ + (slot - runStart_) * SLOT_SIZE, SLOT_SIZE);
+  return true;
+}
+
+bool SampleLog::readEntry(uint32_t slot, Entry &entry, bool payload) {
+  uint8_t header[SLOT_SIZE];
+  if (!readSlot(slot, header) || getU16(header + 14) != crc16(header, 14)) return false;
+  entry.seq = getU32(header);
+  entry.count = 0;
+  entry.slots = 1;
+  if (entry.seq == MARKER_SEQ) {
+    entry.kind = getU32(header + 4);
+    entry.value = getU32(header + 8);
+    return true;
+  }
+
+  uint32_t payloadSlots = header[5];
+  entry.count = header[4];
+  entry.slots = 1 + payloadSlots;
+  if (entry.count == 0 || entry.count > MAX_BLOCK || payloadSlots > MAX_PAYLOAD_SLOTS ||
+      slot % slotsPerSector_ + entry.slots > slotsPerSector_) {
+    return false;
+  }
+  if (!payload) return true;
+  uint8_t *data = block_ + SLOT_SIZE;
+  if (!flash_.read(slotOffset(slot + 1), data, payloadSlots * SLOT_SIZE)) return false;
+  return getU16(header + 6) == crc16(data, payloadSlots * SLOT_SIZE);
+}
+
+size_t SampleLog::decodeBlock(const Entry &entry, uint32_t boot, size_t skip, LogRecord *out, size_t max) {
+  SeriesDecoder decoder;
+  decoder.begin(block_ + SLOT_SIZE, (entry.slots - 1) * SLOT_SIZE);
+  size_t count = 0;
+  for (uint32_t i = 0; i < entry.count && count < max; i++) {
+    TelemetryRecord record;
+    if (!decoder.next(record)) break;
+    if (i < skip) continue;
+    LogRecord &logged = out[count++];
+    logged.seq = entry.seq + i;
+    logged.takenAt = record.time;
+    logged.temperatureCenti = record.temperatureCenti;
+    logged.humidityCenti = record.humidityCenti;
+    logged.mq135Raw = record.mq135Raw;
+    logged.earlierBoot = boot != boot_;
+    logged.bootEpoch = epochOf(boot);
+  }
+  return count;
+}
+
+size_t SampleLog::slotOffset(uint32_t slot) const {
+  uint32_t sector = (firstSector_ + slot / slotsPerSector_) % sectors_;
+  return sector * flash_.sectorSize() + HEADER_SIZE + (slot % slotsPerSector_) * SLOT_SIZE;
+}
+
+size_t SampleLog::countRecords(uint32_t end) {
+  size_t count = 0;
+  for (uint32_t slot = tail_; slot < end;) {
+    Entry entry;
+    if (!readEntry(slot, entry, false)) {
+      slot++;
+      continue;
+    }
+    count += entry.count - (slot == tail_ ? tailSkip_ : 0);
+    slot += entry.slots;
+  }
+  return count;
+}
+
+bool SampleLog::openSector(uint32_t sector) {
+  // Wrapping onto the sector the oldest unsent records are in drops them
+  if (sector - tail_ / slotsPerSector_ >= sectors_) {
+    uint32_t newTail = (tail_ / slotsPerSector_ + 1) * slotsPerSector_;
+    size_t lost = countRecords(newTail);
+    dropped_ += lost;
+    pending_ -= lost < pending_ ? lost : pending_;
+    tail_ = newTail;
+    tailSkip_ = 0;
+  }
+
+  uint32_t physical = (firstSector_ + sector) % sectors_;
+  runLength_ = 0;
+  if (!flash_.eraseSector(physical)) return false;
+
+  uint8_t header[HEADER_SIZE];
+  memset(header, 0xff, sizeof(header));
+  putU32(header, SECTOR_MAGIC);
+  putU32(header + 4, generation_);
+  putU32(header + 8, boot_);
+  putU16(header + 12, crc16(header, 12));
+  if (!flash_.write(physical * flash_.sectorSize(), header, sizeof(header))) return false;
+  generation_++;
+  sectorOpen_ = true;
+  return true;
+}
+
+bool SampleLog::writeEntry(const uint8_t *encoded, uint32_t slots, bool marker) {
+  if (!ready_) return false;
+  // Nothing unsent: markers need no delivery, and the tail follows the head
+  bool caughtUp = tail_ == head_;
+
+  // An entry never spans sectors; the rest of this one stays erased
+  uint32_t offset = head_ % slotsPerSector_;
+  if (offset != 0 && offset + slots > slotsPerSector_) head_ += slotsPerSector_ - offset;
+  if (caughtUp) tail_ = head_;
+
+  if (head_ % slotsPerSector_ == 0) {
+    if (!openSector(head_ / slotsPerSector_)) return false;
+    // Every sector repeats the clock, so wrapping over the first one that
+    // logged it leaves the rest datable
+    if (bootEpoch_ != 0) {
+      uint8_t clock[SLOT_SIZE];
+      encodeMarker(clock, MARKER_CLOCK, bootEpoch_);
+      if (!writeSlots(clock, 1)) return false;
+    }
+    if (caughtUp) tail_ = head_;
+  }
+
+  if (!writeSlots(encoded, slots)) return false;
+  if (caughtUp && marker) tail_ = head_;
+  return true;
+}
+
+bool SampleLog::writeSlots(const uint8_t *encoded, uint32_t slots) {
+  runLength_ = 0;
+  if (!flash_.write(slotOffset(head_), encoded, slots * SLOT_SIZE)) return false;
+  head_ += slots;
+  return true;
+}
+
+bool SampleLog::writeMarker(uint32_t kind, uint32_t value) {
+  uint8_t encoded[SLOT_SIZE];
+  encodeMarker(encoded, kind, value);
+  return writeEntry(encoded, 1, true);
+}
+
+bool SampleLog::append(const LogRecord *records, size_t count) {
+  if (count == 0 || count > MAX_BLOCK) return false;
+
+  uint8_t *payload = block_ + SLOT_SIZE;
+  SeriesEncoder encoder(payload, MAX_PAYLOAD_SLOTS * SLOT_SIZE);
+  for (size_t i = 0; i < count; i++) {
+    TelemetryRecord record = {records[i].seq, records[i].takenAt, records[i].temperatureCenti,
+                              records[i].humidityCenti, records[i].mq135Raw};
+    if (!encoder.add(record)) return false;
+  }
+  uint32_t payloadSlots = (encoder.bytes() + SLOT_SIZE - 1) / SLOT_SIZE;
+  memset(payload + encoder.bytes(), 0xff, payloadSlots * SLOT_SIZE - encoder.bytes());
+
+  memset(block_, 0xff, SLOT_SIZE);
+  putU32(block_, records[0].seq);
+  block_[4] = count;
+  block_[5] = payloadSlots;
+  putU16(block_ + 6, crc16(payload, payloadSlots * SLOT_SIZE));
+  putU16(block_ + 14, crc16(block_, 14));
+  if (!writeEntry(block_, 1 + payloadSlots, false)) return false;
+  pending_ += count;
+  nextSeq_ = records[count - 1].seq + 1;
+  return true;
+}
+
+bool SampleLog::setBootEpoch(uint32_t epoch) {
+  if (!ready_) return false;
+  if (bootEpoch_ != 0) return true;
+  bootEpoch_ = epoch;
+  // Otherwise the next sector opened carries it
+  if (!sectorOpen_ || head_ % slotsPerSector_ == 0) return true;
+  return writeMarker(MARKER_CLOCK, epoch);
+}
+
+void SampleLog::rememberClock(uint32_t boot, uint32_t epoch) {
+  for (size_t i = 0; i < clockCount_; i++) {
+    if (clocks_[i].boot == boot) {
+      clocks_[i].epoch = epoch;
+      return;
+    }
+  }
+  // The oldest boot's is forgotten first
+  if (clockCount_ == MAX_BOOTS) {
+    memmove(clocks_, clocks_ + 1, (MAX_BOOTS - 1) * sizeof(clocks_[0]));
+    clockCount_--;
+  }
+  clocks_[clockCount_].boot = boot;
+  clocks_[clockCount_].epoch = epoch;
+  clockCount_++;
+}
+
+uint32_t SampleLog::epochOf(uint32_t boot) const {
+  if (boot == boot_) return bootEpoch_;
+  for (size_t i = 0; i < clockCount_; i++) {
+    if (clocks_[i].boot == boot) return clocks_[i].epoch;
+  }
+  return 0;
+}
+
+size_t SampleLog::peek(LogRecord *out, size_t max) {
+  size_t count = 0;
+  size_t skip = tailSkip_;
+  for (uint32_t slot = tail_; slot < head_ && count < max;) {
+    Entry entry;
+    if (!readEntry(slot, entry, true)) {
+      slot++;
+      skip = 0;
+      continue;
+    }
+    uint32_t boot;
+    if (entry.count > 0) {
+      if (!sectorBoot(slot, boot)) break;
+      count += decodeBlock(entry, boot, skip, out + count, max - count);
+    }
+    skip = 0;
+    slot += entry.slots;
+  }
+  return count;
+}
+
+void SampleLog::consume(size_t count, uint32_t nextSeq) {
+  // Walks the entries as peek() did; markers and unreadable slots before,
+  // between and after the records go with them
+  while (tail_ < head_) {
+    Entry entry;
+    if (!readEntry(tail_, entry, true)) {
+      tail_++;
+      tailSkip_ = 0;
+      continue;
+    }
+    if (entry.count == 0) {
+      tail_ += entry.slots;
+      continue;
+    }
+    if (count == 0) break;
+    size_t take = entry.count - tailSkip_;
+    if (take > count) take = count;
+    count -= take;
+    tailSkip_ += take;
+    pending_ -= take < pending_ ? take : pending_;
+    if (tailSkip_ == entry.count) {
+      tail_ += entry.slots;
+      tailSkip_ = 0;
+    }
+  }
+  if (tail_ >= head_) pending_ = 0;
+
+  if (nextSeq == acked_) return;
+  acked_ = nextSeq;
+  writeMarker(MARKER_ACK, nextSeq);
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "FlashBackend.h"
+
+// One buffered sample, in the telemetry format's fixed-point units.
+struct LogRecord {
+  uint32_t seq;
+  uint32_t takenAt;           // millis() at sample time, in the boot that took it
+  int16_t temperatureCenti;
+  uint16_t humidityCenti;
+  uint16_t mq135Raw;
+  // Filled by peek(): whether an earlier boot took the sample, and the
+  // wall-clock time (s) at millis() 0 of that boot, 0 if it never had one
+  bool earlierBoot;
+  uint32_t bootEpoch;
+};
+
+// Append-only sample log on raw flash, used as a ring of sectors.
+//
+// Each sector starts with a 16-byte header carrying a generation number and
+// the boot that opened it, followed by entries made of 16-byte slots.
+// Samples are written in blocks of up to MAX_BLOCK, compressed with
+// SeriesCodec: a header slot with the first sequence number, the count and
+// two CRC-16s, then the payload. Sectors are filled in order and erased
+// only when the head comes round to them again, so every sector sees the
+// same number of erase cycles. When the log is full, the oldest sector's
+// unsent records are dropped to make room.
+//
+// Besides samples the log holds two kinds of one-slot marker, so that a
+// restart loses nothing: an acknowledgement, written by consume(), with the
+// sequence number of the oldest record not yet delivered, and the wall-clock
+// time at millis() 0 of the boot, written at the start of every sector once
+// setBootEpoch() supplies it. begin() reads them back, resumes delivery from
+// the last acknowledgement and lets peek() say when a sample from an
+// earlier boot was taken. Each boot starts writing in a fresh sector, so a
+// sector's samples share one millis() origin.
+class SampleLog {
+public:
+  static const size_t SLOT_SIZE = 16;
+  static const size_t HEADER_SIZE = 16;
+  // Records per append(); a block is decoded whole to read any of it
+  static const size_t MAX_BLOCK = 64;
+  // Earlier boots whose clocks are remembered; older ones' samples are undated
+  static const size_t MAX_BOOTS = 16;
+
+  explicit SampleLog(FlashBackend &flash);
+
+  // Finds where the previous boot stopped writing and which of its records
+  // are still unsent, reading the log through once. False if the flash
+  // region is too small to hold two sectors.
+  bool begin();
+
+  // Writes `count` records, at most MAX_BLOCK with consecutive sequence
+  // numbers, as one compressed block. Returns false if it could not be
+  // written.
+  bool append(const LogRecord *records, size_t count);
+
+  // Wall-clock time at millis() 0 of this boot, once known; logged so a later
+  // boot can date this one's samples
+  bool setBootEpoch(uint32_t epoch);
+
+  // Copies up to `max` of the oldest unsent records, skipping blocks whose
+  // CRC does not match.
+  size_t peek(LogRecord *out, size_t max);
+
+  // Drops the oldest `count` unsent records, as peek() returned them.
+  // `nextSeq` is the sequence number after the last record delivered; it is
+  // logged so a restart resumes from there.
+  void consume(size_t count, uint32_t nextSeq);
+
+  // Unsent records
+  size_t size() const { return pending_; }
+  // In slots; a block takes one plus its payload
+  size_t capacity() const { return (sectors_ - 1) * slotsPerSector_; }
+  uint32_t dropped() const { return dropped_; }
+  // Sequence number after the newest record in the log, so numbering
+  // carries on across restarts
+  uint32_t nextSeq() const { return nextSeq_; }
+  // Sequence number of the last acknowledgement
+  uint32_t acked() const { return acked_; }
+
+private:
+  static const size_t RUN = 16;  // slots read at once while walking entries
+  // A block's worst case: the first record in 10 bytes, the rest in 12
+  static const size_t MAX_PAYLOAD_SLOTS = (10 + (MAX_BLOCK - 1) * 12 + SLOT_SIZE - 1) / SLOT_SIZE;
+
+  struct Entry {
+    uint32_t seq;    // of the block's first record, or MARKER_SEQ
+    uint32_t kind;   // marker kind and value
+    uint32_t value;
+    uint32_t count;  // records in a block, 0 for a marker
+    uint32_t slots;  // including the header slot
+  };
+
+  struct BootClock {
+    uint32_t boot;
+    uint32_t epoch;
+  };
+
+  bool readHeader(uint32_t sector, uint32_t &generation, uint32_t &boot);
+  bool readSlot(uint32_t slot, uint8_t *out);
+  bool readEntry(uint32_t slot, Entry &entry, bool payload);
+  size_t decodeBlock(const Entry &entry, uint32_t boot, size_t skip, LogRecord *out, size_t max);
+  size_t slotOffset(uint32_t slot) const;
+  bool sectorBoot(uint32_t slot, uint32_t &boot);
+  bool openSector(uint32_t sector);
+  bool writeEntry(const uint8_t *encoded, uint32_t slots, bool marker);
+  bool writeSlots(const uint8_t *encoded, uint32_t slots);
+  bool writeMarker(uint32_t kind, uint32_t value);
+  size_t countRecords(uint32_t end);
+  uint32_t epochOf(uint32_t boot) const;
+  void rememberClock(uint32_t boot, uint32_t epoch);
+
+  FlashBackend &flash_;
+  bool ready_;
+  uint32_t sectors_;
+  uint32_t slotsPerSector_;
+  uint32_t generation_;   // of the next sector to open
+  uint32_t firstSector_;  // physical sector that logical sector 0 maps to
+  uint32_t head_;         // logical slot numbers; entries from tail_ to head_ are unsent
+  uint32_t tail_;
+  uint32_t tailSkip_;     // records of the block at tail_ already delivered
+  size_t pending_;
+  uint32_t dropped_;
+  uint32_t nextSeq_;
+  uint32_t acked_;        // last acknowledgement logged
+  uint32_t boot_;         // generation of this boot's first sector
+  uint32_t bootEpoch_;    // 0 until setBootEpoch()
+  bool sectorOpen_;       // this boot has opened a sector
+  BootClock clocks_[MAX_BOOTS];
+  size_t clockCount_;
+  // Slots last read while walking entries, and the block being read or written
+  uint8_t run_[RUN * SLOT_SIZE];
+  uint32_t runStart_;
+  uint32_t runLength_;
+  uint8_t block_[(1 + MAX_PAYLOAD_SLOTS) * SLOT_SIZE];
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <string.h>
+#include <vector>
+
+#include "FlashBackend.h"
+
+// NOR flash in RAM for host-side tools and benchmarks. Enforces the
+// erase-before-write rule and counts what the log costs the hardware.
+class SimulatedFlash : public FlashBackend {
+public:
+  SimulatedFlash(size_t size, size_t sectorSize = 4096)
+      : memory_(size, 0xff), sectorSize_(sectorSize), erases_(size / sectorSize, 0),
+        bytesWritten_(0), badWrites_(0) {}
+
+  size_t size() const override { return memory_.size(); }
+  size_t sectorSize() const override { return sectorSize_; }
+
+  bool read(size_t offset, void *data, size_t length) override {
+    if (offset + length > memory_.size()) return false;
+    memcpy(data, &memory_[offset], length);
+    return true;
+  }
+
+  bool write(size_t offset, const void *data, size_t length) override {
+    if (offset + length > memory_.size()) return false;
+    const uint8_t *bytes = (const uint8_t *)data;
+    for (size_t i = 0; i < length; i++) {
+      // Real flash silently ANDs; a write that needs a 0 -> 1 is a log bug
+      if ((memory_[offset + i] & bytes[i]) != bytes[i]) badWrites_++;
+      memory_[offset + i] &= bytes[i];
+    }
+    bytesWritten_ += length;
+    return true;
+  }
+
+  bool eraseSector(size_t sector) override {
+    if (sector >= erases_.size()) return false;
+    memset(&memory_[sector * sectorSize_], 0xff, sectorSize_);
+    erases_[sector]++;
+    return true;
+  }
+
+  // Simulates losing power halfway through programming `length` bytes
+  void tearWrite(size_t offset, const void *data, size_t length) {
+    write(offset, data, length / 2);
+  }
+
+  size_t bytesWritten() const { return bytesWritten_; }
+  size_t badWrites() const { return badWrites_; }
+  const std::vector<uint32_t> &erases() const { return erases_; }
+
+private:
+  std::vector<uint8_t> memory_;
+  size_t sectorSize_;
+  std::vector<uint32_t> erases_;
+  size_t bytesWritten_;
+  size_t badWrites_;
+};
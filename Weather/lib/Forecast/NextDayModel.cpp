@@ -0,0 +1,3026 @@
+// Generated by scripts/export_forest.py from forecast_model.pkl - do not edit.
+#include "NextDayModel.h"
+
+// 200 trees, 1928 nodes, 1064 leaves
+// features: temp_mean_t-1, hum_mean_t-1, aqi_mean_t-1, temp_mean_t-2, hum_mean_t-2, aqi_mean_t-2, temp_mean_t-3, hum_mean_t-3, aqi_mean_t-3
+static const ForestNode NODES[] = {
+    {30.70430564880371f, 1, 4, 3},
+    {75.26200866699219f, 2, 3, 4},
+    {0.0f, 0, 0, -1},
+    {0.0f, 1, 0, -1},
+    {103.03472137451172f, 5, 8, 2},
+    {31.070606231689453f, 6, 7, 3},
+    {0.0f, 2, 0, -1},
+    {0.0f, 3, 0, -1},
+    {0.0f, 4, 0, -1},
+    {101.03472137451172f, 10, 13, 2},
+    {74.58810424804688f, 11, 12, 1},
+    {0.0f, 5, 0, -1},
+    {0.0f, 6, 0, -1},
+    {31.628158569335938f, 14, 17, 3},
+    {101.15103912353516f, 15, 16, 8},
+    {0.0f, 7, 0, -1},
+    {0.0f, 8, 0, -1},
+    {0.0f, 9, 0, -1},
+    {30.623090744018555f, 19, 24, 6},
+    {74.65631866455078f, 20, 21, 1},
+    {0.0f, 10, 0, -1},
+    {75.82221984863281f, 22, 23, 4},
+    {0.0f, 11, 0, -1},
+    {0.0f, 12, 0, -1},
+    {73.40901184082031f, 25, 26, 4},
+    {0.0f, 13, 0, -1},
+    {0.0f, 14, 0, -1},
+    {99.20833587646484f, 28, 33, 5},
+    {75.82221984863281f, 29, 30, 7},
+    {0.0f, 15, 0, -1},
+    {76.75601959228516f, 31, 32, 7},
+    {0.0f, 16, 0, -1},
+    {0.0f, 17, 0, -1},
+    {74.25981140136719f, 34, 37, 4},
+    {31.400936126708984f, 35, 36, 6},
+    {0.0f, 18, 0, -1},
+    {0.0f, 19, 0, -1},
+    {0.0f, 20, 0, -1},
+    {96.49826049804688f, 39, 40, 8},
+    {0.0f, 21, 0, -1},
+    {31.400936126708984f, 41, 42, 0},
+    {0.0f, 22, 0, -1},
+    {31.72939109802246f, 43, 46, 0},
+    {31.628158569335938f, 44, 45, 0},
+    {0.0f, 23, 0, -1},
+    {0.0f, 24, 0, -1},
+    {0.0f, 25, 0, -1},
+    {74.52081298828125f, 48, 53, 1},
+    {101.03472137451172f, 49, 50, 2},
+    {0.0f, 26, 0, -1},
+    {73.53691101074219f, 51, 52, 4},
+    {0.0f, 27, 0, -1},
+    {0.0f, 28, 0, -1},
+    {97.27430725097656f, 54, 55, 5},
+    {0.0f, 29, 0, -1},
+    {0.0f, 30, 0, -1},
+    {75.26200866699219f, 57, 62, 7},
+    {99.33506774902344f, 58, 61, 8},
+    {98.46353912353516f, 59, 60, 8},
+    {0.0f, 31, 0, -1},
+    {0.0f, 32, 0, -1},
+    {0.0f, 33, 0, -1},
+    {30.70430564880371f, 63, 64, 0},
+    {0.0f, 34, 0, -1},
+    {0.0f, 35, 0, -1},
+    {31.070606231689453f, 66, 69, 0},
+    {29.72888946533203f, 67, 68, 3},
+    {0.0f, 36, 0, -1},
+    {0.0f, 37, 0, -1},
+    {74.58810424804688f, 70, 73, 7},
+    {103.0173568725586f, 71, 72, 2},
+    {0.0f, 38, 0, -1},
+    {0.0f, 39, 0, -1},
+    {0.0f, 40, 0, -1},
+    {100.28993225097656f, 75, 78, 2},
+    {28.85562515258789f, 76, 77, 6},
+    {0.0f, 41, 0, -1},
+    {0.0f, 42, 0, -1},
+    {31.070606231689453f, 79, 80, 6},
+    {0.0f, 43, 0, -1},
+    {0.0f, 44, 0, -1},
+    {75.21652221679688f, 82, 87, 7},
+    {99.33506774902344f, 83, 84, 8},
+    {0.0f, 45, 0, -1},
+    {73.93911743164062f, 85, 86, 4},
+    {0.0f, 46, 0, -1},
+    {0.0f, 47, 0, -1},
+    {95.43576049804688f, 88, 89, 5},
+    {0.0f, 48, 0, -1},
+    {0.0f, 49, 0, -1},
+    {30.70430564880371f, 91, 96, 3},
+    {98.46353912353516f, 92, 95, 2},
+    {75.26200866699219f, 93, 94, 1},
+    {0.0f, 50, 0, -1},
+    {0.0f, 51, 0, -1},
+    {0.0f, 52, 0, -1},
+    {101.03472137451172f, 97, 100, 5},
+    {74.25981140136719f, 98, 99, 1},
+    {0.0f, 53, 0, -1},
+    {0.0f, 54, 0, -1},
+    {0.0f, 55, 0, -1},
+    {100.40625f, 102, 107, 2},
+    {97.27430725097656f, 103, 106, 5},
+    {30.173246383666992f, 104, 105, 0},
+    {0.0f, 56, 0, -1},
+    {0.0f, 57, 0, -1},
+    {0.0f, 58, 0, -1},
+    {31.15414810180664f, 108, 109, 6},
+    {0.0f, 59, 0, -1},
+    {73.93911743164062f, 110, 111, 7},
+    {0.0f, 60, 0, -1},
+    {0.0f, 61, 0, -1},
+    {99.33506774902344f, 113, 118, 2},
+    {30.70430564880371f, 114, 117, 0},
+    {97.27430725097656f, 115, 116, 2},
+    {0.0f, 62, 0, -1},
+    {0.0f, 63, 0, -1},
+    {0.0f, 64, 0, -1},
+    {101.15103912353516f, 119, 122, 5},
+    {74.65631866455078f, 120, 121, 7},
+    {0.0f, 65, 0, -1},
+    {0.0f, 66, 0, -1},
+    {31.66105842590332f, 123, 124, 0},
+    {0.0f, 67, 0, -1},
+    {0.0f, 68, 0, -1},
+    {100.16319274902344f, 126, 129, 2},
+    {75.26200866699219f, 127, 128, 1},
+    {0.0f, 69, 0, -1},
+    {0.0f, 70, 0, -1},
+    {73.93911743164062f, 130, 135, 1},
+    {73.40901184082031f, 131, 132, 4},
+    {0.0f, 71, 0, -1},
+    {31.325590133666992f, 133, 134, 6},
+    {0.0f, 72, 0, -1},
+    {0.0f, 73, 0, -1},
+    {0.0f, 74, 0, -1},
+    {75.26200866699219f, 137, 140, 7},
+    {101.03472137451172f, 138, 139, 2},
+    {0.0f, 75, 0, -1},
+    {0.0f, 76, 0, -1},
+    {97.40103912353516f, 141, 142, 2},
+    {0.0f, 77, 0, -1},
+    {0.0f, 78, 0, -1},
+    {74.58810424804688f, 144, 149, 1},
+    {101.03472137451172f, 145, 148, 5},
+    {30.70430564880371f, 146, 147, 6},
+    {0.0f, 79, 0, -1},
+    {0.0f, 80, 0, -1},
+    {0.0f, 81, 0, -1},
+    {76.75601959228516f, 150, 151, 7},
+    {0.0f, 82, 0, -1},
+    {0.0f, 83, 0, -1},
+    {31.15414810180664f, 153, 158, 3},
+    {75.26200866699219f, 154, 155, 7},
+    {0.0f, 84, 0, -1},
+    {29.72888946533203f, 156, 157, 3},
+    {0.0f, 85, 0, -1},
+    {0.0f, 86, 0, -1},
+    {31.66105842590332f, 159, 160, 0},
+    {0.0f, 87, 0, -1},
+    {0.0f, 88, 0, -1},
+    {31.15414810180664f, 162, 167, 0},
+    {75.82221984863281f, 163, 164, 7},
+    {0.0f, 89, 0, -1},
+    {29.392690658569336f, 165, 166, 3},
+    {0.0f, 90, 0, -1},
+    {0.0f, 91, 0, -1},
+    {103.03472137451172f, 168, 169, 2},
+    {0.0f, 92, 0, -1},
+    {73.14051818847656f, 170, 171, 1},
+    {0.0f, 93, 0, -1},
+    {0.0f, 94, 0, -1},
+    {74.32801818847656f, 173, 176, 7},
+    {73.93911743164062f, 174, 175, 7},
+    {0.0f, 95, 0, -1},
+    {0.0f, 96, 0, -1},
+    {30.87574577331543f, 177, 180, 3},
+    {76.73421478271484f, 178, 179, 7},
+    {0.0f, 97, 0, -1},
+    {0.0f, 98, 0, -1},
+    {0.0f, 99, 0, -1},
+    {96.49826049804688f, 182, 185, 8},
+    {30.173246383666992f, 183, 184, 0},
+    {0.0f, 100, 0, -1},
+    {0.0f, 101, 0, -1},
+    {31.325590133666992f, 186, 189, 3},
+    {98.46353912353516f, 187, 188, 8},
+    {0.0f, 102, 0, -1},
+    {0.0f, 103, 0, -1},
+    {0.0f, 104, 0, -1},
+    {75.21652221679688f, 191, 198, 4},
+    {99.33506774902344f, 192, 195, 8},
+    {74.25981140136719f, 193, 194, 1},
+    {0.0f, 105, 0, -1},
+    {0.0f, 106, 0, -1},
+    {73.53691101074219f, 196, 197, 4},
+    {0.0f, 107, 0, -1},
+    {0.0f, 108, 0, -1},
+    {0.0f, 109, 0, -1},
+    {31.484477996826172f, 200, 203, 0},
+    {30.87574577331543f, 201, 202, 3},
+    {0.0f, 110, 0, -1},
+    {0.0f, 111, 0, -1},
+    {73.40901184082031f, 204, 205, 4},
+    {0.0f, 112, 0, -1},
+    {103.0173568725586f, 206, 207, 2},
+    {0.0f, 113, 0, -1},
+    {0.0f, 114, 0, -1},
+    {75.26200866699219f, 209, 214, 7},
+    {74.32801818847656f, 210, 213, 4},
+    {31.66105842590332f, 211, 212, 0},
+    {0.0f, 115, 0, -1},
+    {0.0f, 116, 0, -1},
+    {0.0f, 117, 0, -1},
+    {97.27430725097656f, 215, 216, 5},
+    {0.0f, 118, 0, -1},
+    {0.0f, 119, 0, -1},
+    {74.32801818847656f, 218, 223, 1},
+    {99.33506774902344f, 219, 220, 8},
+    {0.0f, 120, 0, -1},
+    {103.0173568725586f, 221, 222, 2},
+    {0.0f, 121, 0, -1},
+    {0.0f, 122, 0, -1},
+    {75.82221984863281f, 224, 225, 7},
+    {0.0f, 123, 0, -1},
+    {92.94097137451172f, 226, 227, 8},
+    {0.0f, 124, 0, -1},
+    {0.0f, 125, 0, -1},
+    {75.26200866699219f, 229, 236, 7},
+    {101.15103912353516f, 230, 233, 5},
+    {98.46353912353516f, 231, 232, 8},
+    {0.0f, 126, 0, -1},
+    {0.0f, 127, 0, -1},
+    {102.91840362548828f, 234, 235, 2},
+    {0.0f, 128, 0, -1},
+    {0.0f, 129, 0, -1},
+    {29.392690658569336f, 237, 238, 6},
+    {0.0f, 130, 0, -1},
+    {0.0f, 131, 0, -1},
+    {29.72888946533203f, 240, 241, 6},
+    {0.0f, 132, 0, -1},
+    {101.15103912353516f, 242, 245, 5},
+    {99.33506774902344f, 243, 244, 5},
+    {0.0f, 133, 0, -1},
+    {0.0f, 134, 0, -1},
+    {0.0f, 135, 0, -1},
+    {97.40103912353516f, 247, 248, 2},
+    {0.0f, 136, 0, -1},
+    {99.20833587646484f, 249, 250, 5},
+    {0.0f, 137, 0, -1},
+    {0.0f, 138, 0, -1},
+    {74.52081298828125f, 252, 255, 7},
+    {74.13191223144531f, 253, 254, 7},
+    {0.0f, 139, 0, -1},
+    {0.0f, 140, 0, -1},
+    {30.70430564880371f, 256, 257, 3},
+    {0.0f, 141, 0, -1},
+    {31.325590133666992f, 258, 259, 0},
+    {0.0f, 142, 0, -1},
+    {0.0f, 143, 0, -1},
+    {30.173246383666992f, 261, 264, 6},
+    {30.368106842041016f, 262, 263, 0},
+    {0.0f, 144, 0, -1},
+    {0.0f, 145, 0, -1},
+    {74.13191223144531f, 265, 268, 4},
+    {31.484477996826172f, 266, 267, 6},
+    {0.0f, 146, 0, -1},
+    {0.0f, 147, 0, -1},
+    {74.65631866455078f, 269, 270, 7},
+    {0.0f, 148, 0, -1},
+    {0.0f, 149, 0, -1},
+    {74.52081298828125f, 272, 277, 1},
+    {30.87574577331543f, 273, 274, 6},
+    {0.0f, 150, 0, -1},
+    {73.542724609375f, 275, 276, 1},
+    {0.0f, 151, 0, -1},
+    {0.0f, 152, 0, -1},
+    {30.368106842041016f, 278, 279, 0},
+    {0.0f, 153, 0, -1},
+    {0.0f, 154, 0, -1},
+    {74.52081298828125f, 281, 288, 1},
+    {74.52081298828125f, 282, 285, 7},
+    {101.15103912353516f, 283, 284, 8},
+    {0.0f, 155, 0, -1},
+    {0.0f, 156, 0, -1},
+    {30.70430564880371f, 286, 287, 6},
+    {0.0f, 157, 0, -1},
+    {0.0f, 158, 0, -1},
+    {93.71701049804688f, 289, 290, 8},
+    {0.0f, 159, 0, -1},
+    {0.0f, 160, 0, -1},
+    {74.52081298828125f, 292, 301, 1},
+    {99.33506774902344f, 293, 296, 8},
+    {74.52081298828125f, 294, 295, 4},
+    {0.0f, 161, 0, -1},
+    {0.0f, 162, 0, -1},
+    {73.40901184082031f, 297, 298, 4},
+    {0.0f, 163, 0, -1},
+    {102.10590362548828f, 299, 300, 5},
+    {0.0f, 164, 0, -1},
+    {0.0f, 165, 0, -1},
+    {97.40103912353516f, 302, 303, 2},
+    {0.0f, 166, 0, -1},
+    {0.0f, 167, 0, -1},
+    {29.72888946533203f, 305, 308, 6},
+    {75.82221984863281f, 306, 307, 4},
+    {0.0f, 168, 0, -1},
+    {0.0f, 169, 0, -1},
+    {74.58810424804688f, 309, 312, 7},
+    {74.13191223144531f, 310, 311, 7},
+    {0.0f, 170, 0, -1},
+    {0.0f, 171, 0, -1},
+    {0.0f, 172, 0, -1},
+    {31.15414810180664f, 314, 319, 0},
+    {74.65631866455078f, 315, 316, 1},
+    {0.0f, 173, 0, -1},
+    {75.26200866699219f, 317, 318, 1},
+    {0.0f, 174, 0, -1},
+    {0.0f, 175, 0, -1},
+    {74.25981140136719f, 320, 321, 4},
+    {0.0f, 176, 0, -1},
+    {0.0f, 177, 0, -1},
+    {97.40103912353516f, 323, 328, 8},
+    {75.82221984863281f, 324, 325, 7},
+    {0.0f, 178, 0, -1},
+    {76.75601959228516f, 326, 327, 7},
+    {0.0f, 179, 0, -1},
+    {0.0f, 180, 0, -1},
+    {31.484477996826172f, 329, 330, 0},
+    {0.0f, 181, 0, -1},
+    {31.400936126708984f, 331, 332, 6},
+    {0.0f, 182, 0, -1},
+    {0.0f, 183, 0, -1},
+    {31.070606231689453f, 334, 339, 0},
+    {30.70430564880371f, 335, 338, 0},
+    {92.94097137451172f, 336, 337, 8},
+    {0.0f, 184, 0, -1},
+    {0.0f, 185, 0, -1},
+    {0.0f, 186, 0, -1},
+    {100.40625f, 340, 343, 8},
+    {99.33506774902344f, 341, 342, 5},
+    {0.0f, 187, 0, -1},
+    {0.0f, 188, 0, -1},
+    {0.0f, 189, 0, -1},
+    {30.368106842041016f, 345, 348, 3},
+    {97.27430725097656f, 346, 347, 2},
+    {0.0f, 190, 0, -1},
+    {0.0f, 191, 0, -1},
+    {99.33506774902344f, 349, 352, 8},
+    {74.52081298828125f, 350, 351, 4},
+    {0.0f, 192, 0, -1},
+    {0.0f, 193, 0, -1},
+    {101.15103912353516f, 353, 354, 8},
+    {0.0f, 194, 0, -1},
+    {0.0f, 195, 0, -1},
+    {74.58810424804688f, 356, 363, 1},
+    {100.28993225097656f, 357, 360, 8},
+    {98.46353912353516f, 358, 359, 8},
+    {0.0f, 196, 0, -1},
+    {0.0f, 197, 0, -1},
+    {103.94617462158203f, 361, 362, 2},
+    {0.0f, 198, 0, -1},
+    {0.0f, 199, 0, -1},
+    {75.26200866699219f, 364, 365, 1},
+    {0.0f, 200, 0, -1},
+    {0.0f, 201, 0, -1},
+    {74.58810424804688f, 367, 374, 1},
+    {101.03472137451172f, 368, 369, 2},
+    {0.0f, 202, 0, -1},
+    {31.484477996826172f, 370, 373, 6},
+    {31.484477996826172f, 371, 372, 3},
+    {0.0f, 203, 0, -1},
+    {0.0f, 204, 0, -1},
+    {0.0f, 205, 0, -1},
+    {76.75601959228516f, 375, 376, 7},
+    {0.0f, 206, 0, -1},
+    {0.0f, 207, 0, -1},
+    {74.52081298828125f, 378, 383, 1},
+    {101.03472137451172f, 379, 380, 2},
+    {0.0f, 208, 0, -1},
+    {73.542724609375f, 381, 382, 1},
+    {0.0f, 209, 0, -1},
+    {0.0f, 210, 0, -1},
+    {30.173246383666992f, 384, 387, 3},
+    {92.94097137451172f, 385, 386, 8},
+    {0.0f, 211, 0, -1},
+    {0.0f, 212, 0, -1},
+    {0.0f, 213, 0, -1},
+    {74.58810424804688f, 389, 396, 1},
+    {74.32801818847656f, 390, 395, 4},
+    {31.72939109802246f, 391, 394, 0},
+    {31.325590133666992f, 392, 393, 6},
+    {0.0f, 214, 0, -1},
+    {0.0f, 215, 0, -1},
+    {0.0f, 216, 0, -1},
+    {0.0f, 217, 0, -1},
+    {75.26200866699219f, 397, 398, 1},
+    {0.0f, 218, 0, -1},
+    {0.0f, 219, 0, -1},
+    {97.40103912353516f, 400, 403, 5},
+    {28.411266326904297f, 401, 402, 6},
+    {0.0f, 220, 0, -1},
+    {0.0f, 221, 0, -1},
+    {102.0625f, 404, 407, 5},
+    {31.070606231689453f, 405, 406, 3},
+    {0.0f, 222, 0, -1},
+    {0.0f, 223, 0, -1},
+    {0.0f, 224, 0, -1},
+    {30.368106842041016f, 409, 410, 3},
+    {0.0f, 225, 0, -1},
+    {74.52081298828125f, 411, 416, 7},
+    {73.40901184082031f, 412, 413, 4},
+    {0.0f, 226, 0, -1},
+    {101.15103912353516f, 414, 415, 8},
+    {0.0f, 227, 0, -1},
+    {0.0f, 228, 0, -1},
+    {31.325590133666992f, 417, 418, 0},
+    {0.0f, 229, 0, -1},
+    {0.0f, 230, 0, -1},
+    {98.46353912353516f, 420, 423, 5},
+    {30.70430564880371f, 421, 422, 0},
+    {0.0f, 231, 0, -1},
+    {0.0f, 232, 0, -1},
+    {74.13191223144531f, 424, 427, 4},
+    {73.93911743164062f, 425, 426, 7},
+    {0.0f, 233, 0, -1},
+    {0.0f, 234, 0, -1},
+    {31.070606231689453f, 428, 429, 3},
+    {0.0f, 235, 0, -1},
+    {0.0f, 236, 0, -1},
+    {100.16319274902344f, 431, 436, 5},
+    {74.65631866455078f, 432, 433, 1},
+    {0.0f, 237, 0, -1},
+    {30.173246383666992f, 434, 435, 0},
+    {0.0f, 238, 0, -1},
+    {0.0f, 239, 0, -1},
+    {73.93911743164062f, 437, 438, 7},
+    {0.0f, 240, 0, -1},
+    {101.15103912353516f, 439, 440, 8},
+    {0.0f, 241, 0, -1},
+    {0.0f, 242, 0, -1},
+    {74.25981140136719f, 442, 447, 4},
+    {73.93911743164062f, 443, 444, 7},
+    {0.0f, 243, 0, -1},
+    {101.15103912353516f, 445, 446, 8},
+    {0.0f, 244, 0, -1},
+    {0.0f, 245, 0, -1},
+    {99.20833587646484f, 448, 449, 5},
+    {0.0f, 246, 0, -1},
+    {0.0f, 247, 0, -1},
+    {75.21652221679688f, 451, 454, 7},
+    {73.53691101074219f, 452, 453, 1},
+    {0.0f, 248, 0, -1},
+    {0.0f, 249, 0, -1},
+    {75.26200866699219f, 455, 456, 1},
+    {0.0f, 250, 0, -1},
+    {0.0f, 251, 0, -1},
+    {30.959287643432617f, 458, 459, 0},
+    {0.0f, 252, 0, -1},
+    {73.93911743164062f, 460, 463, 1},
+    {31.552812576293945f, 461, 462, 3},
+    {0.0f, 253, 0, -1},
+    {0.0f, 254, 0, -1},
+    {0.0f, 255, 0, -1},
+    {100.16319274902344f, 465, 468, 2},
+    {97.27430725097656f, 466, 467, 2},
+    {0.0f, 256, 0, -1},
+    {0.0f, 257, 0, -1},
+    {73.40901184082031f, 469, 470, 4},
+    {0.0f, 258, 0, -1},
+    {101.15103912353516f, 471, 472, 8},
+    {0.0f, 259, 0, -1},
+    {0.0f, 260, 0, -1},
+    {98.46353912353516f, 474, 477, 5},
+    {75.2838134765625f, 475, 476, 4},
+    {0.0f, 261, 0, -1},
+    {0.0f, 262, 0, -1},
+    {101.03472137451172f, 478, 479, 2},
+    {0.0f, 263, 0, -1},
+    {74.13191223144531f, 480, 481, 7},
+    {0.0f, 264, 0, -1},
+    {0.0f, 265, 0, -1},
+    {74.25981140136719f, 483, 488, 4},
+    {73.93911743164062f, 484, 485, 7},
+    {0.0f, 266, 0, -1},
+    {101.15103912353516f, 486, 487, 8},
+    {0.0f, 267, 0, -1},
+    {0.0f, 268, 0, -1},
+    {74.65631866455078f, 489, 492, 4},
+    {99.33506774902344f, 490, 491, 5},
+    {0.0f, 269, 0, -1},
+    {0.0f, 270, 0, -1},
+    {30.173246383666992f, 493, 494, 3},
+    {0.0f, 271, 0, -1},
+    {0.0f, 272, 0, -1},
+    {75.21652221679688f, 496, 501, 7},
+    {31.400936126708984f, 497, 498, 3},
+    {0.0f, 273, 0, -1},
+    {73.40901184082031f, 499, 500, 4},
+    {0.0f, 274, 0, -1},
+    {0.0f, 275, 0, -1},
+    {0.0f, 276, 0, -1},
+    {30.623090744018555f, 503, 506, 3},
+    {92.94097137451172f, 504, 505, 8},
+    {0.0f, 277, 0, -1},
+    {0.0f, 278, 0, -1},
+    {31.552812576293945f, 507, 508, 3},
+    {0.0f, 279, 0, -1},
+    {0.0f, 280, 0, -1},
+    {97.27430725097656f, 510, 513, 8},
+    {30.368106842041016f, 511, 512, 0},
+    {0.0f, 281, 0, -1},
+    {0.0f, 282, 0, -1},
+    {74.52081298828125f, 514, 515, 7},
+    {0.0f, 283, 0, -1},
+    {74.25981140136719f, 516, 517, 1},
+    {0.0f, 284, 0, -1},
+    {0.0f, 285, 0, -1},
+    {98.46353912353516f, 519, 522, 5},
+    {75.19471740722656f, 520, 521, 1},
+    {0.0f, 286, 0, -1},
+    {0.0f, 287, 0, -1},
+    {74.25981140136719f, 523, 526, 4},
+    {73.542724609375f, 524, 525, 1},
+    {0.0f, 288, 0, -1},
+    {0.0f, 289, 0, -1},
+    {101.15103912353516f, 527, 528, 2},
+    {0.0f, 290, 0, -1},
+    {0.0f, 291, 0, -1},
+    {74.25981140136719f, 530, 535, 4},
+    {31.72939109802246f, 531, 534, 0},
+    {31.628158569335938f, 532, 533, 0},
+    {0.0f, 292, 0, -1},
+    {0.0f, 293, 0, -1},
+    {0.0f, 294, 0, -1},
+    {74.65631866455078f, 536, 539, 4},
+    {31.070606231689453f, 537, 538, 3},
+    {0.0f, 295, 0, -1},
+    {0.0f, 296, 0, -1},
+    {0.0f, 297, 0, -1},
+    {30.623090744018555f, 541, 542, 0},
+    {0.0f, 298, 0, -1},
+    {74.25981140136719f, 543, 546, 4},
+    {31.66105842590332f, 544, 545, 0},
+    {0.0f, 299, 0, -1},
+    {0.0f, 300, 0, -1},
+    {0.0f, 301, 0, -1},
+    {74.58810424804688f, 548, 553, 1},
+    {31.15414810180664f, 549, 550, 3},
+    {0.0f, 302, 0, -1},
+    {101.03472137451172f, 551, 552, 8},
+    {0.0f, 303, 0, -1},
+    {0.0f, 304, 0, -1},
+    {76.75601959228516f, 554, 555, 7},
+    {0.0f, 305, 0, -1},
+    {0.0f, 306, 0, -1},
+    {31.552812576293945f, 557, 560, 0},
+    {74.25981140136719f, 558, 559, 1},
+    {0.0f, 307, 0, -1},
+    {0.0f, 308, 0, -1},
+    {73.14051818847656f, 561, 562, 1},
+    {0.0f, 309, 0, -1},
+    {0.0f, 310, 0, -1},
+    {74.52081298828125f, 564, 567, 1},
+    {100.28993225097656f, 565, 566, 5},
+    {0.0f, 311, 0, -1},
+    {0.0f, 312, 0, -1},
+    {29.392690658569336f, 568, 571, 6},
+    {97.27430725097656f, 569, 570, 2},
+    {0.0f, 313, 0, -1},
+    {0.0f, 314, 0, -1},
+    {0.0f, 315, 0, -1},
+    {74.39530944824219f, 573, 576, 1},
+    {31.400936126708984f, 574, 575, 3},
+    {0.0f, 316, 0, -1},
+    {0.0f, 317, 0, -1},
+    {30.173246383666992f, 577, 578, 0},
+    {0.0f, 318, 0, -1},
+    {0.0f, 319, 0, -1},
+    {31.229496002197266f, 580, 583, 0},
+    {30.368106842041016f, 581, 582, 0},
+    {0.0f, 320, 0, -1},
+    {0.0f, 321, 0, -1},
+    {31.484477996826172f, 584, 587, 6},
+    {102.10590362548828f, 585, 586, 5},
+    {0.0f, 322, 0, -1},
+    {0.0f, 323, 0, -1},
+    {0.0f, 324, 0, -1},
+    {97.27430725097656f, 589, 592, 8},
+    {97.40103912353516f, 590, 591, 2},
+    {0.0f, 325, 0, -1},
+    {0.0f, 326, 0, -1},
+    {101.96353912353516f, 593, 594, 2},
+    {0.0f, 327, 0, -1},
+    {0.0f, 328, 0, -1},
+    {100.16319274902344f, 596, 599, 8},
+    {74.65631866455078f, 597, 598, 4},
+    {0.0f, 329, 0, -1},
+    {0.0f, 330, 0, -1},
+    {73.40901184082031f, 600, 601, 4},
+    {0.0f, 331, 0, -1},
+    {0.0f, 332, 0, -1},
+    {74.52081298828125f, 603, 610, 1},
+    {31.070606231689453f, 604, 607, 6},
+    {74.65631866455078f, 605, 606, 7},
+    {0.0f, 333, 0, -1},
+    {0.0f, 334, 0, -1},
+    {102.91840362548828f, 608, 609, 2},
+    {0.0f, 335, 0, -1},
+    {0.0f, 336, 0, -1},
+    {74.65631866455078f, 611, 612, 1},
+    {0.0f, 337, 0, -1},
+    {28.411266326904297f, 613, 614, 6},
+    {0.0f, 338, 0, -1},
+    {0.0f, 339, 0, -1},
+    {31.034635543823242f, 616, 621, 3},
+    {74.65631866455078f, 617, 618, 1},
+    {0.0f, 340, 0, -1},
+    {97.27430725097656f, 619, 620, 2},
+    {0.0f, 341, 0, -1},
+    {0.0f, 342, 0, -1},
+    {103.0173568725586f, 622, 623, 5},
+    {0.0f, 343, 0, -1},
+    {0.0f, 344, 0, -1},
+    {100.16319274902344f, 625, 630, 8},
+    {30.70430564880371f, 626, 629, 3},
+    {29.392690658569336f, 627, 628, 6},
+    {0.0f, 345, 0, -1},
+    {0.0f, 346, 0, -1},
+    {0.0f, 347, 0, -1},
+    {0.0f, 348, 0, -1},
+    {29.923749923706055f, 632, 635, 6},
+    {30.173246383666992f, 633, 634, 0},
+    {0.0f, 349, 0, -1},
+    {0.0f, 350, 0, -1},
+    {101.03472137451172f, 636, 637, 5},
+    {0.0f, 351, 0, -1},
+    {31.72939109802246f, 638, 641, 0},
+    {31.484477996826172f, 639, 640, 3},
+    {0.0f, 352, 0, -1},
+    {0.0f, 353, 0, -1},
+    {0.0f, 354, 0, -1},
+    {75.26200866699219f, 643, 648, 7},
+    {73.72970581054688f, 644, 645, 4},
+    {0.0f, 355, 0, -1},
+    {74.65631866455078f, 646, 647, 7},
+    {0.0f, 356, 0, -1},
+    {0.0f, 357, 0, -1},
+    {75.82221984863281f, 649, 650, 7},
+    {0.0f, 358, 0, -1},
+    {76.75601959228516f, 651, 652, 7},
+    {0.0f, 359, 0, -1},
+    {0.0f, 360, 0, -1},
+    {31.070606231689453f, 654, 659, 6},
+    {75.2838134765625f, 655, 658, 7},
+    {74.65631866455078f, 656, 657, 7},
+    {0.0f, 361, 0, -1},
+    {0.0f, 362, 0, -1},
+    {0.0f, 363, 0, -1},
+    {74.13191223144531f, 660, 661, 7},
+    {0.0f, 364, 0, -1},
+    {0.0f, 365, 0, -1},
+    {31.229496002197266f, 663, 666, 0},
+    {29.392690658569336f, 664, 665, 6},
+    {0.0f, 366, 0, -1},
+    {0.0f, 367, 0, -1},
+    {73.40901184082031f, 667, 668, 4},
+    {0.0f, 368, 0, -1},
+    {73.93911743164062f, 669, 670, 4},
+    {0.0f, 369, 0, -1},
+    {0.0f, 370, 0, -1},
+    {31.070606231689453f, 672, 675, 0},
+    {29.72888946533203f, 673, 674, 3},
+    {0.0f, 371, 0, -1},
+    {0.0f, 372, 0, -1},
+    {31.15414810180664f, 676, 677, 3},
+    {0.0f, 373, 0, -1},
+    {73.93911743164062f, 678, 679, 7},
+    {0.0f, 374, 0, -1},
+    {101.15103912353516f, 680, 681, 8},
+    {0.0f, 375, 0, -1},
+    {0.0f, 376, 0, -1},
+    {74.58810424804688f, 683, 688, 1},
+    {74.32801818847656f, 684, 687, 4},
+    {31.400936126708984f, 685, 686, 6},
+    {0.0f, 377, 0, -1},
+    {0.0f, 378, 0, -1},
+    {0.0f, 379, 0, -1},
+    {0.0f, 380, 0, -1},
+    {30.173246383666992f, 690, 695, 6},
+    {97.27430725097656f, 691, 694, 5},
+    {29.392690658569336f, 692, 693, 3},
+    {0.0f, 381, 0, -1},
+    {0.0f, 382, 0, -1},
+    {0.0f, 383, 0, -1},
+    {102.0625f, 696, 697, 2},
+    {0.0f, 384, 0, -1},
+    {0.0f, 385, 0, -1},
+    {30.368106842041016f, 699, 702, 3},
+    {75.82221984863281f, 700, 701, 4},
+    {0.0f, 386, 0, -1},
+    {0.0f, 387, 0, -1},
+    {31.400936126708984f, 703, 706, 3},
+    {74.25981140136719f, 704, 705, 1},
+    {0.0f, 388, 0, -1},
+    {0.0f, 389, 0, -1},
+    {73.14051818847656f, 707, 708, 1},
+    {0.0f, 390, 0, -1},
+    {0.0f, 391, 0, -1},
+    {74.58810424804688f, 710, 715, 4},
+    {74.25981140136719f, 711, 714, 4},
+    {103.13367462158203f, 712, 713, 5},
+    {0.0f, 392, 0, -1},
+    {0.0f, 393, 0, -1},
+    {0.0f, 394, 0, -1},
+    {30.70430564880371f, 716, 719, 0},
+    {30.173246383666992f, 717, 718, 0},
+    {0.0f, 395, 0, -1},
+    {0.0f, 396, 0, -1},
+    {0.0f, 397, 0, -1},
+    {29.72888946533203f, 721, 724, 6},
+    {97.27430725097656f, 722, 723, 2},
+    {0.0f, 398, 0, -1},
+    {0.0f, 399, 0, -1},
+    {101.03472137451172f, 725, 728, 5},
+    {74.52081298828125f, 726, 727, 4},
+    {0.0f, 400, 0, -1},
+    {0.0f, 401, 0, -1},
+    {0.0f, 402, 0, -1},
+    {30.70430564880371f, 730, 735, 3},
+    {98.46353912353516f, 731, 734, 2},
+    {92.94097137451172f, 732, 733, 8},
+    {0.0f, 403, 0, -1},
+    {0.0f, 404, 0, -1},
+    {0.0f, 405, 0, -1},
+    {31.070606231689453f, 736, 739, 6},
+    {98.46353912353516f, 737, 738, 8},
+    {0.0f, 406, 0, -1},
+    {0.0f, 407, 0, -1},
+    {31.484477996826172f, 740, 741, 3},
+    {0.0f, 408, 0, -1},
+    {0.0f, 409, 0, -1},
+    {99.33506774902344f, 743, 746, 2},
+    {30.368106842041016f, 744, 745, 0},
+    {0.0f, 410, 0, -1},
+    {0.0f, 411, 0, -1},
+    {73.93911743164062f, 747, 752, 1},
+    {31.72939109802246f, 748, 751, 0},
+    {74.25981140136719f, 749, 750, 7},
+    {0.0f, 412, 0, -1},
+    {0.0f, 413, 0, -1},
+    {0.0f, 414, 0, -1},
+    {101.15103912353516f, 753, 754, 2},
+    {0.0f, 415, 0, -1},
+    {0.0f, 416, 0, -1},
+    {30.095190048217773f, 756, 757, 3},
+    {0.0f, 417, 0, -1},
+    {74.25981140136719f, 758, 763, 4},
+    {103.13367462158203f, 759, 762, 5},
+    {31.325590133666992f, 760, 761, 6},
+    {0.0f, 418, 0, -1},
+    {0.0f, 419, 0, -1},
+    {0.0f, 420, 0, -1},
+    {0.0f, 421, 0, -1},
+    {96.625f, 765, 766, 5},
+    {0.0f, 422, 0, -1},
+    {31.070606231689453f, 767, 770, 6},
+    {101.15103912353516f, 768, 769, 2},
+    {0.0f, 423, 0, -1},
+    {0.0f, 424, 0, -1},
+    {31.72939109802246f, 771, 774, 0},
+    {101.15103912353516f, 772, 773, 8},
+    {0.0f, 425, 0, -1},
+    {0.0f, 426, 0, -1},
+    {0.0f, 427, 0, -1},
+    {97.27430725097656f, 776, 779, 8},
+    {76.73421478271484f, 777, 778, 7},
+    {0.0f, 428, 0, -1},
+    {0.0f, 429, 0, -1},
+    {31.325590133666992f, 780, 783, 3},
+    {101.15103912353516f, 781, 782, 2},
+    {0.0f, 430, 0, -1},
+    {0.0f, 431, 0, -1},
+    {31.66105842590332f, 784, 785, 0},
+    {0.0f, 432, 0, -1},
+    {0.0f, 433, 0, -1},
+    {75.19471740722656f, 787, 792, 7},
+    {31.484477996826172f, 788, 789, 0},
+    {0.0f, 434, 0, -1},
+    {101.15103912353516f, 790, 791, 8},
+    {0.0f, 435, 0, -1},
+    {0.0f, 436, 0, -1},
+    {30.173246383666992f, 793, 794, 3},
+    {0.0f, 437, 0, -1},
+    {0.0f, 438, 0, -1},
+    {31.070606231689453f, 796, 801, 0},
+    {75.26200866699219f, 797, 798, 4},
+    {0.0f, 439, 0, -1},
+    {75.26200866699219f, 799, 800, 1},
+    {0.0f, 440, 0, -1},
+    {0.0f, 441, 0, -1},
+    {74.25981140136719f, 802, 803, 4},
+    {0.0f, 442, 0, -1},
+    {74.65631866455078f, 804, 805, 7},
+    {0.0f, 443, 0, -1},
+    {0.0f, 444, 0, -1},
+    {75.19471740722656f, 807, 810, 7},
+    {73.67062377929688f, 808, 809, 1},
+    {0.0f, 445, 0, -1},
+    {0.0f, 446, 0, -1},
+    {75.82221984863281f, 811, 812, 7},
+    {0.0f, 447, 0, -1},
+    {95.43576049804688f, 813, 814, 5},
+    {0.0f, 448, 0, -1},
+    {0.0f, 449, 0, -1},
+    {101.03472137451172f, 816, 823, 5},
+    {74.52081298828125f, 817, 820, 1},
+    {99.33506774902344f, 818, 819, 5},
+    {0.0f, 450, 0, -1},
+    {0.0f, 451, 0, -1},
+    {98.46353912353516f, 821, 822, 2},
+    {0.0f, 452, 0, -1},
+    {0.0f, 453, 0, -1},
+    {73.93911743164062f, 824, 825, 7},
+    {0.0f, 454, 0, -1},
+    {73.40901184082031f, 826, 827, 1},
+    {0.0f, 455, 0, -1},
+    {0.0f, 456, 0, -1},
+    {74.58810424804688f, 829, 836, 4},
+    {31.070606231689453f, 830, 831, 6},
+    {0.0f, 457, 0, -1},
+    {73.93911743164062f, 832, 833, 7},
+    {0.0f, 458, 0, -1},
+    {31.628158569335938f, 834, 835, 0},
+    {0.0f, 459, 0, -1},
+    {0.0f, 460, 0, -1},
+    {75.26200866699219f, 837, 838, 4},
+    {0.0f, 461, 0, -1},
+    {0.0f, 462, 0, -1},
+    {30.539548873901367f, 840, 841, 0},
+    {0.0f, 463, 0, -1},
+    {100.28993225097656f, 842, 845, 8},
+    {74.52081298828125f, 843, 844, 4},
+    {0.0f, 464, 0, -1},
+    {0.0f, 465, 0, -1},
+    {0.0f, 466, 0, -1},
+    {99.33506774902344f, 847, 850, 2},
+    {97.27430725097656f, 848, 849, 5},
+    {0.0f, 467, 0, -1},
+    {0.0f, 468, 0, -1},
+    {74.32801818847656f, 851, 852, 4},
+    {0.0f, 469, 0, -1},
+    {0.0f, 470, 0, -1},
+    {31.552812576293945f, 854, 859, 0},
+    {74.52081298828125f, 855, 858, 1},
+    {74.65631866455078f, 856, 857, 7},
+    {0.0f, 471, 0, -1},
+    {0.0f, 472, 0, -1},
+    {0.0f, 473, 0, -1},
+    {73.40901184082031f, 860, 861, 4},
+    {0.0f, 474, 0, -1},
+    {0.0f, 475, 0, -1},
+    {76.19581604003906f, 863, 872, 7},
+    {73.93911743164062f, 864, 869, 1},
+    {73.40901184082031f, 865, 866, 4},
+    {0.0f, 476, 0, -1},
+    {31.628158569335938f, 867, 868, 0},
+    {0.0f, 477, 0, -1},
+    {0.0f, 478, 0, -1},
+    {30.70430564880371f, 870, 871, 6},
+    {0.0f, 479, 0, -1},
+    {0.0f, 480, 0, -1},
+    {0.0f, 481, 0, -1},
+    {74.52081298828125f, 874, 879, 1},
+    {31.325590133666992f, 875, 878, 3},
+    {101.15103912353516f, 876, 877, 2},
+    {0.0f, 482, 0, -1},
+    {0.0f, 483, 0, -1},
+    {0.0f, 484, 0, -1},
+    {95.43576049804688f, 880, 883, 8},
+    {76.75601959228516f, 881, 882, 7},
+    {0.0f, 485, 0, -1},
+    {0.0f, 486, 0, -1},
+    {0.0f, 487, 0, -1},
+    {30.70430564880371f, 885, 888, 3},
+    {95.43576049804688f, 886, 887, 8},
+    {0.0f, 488, 0, -1},
+    {0.0f, 489, 0, -1},
+    {74.25981140136719f, 889, 892, 4},
+    {31.484477996826172f, 890, 891, 3},
+    {0.0f, 490, 0, -1},
+    {0.0f, 491, 0, -1},
+    {74.52081298828125f, 893, 894, 4},
+    {0.0f, 492, 0, -1},
+    {0.0f, 493, 0, -1},
+    {99.20833587646484f, 896, 899, 2},
+    {29.392690658569336f, 897, 898, 3},
+    {0.0f, 494, 0, -1},
+    {0.0f, 495, 0, -1},
+    {99.33506774902344f, 900, 903, 8},
+    {74.65631866455078f, 901, 902, 7},
+    {0.0f, 496, 0, -1},
+    {0.0f, 497, 0, -1},
+    {0.0f, 498, 0, -1},
+    {73.93163299560547f, 905, 908, 1},
+    {103.94617462158203f, 906, 907, 2},
+    {0.0f, 499, 0, -1},
+    {0.0f, 500, 0, -1},
+    {75.82221984863281f, 909, 910, 7},
+    {0.0f, 501, 0, -1},
+    {28.411266326904297f, 911, 912, 6},
+    {0.0f, 502, 0, -1},
+    {0.0f, 503, 0, -1},
+    {30.87574577331543f, 914, 917, 0},
+    {95.43576049804688f, 915, 916, 5},
+    {0.0f, 504, 0, -1},
+    {0.0f, 505, 0, -1},
+    {74.13191223144531f, 918, 923, 1},
+    {73.40901184082031f, 919, 920, 4},
+    {0.0f, 506, 0, -1},
+    {73.40901184082031f, 921, 922, 1},
+    {0.0f, 507, 0, -1},
+    {0.0f, 508, 0, -1},
+    {0.0f, 509, 0, -1},
+    {97.27430725097656f, 925, 930, 8},
+    {30.173246383666992f, 926, 929, 3},
+    {29.392690658569336f, 927, 928, 3},
+    {0.0f, 510, 0, -1},
+    {0.0f, 511, 0, -1},
+    {0.0f, 512, 0, -1},
+    {100.28993225097656f, 931, 932, 5},
+    {0.0f, 513, 0, -1},
+    {31.484477996826172f, 933, 934, 6},
+    {0.0f, 514, 0, -1},
+    {0.0f, 515, 0, -1},
+    {74.32801818847656f, 936, 939, 1},
+    {74.52081298828125f, 937, 938, 7},
+    {0.0f, 516, 0, -1},
+    {0.0f, 517, 0, -1},
+    {74.65631866455078f, 940, 941, 1},
+    {0.0f, 518, 0, -1},
+    {0.0f, 519, 0, -1},
+    {98.46353912353516f, 943, 946, 5},
+    {97.27430725097656f, 944, 945, 5},
+    {0.0f, 520, 0, -1},
+    {0.0f, 521, 0, -1},
+    {31.15414810180664f, 947, 950, 6},
+    {31.070606231689453f, 948, 949, 3},
+    {0.0f, 522, 0, -1},
+    {0.0f, 523, 0, -1},
+    {0.0f, 524, 0, -1},
+    {74.52081298828125f, 952, 959, 1},
+    {30.87574577331543f, 953, 954, 6},
+    {0.0f, 525, 0, -1},
+    {103.13367462158203f, 955, 958, 5},
+    {103.0173568725586f, 956, 957, 2},
+    {0.0f, 526, 0, -1},
+    {0.0f, 527, 0, -1},
+    {0.0f, 528, 0, -1},
+    {93.71701049804688f, 960, 961, 8},
+    {0.0f, 529, 0, -1},
+    {0.0f, 530, 0, -1},
+    {30.539548873901367f, 963, 964, 0},
+    {0.0f, 531, 0, -1},
+    {99.20833587646484f, 965, 966, 8},
+    {0.0f, 532, 0, -1},
+    {31.628158569335938f, 967, 970, 3},
+    {101.15103912353516f, 968, 969, 8},
+    {0.0f, 533, 0, -1},
+    {0.0f, 534, 0, -1},
+    {0.0f, 535, 0, -1},
+    {30.539548873901367f, 972, 975, 3},
+    {29.392690658569336f, 973, 974, 3},
+    {0.0f, 536, 0, -1},
+    {0.0f, 537, 0, -1},
+    {74.32801818847656f, 976, 979, 7},
+    {103.94617462158203f, 977, 978, 2},
+    {0.0f, 538, 0, -1},
+    {0.0f, 539, 0, -1},
+    {0.0f, 540, 0, -1},
+    {31.297828674316406f, 981, 986, 0},
+    {95.43576049804688f, 982, 985, 8},
+    {29.392690658569336f, 983, 984, 3},
+    {0.0f, 541, 0, -1},
+    {0.0f, 542, 0, -1},
+    {0.0f, 543, 0, -1},
+    {31.628158569335938f, 987, 988, 3},
+    {0.0f, 544, 0, -1},
+    {0.0f, 545, 0, -1},
+    {74.25981140136719f, 990, 993, 4},
+    {73.53691101074219f, 991, 992, 4},
+    {0.0f, 546, 0, -1},
+    {0.0f, 547, 0, -1},
+    {75.26200866699219f, 994, 997, 7},
+    {31.070606231689453f, 995, 996, 3},
+    {0.0f, 548, 0, -1},
+    {0.0f, 549, 0, -1},
+    {0.0f, 550, 0, -1},
+    {73.93911743164062f, 999, 1002, 1},
+    {31.325590133666992f, 1000, 1001, 6},
+    {0.0f, 551, 0, -1},
+    {0.0f, 552, 0, -1},
+    {75.26200866699219f, 1003, 1006, 7},
+    {74.25981140136719f, 1004, 1005, 1},
+    {0.0f, 553, 0, -1},
+    {0.0f, 554, 0, -1},
+    {0.0f, 555, 0, -1},
+    {96.49826049804688f, 1008, 1011, 8},
+    {28.411266326904297f, 1009, 1010, 6},
+    {0.0f, 556, 0, -1},
+    {0.0f, 557, 0, -1},
+    {30.87574577331543f, 1012, 1013, 6},
+    {0.0f, 558, 0, -1},
+    {103.0173568725586f, 1014, 1015, 2},
+    {0.0f, 559, 0, -1},
+    {0.0f, 560, 0, -1},
+    {97.27430725097656f, 1017, 1020, 8},
+    {30.173246383666992f, 1018, 1019, 3},
+    {0.0f, 561, 0, -1},
+    {0.0f, 562, 0, -1},
+    {31.400936126708984f, 1021, 1024, 3},
+    {74.65631866455078f, 1022, 1023, 7},
+    {0.0f, 563, 0, -1},
+    {0.0f, 564, 0, -1},
+    {0.0f, 565, 0, -1},
+    {96.49826049804688f, 1026, 1027, 8},
+    {0.0f, 566, 0, -1},
+    {31.070606231689453f, 1028, 1031, 6},
+    {31.070606231689453f, 1029, 1030, 3},
+    {0.0f, 567, 0, -1},
+    {0.0f, 568, 0, -1},
+    {103.0173568725586f, 1032, 1033, 2},
+    {0.0f, 569, 0, -1},
+    {0.0f, 570, 0, -1},
+    {97.40103912353516f, 1035, 1040, 8},
+    {75.26200866699219f, 1036, 1037, 4},
+    {0.0f, 571, 0, -1},
+    {29.392690658569336f, 1038, 1039, 3},
+    {0.0f, 572, 0, -1},
+    {0.0f, 573, 0, -1},
+    {31.15414810180664f, 1041, 1042, 6},
+    {0.0f, 574, 0, -1},
+    {0.0f, 575, 0, -1},
+    {99.33506774902344f, 1044, 1047, 8},
+    {74.52081298828125f, 1045, 1046, 4},
+    {0.0f, 576, 0, -1},
+    {0.0f, 577, 0, -1},
+    {31.325590133666992f, 1048, 1049, 6},
+    {0.0f, 578, 0, -1},
+    {0.0f, 579, 0, -1},
+    {74.39530944824219f, 1051, 1054, 4},
+    {74.13191223144531f, 1052, 1053, 7},
+    {0.0f, 580, 0, -1},
+    {0.0f, 581, 0, -1},
+    {93.71701049804688f, 1055, 1056, 8},
+    {0.0f, 582, 0, -1},
+    {0.0f, 583, 0, -1},
+    {101.03472137451172f, 1058, 1061, 2},
+    {30.173246383666992f, 1059, 1060, 6},
+    {0.0f, 584, 0, -1},
+    {0.0f, 585, 0, -1},
+    {31.628158569335938f, 1062, 1065, 3},
+    {31.628158569335938f, 1063, 1064, 0},
+    {0.0f, 586, 0, -1},
+    {0.0f, 587, 0, -1},
+    {0.0f, 588, 0, -1},
+    {75.21652221679688f, 1067, 1072, 4},
+    {100.16319274902344f, 1068, 1069, 8},
+    {0.0f, 589, 0, -1},
+    {73.93911743164062f, 1070, 1071, 7},
+    {0.0f, 590, 0, -1},
+    {0.0f, 591, 0, -1},
+    {0.0f, 592, 0, -1},
+    {75.12651062011719f, 1074, 1081, 4},
+    {74.25981140136719f, 1075, 1080, 4},
+    {31.628158569335938f, 1076, 1079, 3},
+    {31.325590133666992f, 1077, 1078, 6},
+    {0.0f, 593, 0, -1},
+    {0.0f, 594, 0, -1},
+    {0.0f, 595, 0, -1},
+    {0.0f, 596, 0, -1},
+    {0.0f, 597, 0, -1},
+    {75.26200866699219f, 1083, 1090, 7},
+    {31.070606231689453f, 1084, 1087, 6},
+    {31.325590133666992f, 1085, 1086, 0},
+    {0.0f, 598, 0, -1},
+    {0.0f, 599, 0, -1},
+    {31.325590133666992f, 1088, 1089, 6},
+    {0.0f, 600, 0, -1},
+    {0.0f, 601, 0, -1},
+    {74.65631866455078f, 1091, 1092, 1},
+    {0.0f, 602, 0, -1},
+    {95.43576049804688f, 1093, 1094, 5},
+    {0.0f, 603, 0, -1},
+    {0.0f, 604, 0, -1},
+    {29.72888946533203f, 1096, 1099, 6},
+    {76.75601959228516f, 1097, 1098, 7},
+    {0.0f, 605, 0, -1},
+    {0.0f, 606, 0, -1},
+    {101.96353912353516f, 1100, 1101, 2},
+    {0.0f, 607, 0, -1},
+    {103.94617462158203f, 1102, 1103, 2},
+    {0.0f, 608, 0, -1},
+    {0.0f, 609, 0, -1},
+    {75.12651062011719f, 1105, 1110, 4},
+    {31.400936126708984f, 1106, 1107, 3},
+    {0.0f, 610, 0, -1},
+    {73.40901184082031f, 1108, 1109, 4},
+    {0.0f, 611, 0, -1},
+    {0.0f, 612, 0, -1},
+    {97.27430725097656f, 1111, 1112, 2},
+    {0.0f, 613, 0, -1},
+    {0.0f, 614, 0, -1},
+    {74.52081298828125f, 1114, 1119, 1},
+    {31.325590133666992f, 1115, 1118, 3},
+    {98.46353912353516f, 1116, 1117, 8},
+    {0.0f, 615, 0, -1},
+    {0.0f, 616, 0, -1},
+    {0.0f, 617, 0, -1},
+    {30.70430564880371f, 1120, 1121, 0},
+    {0.0f, 618, 0, -1},
+    {0.0f, 619, 0, -1},
+    {30.87574577331543f, 1123, 1126, 3},
+    {93.71701049804688f, 1124, 1125, 8},
+    {0.0f, 620, 0, -1},
+    {0.0f, 621, 0, -1},
+    {74.52081298828125f, 1127, 1132, 7},
+    {31.484477996826172f, 1128, 1131, 6},
+    {103.0173568725586f, 1129, 1130, 2},
+    {0.0f, 622, 0, -1},
+    {0.0f, 623, 0, -1},
+    {0.0f, 624, 0, -1},
+    {0.0f, 625, 0, -1},
+    {30.87574577331543f, 1134, 1135, 0},
+    {0.0f, 626, 0, -1},
+    {73.93911743164062f, 1136, 1141, 1},
+    {73.93911743164062f, 1137, 1138, 7},
+    {0.0f, 627, 0, -1},
+    {103.0173568725586f, 1139, 1140, 2},
+    {0.0f, 628, 0, -1},
+    {0.0f, 629, 0, -1},
+    {99.33506774902344f, 1142, 1143, 5},
+    {0.0f, 630, 0, -1},
+    {0.0f, 631, 0, -1},
+    {73.93911743164062f, 1145, 1148, 1},
+    {103.13367462158203f, 1146, 1147, 5},
+    {0.0f, 632, 0, -1},
+    {0.0f, 633, 0, -1},
+    {99.20833587646484f, 1149, 1150, 5},
+    {0.0f, 634, 0, -1},
+    {0.0f, 635, 0, -1},
+    {75.26200866699219f, 1152, 1161, 7},
+    {101.03472137451172f, 1153, 1156, 5},
+    {101.15103912353516f, 1154, 1155, 2},
+    {0.0f, 636, 0, -1},
+    {0.0f, 637, 0, -1},
+    {31.628158569335938f, 1157, 1160, 3},
+    {103.0173568725586f, 1158, 1159, 2},
+    {0.0f, 638, 0, -1},
+    {0.0f, 639, 0, -1},
+    {0.0f, 640, 0, -1},
+    {98.46353912353516f, 1162, 1163, 2},
+    {0.0f, 641, 0, -1},
+    {0.0f, 642, 0, -1},
+    {99.33506774902344f, 1165, 1170, 2},
+    {75.82221984863281f, 1166, 1167, 7},
+    {0.0f, 643, 0, -1},
+    {76.75601959228516f, 1168, 1169, 7},
+    {0.0f, 644, 0, -1},
+    {0.0f, 645, 0, -1},
+    {101.15103912353516f, 1171, 1174, 5},
+    {99.33506774902344f, 1172, 1173, 5},
+    {0.0f, 646, 0, -1},
+    {0.0f, 647, 0, -1},
+    {0.0f, 648, 0, -1},
+    {75.26200866699219f, 1176, 1179, 7},
+    {102.0625f, 1177, 1178, 2},
+    {0.0f, 649, 0, -1},
+    {0.0f, 650, 0, -1},
+    {30.70430564880371f, 1180, 1183, 0},
+    {97.27430725097656f, 1181, 1182, 2},
+    {0.0f, 651, 0, -1},
+    {0.0f, 652, 0, -1},
+    {0.0f, 653, 0, -1},
+    {73.93911743164062f, 1185, 1188, 1},
+    {73.542724609375f, 1186, 1187, 1},
+    {0.0f, 654, 0, -1},
+    {0.0f, 655, 0, -1},
+    {75.26200866699219f, 1189, 1192, 7},
+    {31.325590133666992f, 1190, 1191, 0},
+    {0.0f, 656, 0, -1},
+    {0.0f, 657, 0, -1},
+    {0.0f, 658, 0, -1},
+    {31.070606231689453f, 1194, 1199, 0},
+    {30.173246383666992f, 1195, 1198, 3},
+    {28.411266326904297f, 1196, 1197, 6},
+    {0.0f, 659, 0, -1},
+    {0.0f, 660, 0, -1},
+    {0.0f, 661, 0, -1},
+    {99.33506774902344f, 1200, 1203, 8},
+    {74.65631866455078f, 1201, 1202, 7},
+    {0.0f, 662, 0, -1},
+    {0.0f, 663, 0, -1},
+    {73.40901184082031f, 1204, 1205, 1},
+    {0.0f, 664, 0, -1},
+    {0.0f, 665, 0, -1},
+    {74.52081298828125f, 1207, 1210, 1},
+    {98.46353912353516f, 1208, 1209, 8},
+    {0.0f, 666, 0, -1},
+    {0.0f, 667, 0, -1},
+    {30.173246383666992f, 1211, 1214, 3},
+    {76.75601959228516f, 1212, 1213, 7},
+    {0.0f, 668, 0, -1},
+    {0.0f, 669, 0, -1},
+    {0.0f, 670, 0, -1},
+    {30.368106842041016f, 1216, 1221, 6},
+    {75.82221984863281f, 1217, 1218, 7},
+    {0.0f, 671, 0, -1},
+    {75.26200866699219f, 1219, 1220, 1},
+    {0.0f, 672, 0, -1},
+    {0.0f, 673, 0, -1},
+    {31.070606231689453f, 1222, 1223, 6},
+    {0.0f, 674, 0, -1},
+    {31.484477996826172f, 1224, 1227, 6},
+    {31.484477996826172f, 1225, 1226, 3},
+    {0.0f, 675, 0, -1},
+    {0.0f, 676, 0, -1},
+    {0.0f, 677, 0, -1},
+    {31.484477996826172f, 1229, 1232, 0},
+    {97.40103912353516f, 1230, 1231, 8},
+    {0.0f, 678, 0, -1},
+    {0.0f, 679, 0, -1},
+    {31.72939109802246f, 1233, 1236, 0},
+    {31.484477996826172f, 1234, 1235, 3},
+    {0.0f, 680, 0, -1},
+    {0.0f, 681, 0, -1},
+    {0.0f, 682, 0, -1},
+    {98.14583587646484f, 1238, 1243, 8},
+    {74.65631866455078f, 1239, 1240, 1},
+    {0.0f, 683, 0, -1},
+    {29.392690658569336f, 1241, 1242, 3},
+    {0.0f, 684, 0, -1},
+    {0.0f, 685, 0, -1},
+    {31.484477996826172f, 1244, 1247, 6},
+    {31.325590133666992f, 1245, 1246, 6},
+    {0.0f, 686, 0, -1},
+    {0.0f, 687, 0, -1},
+    {0.0f, 688, 0, -1},
+    {30.70430564880371f, 1249, 1252, 3},
+    {76.73421478271484f, 1250, 1251, 7},
+    {0.0f, 689, 0, -1},
+    {0.0f, 690, 0, -1},
+    {74.13191223144531f, 1253, 1256, 4},
+    {73.93911743164062f, 1254, 1255, 7},
+    {0.0f, 691, 0, -1},
+    {0.0f, 692, 0, -1},
+    {99.33506774902344f, 1257, 1258, 5},
+    {0.0f, 693, 0, -1},
+    {0.0f, 694, 0, -1},
+    {30.70430564880371f, 1260, 1265, 3},
+    {74.65631866455078f, 1261, 1262, 1},
+    {0.0f, 695, 0, -1},
+    {76.75601959228516f, 1263, 1264, 7},
+    {0.0f, 696, 0, -1},
+    {0.0f, 697, 0, -1},
+    {31.325590133666992f, 1266, 1269, 3},
+    {74.52081298828125f, 1267, 1268, 4},
+    {0.0f, 698, 0, -1},
+    {0.0f, 699, 0, -1},
+    {0.0f, 700, 0, -1},
+    {99.20833587646484f, 1271, 1274, 2},
+    {76.75601959228516f, 1272, 1273, 7},
+    {0.0f, 701, 0, -1},
+    {0.0f, 702, 0, -1},
+    {74.52081298828125f, 1275, 1278, 7},
+    {31.484477996826172f, 1276, 1277, 3},
+    {0.0f, 703, 0, -1},
+    {0.0f, 704, 0, -1},
+    {101.15103912353516f, 1279, 1280, 2},
+    {0.0f, 705, 0, -1},
+    {0.0f, 706, 0, -1},
+    {29.191822052001953f, 1282, 1283, 6},
+    {0.0f, 707, 0, -1},
+    {31.484477996826172f, 1284, 1287, 0},
+    {31.070606231689453f, 1285, 1286, 3},
+    {0.0f, 708, 0, -1},
+    {0.0f, 709, 0, -1},
+    {31.628158569335938f, 1288, 1289, 0},
+    {0.0f, 710, 0, -1},
+    {0.0f, 711, 0, -1},
+    {74.58810424804688f, 1291, 1300, 1},
+    {73.93911743164062f, 1292, 1297, 1},
+    {73.93911743164062f, 1293, 1294, 7},
+    {0.0f, 712, 0, -1},
+    {31.484477996826172f, 1295, 1296, 3},
+    {0.0f, 713, 0, -1},
+    {0.0f, 714, 0, -1},
+    {31.070606231689453f, 1298, 1299, 3},
+    {0.0f, 715, 0, -1},
+    {0.0f, 716, 0, -1},
+    {30.173246383666992f, 1301, 1302, 0},
+    {0.0f, 717, 0, -1},
+    {0.0f, 718, 0, -1},
+    {99.20833587646484f, 1304, 1307, 2},
+    {30.173246383666992f, 1305, 1306, 0},
+    {0.0f, 719, 0, -1},
+    {0.0f, 720, 0, -1},
+    {74.58810424804688f, 1308, 1313, 7},
+    {73.93911743164062f, 1309, 1310, 7},
+    {0.0f, 721, 0, -1},
+    {103.0173568725586f, 1311, 1312, 2},
+    {0.0f, 722, 0, -1},
+    {0.0f, 723, 0, -1},
+    {0.0f, 724, 0, -1},
+    {99.33506774902344f, 1315, 1320, 2},
+    {75.82221984863281f, 1316, 1317, 7},
+    {0.0f, 725, 0, -1},
+    {97.27430725097656f, 1318, 1319, 2},
+    {0.0f, 726, 0, -1},
+    {0.0f, 727, 0, -1},
+    {101.31770324707031f, 1321, 1322, 5},
+    {0.0f, 728, 0, -1},
+    {0.0f, 729, 0, -1},
+    {75.19471740722656f, 1324, 1333, 4},
+    {74.52081298828125f, 1325, 1330, 7},
+    {73.40901184082031f, 1326, 1327, 4},
+    {0.0f, 730, 0, -1},
+    {31.628158569335938f, 1328, 1329, 0},
+    {0.0f, 731, 0, -1},
+    {0.0f, 732, 0, -1},
+    {99.33506774902344f, 1331, 1332, 5},
+    {0.0f, 733, 0, -1},
+    {0.0f, 734, 0, -1},
+    {92.94097137451172f, 1334, 1335, 8},
+    {0.0f, 735, 0, -1},
+    {0.0f, 736, 0, -1},
+    {31.229496002197266f, 1337, 1342, 0},
+    {74.65631866455078f, 1338, 1339, 1},
+    {0.0f, 737, 0, -1},
+    {28.411266326904297f, 1340, 1341, 6},
+    {0.0f, 738, 0, -1},
+    {0.0f, 739, 0, -1},
+    {103.13367462158203f, 1343, 1346, 5},
+    {31.484477996826172f, 1344, 1345, 3},
+    {0.0f, 740, 0, -1},
+    {0.0f, 741, 0, -1},
+    {0.0f, 742, 0, -1},
+    {99.20833587646484f, 1348, 1351, 2},
+    {28.411266326904297f, 1349, 1350, 6},
+    {0.0f, 743, 0, -1},
+    {0.0f, 744, 0, -1},
+    {74.25981140136719f, 1352, 1355, 4},
+    {74.25981140136719f, 1353, 1354, 7},
+    {0.0f, 745, 0, -1},
+    {0.0f, 746, 0, -1},
+    {74.25981140136719f, 1356, 1357, 1},
+    {0.0f, 747, 0, -1},
+    {0.0f, 748, 0, -1},
+    {74.58810424804688f, 1359, 1366, 4},
+    {31.325590133666992f, 1360, 1361, 3},
+    {0.0f, 749, 0, -1},
+    {103.13367462158203f, 1362, 1365, 5},
+    {103.0173568725586f, 1363, 1364, 2},
+    {0.0f, 750, 0, -1},
+    {0.0f, 751, 0, -1},
+    {0.0f, 752, 0, -1},
+    {28.85562515258789f, 1367, 1368, 6},
+    {0.0f, 753, 0, -1},
+    {0.0f, 754, 0, -1},
+    {74.39530944824219f, 1370, 1373, 7},
+    {103.0173568725586f, 1371, 1372, 5},
+    {0.0f, 755, 0, -1},
+    {0.0f, 756, 0, -1},
+    {75.26200866699219f, 1374, 1375, 7},
+    {0.0f, 757, 0, -1},
+    {30.173246383666992f, 1376, 1377, 3},
+    {0.0f, 758, 0, -1},
+    {0.0f, 759, 0, -1},
+    {97.40103912353516f, 1379, 1384, 8},
+    {75.82221984863281f, 1380, 1381, 7},
+    {0.0f, 760, 0, -1},
+    {29.392690658569336f, 1382, 1383, 3},
+    {0.0f, 761, 0, -1},
+    {0.0f, 762, 0, -1},
+    {101.15103912353516f, 1385, 1386, 5},
+    {0.0f, 763, 0, -1},
+    {0.0f, 764, 0, -1},
+    {75.26200866699219f, 1388, 1393, 7},
+    {73.72970581054688f, 1389, 1390, 4},
+    {0.0f, 765, 0, -1},
+    {74.25981140136719f, 1391, 1392, 1},
+    {0.0f, 766, 0, -1},
+    {0.0f, 767, 0, -1},
+    {76.73421478271484f, 1394, 1395, 7},
+    {0.0f, 768, 0, -1},
+    {0.0f, 769, 0, -1},
+    {74.25981140136719f, 1397, 1400, 4},
+    {31.628158569335938f, 1398, 1399, 0},
+    {0.0f, 770, 0, -1},
+    {0.0f, 771, 0, -1},
+    {97.27430725097656f, 1401, 1402, 8},
+    {0.0f, 772, 0, -1},
+    {99.33506774902344f, 1403, 1404, 5},
+    {0.0f, 773, 0, -1},
+    {0.0f, 774, 0, -1},
+    {100.16319274902344f, 1406, 1409, 2},
+    {92.94097137451172f, 1407, 1408, 8},
+    {0.0f, 775, 0, -1},
+    {0.0f, 776, 0, -1},
+    {73.93911743164062f, 1410, 1413, 1},
+    {103.0173568725586f, 1411, 1412, 2},
+    {0.0f, 777, 0, -1},
+    {0.0f, 778, 0, -1},
+    {0.0f, 779, 0, -1},
+    {96.49826049804688f, 1415, 1418, 8},
+    {29.392690658569336f, 1416, 1417, 3},
+    {0.0f, 780, 0, -1},
+    {0.0f, 781, 0, -1},
+    {74.58810424804688f, 1419, 1420, 7},
+    {0.0f, 782, 0, -1},
+    {0.0f, 783, 0, -1},
+    {100.28993225097656f, 1422, 1427, 2},
+    {74.65631866455078f, 1423, 1424, 1},
+    {0.0f, 784, 0, -1},
+    {97.27430725097656f, 1425, 1426, 2},
+    {0.0f, 785, 0, -1},
+    {0.0f, 786, 0, -1},
+    {74.25981140136719f, 1428, 1429, 7},
+    {0.0f, 787, 0, -1},
+    {0.0f, 788, 0, -1},
+    {94.77951049804688f, 1431, 1432, 8},
+    {0.0f, 789, 0, -1},
+    {73.93911743164062f, 1433, 1438, 1},
+    {73.40901184082031f, 1434, 1435, 4},
+    {0.0f, 790, 0, -1},
+    {73.93911743164062f, 1436, 1437, 4},
+    {0.0f, 791, 0, -1},
+    {0.0f, 792, 0, -1},
+    {98.46353912353516f, 1439, 1440, 8},
+    {0.0f, 793, 0, -1},
+    {0.0f, 794, 0, -1},
+    {74.20011901855469f, 1442, 1447, 1},
+    {73.93911743164062f, 1443, 1444, 7},
+    {0.0f, 795, 0, -1},
+    {31.325590133666992f, 1445, 1446, 6},
+    {0.0f, 796, 0, -1},
+    {0.0f, 797, 0, -1},
+    {75.19471740722656f, 1448, 1449, 1},
+    {0.0f, 798, 0, -1},
+    {0.0f, 799, 0, -1},
+    {74.58810424804688f, 1451, 1456, 1},
+    {31.400936126708984f, 1452, 1455, 3},
+    {31.070606231689453f, 1453, 1454, 3},
+    {0.0f, 800, 0, -1},
+    {0.0f, 801, 0, -1},
+    {0.0f, 802, 0, -1},
+    {75.26200866699219f, 1457, 1458, 1},
+    {0.0f, 803, 0, -1},
+    {0.0f, 804, 0, -1},
+    {30.87574577331543f, 1460, 1463, 3},
+    {30.368106842041016f, 1461, 1462, 0},
+    {0.0f, 805, 0, -1},
+    {0.0f, 806, 0, -1},
+    {31.325590133666992f, 1464, 1465, 3},
+    {0.0f, 807, 0, -1},
+    {73.93911743164062f, 1466, 1467, 7},
+    {0.0f, 808, 0, -1},
+    {31.484477996826172f, 1468, 1469, 3},
+    {0.0f, 809, 0, -1},
+    {0.0f, 810, 0, -1},
+    {76.12852478027344f, 1471, 1478, 7},
+    {31.484477996826172f, 1472, 1473, 0},
+    {0.0f, 811, 0, -1},
+    {31.628158569335938f, 1474, 1477, 3},
+    {73.93911743164062f, 1475, 1476, 4},
+    {0.0f, 812, 0, -1},
+    {0.0f, 813, 0, -1},
+    {0.0f, 814, 0, -1},
+    {0.0f, 815, 0, -1},
+    {99.33506774902344f, 1480, 1485, 2},
+    {74.65631866455078f, 1481, 1482, 1},
+    {0.0f, 816, 0, -1},
+    {76.75601959228516f, 1483, 1484, 7},
+    {0.0f, 817, 0, -1},
+    {0.0f, 818, 0, -1},
+    {101.03472137451172f, 1486, 1489, 5},
+    {30.70430564880371f, 1487, 1488, 6},
+    {0.0f, 819, 0, -1},
+    {0.0f, 820, 0, -1},
+    {0.0f, 821, 0, -1},
+    {99.33506774902344f, 1491, 1494, 2},
+    {30.173246383666992f, 1492, 1493, 3},
+    {0.0f, 822, 0, -1},
+    {0.0f, 823, 0, -1},
+    {31.325590133666992f, 1495, 1498, 3},
+    {74.52081298828125f, 1496, 1497, 4},
+    {0.0f, 824, 0, -1},
+    {0.0f, 825, 0, -1},
+    {0.0f, 826, 0, -1},
+    {74.58810424804688f, 1500, 1505, 1},
+    {99.33506774902344f, 1501, 1504, 8},
+    {74.52081298828125f, 1502, 1503, 4},
+    {0.0f, 827, 0, -1},
+    {0.0f, 828, 0, -1},
+    {0.0f, 829, 0, -1},
+    {0.0f, 830, 0, -1},
+    {74.32801818847656f, 1507, 1512, 1},
+    {101.03472137451172f, 1508, 1509, 5},
+    {0.0f, 831, 0, -1},
+    {31.325590133666992f, 1510, 1511, 6},
+    {0.0f, 832, 0, -1},
+    {0.0f, 833, 0, -1},
+    {74.65631866455078f, 1513, 1514, 1},
+    {0.0f, 834, 0, -1},
+    {95.43576049804688f, 1515, 1516, 5},
+    {0.0f, 835, 0, -1},
+    {0.0f, 836, 0, -1},
+    {100.16319274902344f, 1518, 1521, 2},
+    {95.43576049804688f, 1519, 1520, 5},
+    {0.0f, 837, 0, -1},
+    {0.0f, 838, 0, -1},
+    {74.52081298828125f, 1522, 1525, 7},
+    {31.325590133666992f, 1523, 1524, 6},
+    {0.0f, 839, 0, -1},
+    {0.0f, 840, 0, -1},
+    {0.0f, 841, 0, -1},
+    {74.58810424804688f, 1527, 1532, 7},
+    {31.484477996826172f, 1528, 1531, 6},
+    {101.15103912353516f, 1529, 1530, 8},
+    {0.0f, 842, 0, -1},
+    {0.0f, 843, 0, -1},
+    {0.0f, 844, 0, -1},
+    {30.70430564880371f, 1533, 1534, 3},
+    {0.0f, 845, 0, -1},
+    {0.0f, 846, 0, -1},
+    {74.58810424804688f, 1536, 1541, 1},
+    {74.58810424804688f, 1537, 1540, 7},
+    {103.0173568725586f, 1538, 1539, 2},
+    {0.0f, 847, 0, -1},
+    {0.0f, 848, 0, -1},
+    {0.0f, 849, 0, -1},
+    {0.0f, 850, 0, -1},
+    {30.368106842041016f, 1543, 1546, 3},
+    {97.27430725097656f, 1544, 1545, 2},
+    {0.0f, 851, 0, -1},
+    {0.0f, 852, 0, -1},
+    {99.33506774902344f, 1547, 1550, 8},
+    {98.46353912353516f, 1548, 1549, 8},
+    {0.0f, 853, 0, -1},
+    {0.0f, 854, 0, -1},
+    {31.484477996826172f, 1551, 1554, 6},
+    {103.0173568725586f, 1552, 1553, 2},
+    {0.0f, 855, 0, -1},
+    {0.0f, 856, 0, -1},
+    {0.0f, 857, 0, -1},
+    {75.26200866699219f, 1556, 1563, 7},
+    {31.070606231689453f, 1557, 1560, 6},
+    {74.52081298828125f, 1558, 1559, 4},
+    {0.0f, 858, 0, -1},
+    {0.0f, 859, 0, -1},
+    {31.66105842590332f, 1561, 1562, 0},
+    {0.0f, 860, 0, -1},
+    {0.0f, 861, 0, -1},
+    {30.70430564880371f, 1564, 1567, 0},
+    {97.27430725097656f, 1565, 1566, 2},
+    {0.0f, 862, 0, -1},
+    {0.0f, 863, 0, -1},
+    {0.0f, 864, 0, -1},
+    {30.87574577331543f, 1569, 1574, 3},
+    {97.27430725097656f, 1570, 1573, 5},
+    {75.26200866699219f, 1571, 1572, 1},
+    {0.0f, 865, 0, -1},
+    {0.0f, 866, 0, -1},
+    {0.0f, 867, 0, -1},
+    {99.33506774902344f, 1575, 1576, 8},
+    {0.0f, 868, 0, -1},
+    {31.72939109802246f, 1577, 1580, 0},
+    {31.325590133666992f, 1578, 1579, 6},
+    {0.0f, 869, 0, -1},
+    {0.0f, 870, 0, -1},
+    {0.0f, 871, 0, -1},
+    {31.15414810180664f, 1582, 1587, 0},
+    {74.65631866455078f, 1583, 1584, 1},
+    {0.0f, 872, 0, -1},
+    {97.27430725097656f, 1585, 1586, 2},
+    {0.0f, 873, 0, -1},
+    {0.0f, 874, 0, -1},
+    {31.484477996826172f, 1588, 1589, 0},
+    {0.0f, 875, 0, -1},
+    {101.03472137451172f, 1590, 1591, 8},
+    {0.0f, 876, 0, -1},
+    {0.0f, 877, 0, -1},
+    {74.39530944824219f, 1593, 1598, 4},
+    {31.628158569335938f, 1594, 1597, 3},
+    {103.0173568725586f, 1595, 1596, 2},
+    {0.0f, 878, 0, -1},
+    {0.0f, 879, 0, -1},
+    {0.0f, 880, 0, -1},
+    {30.173246383666992f, 1599, 1600, 3},
+    {0.0f, 881, 0, -1},
+    {0.0f, 882, 0, -1},
+    {31.070606231689453f, 1602, 1603, 0},
+    {0.0f, 883, 0, -1},
+    {31.325590133666992f, 1604, 1605, 0},
+    {0.0f, 884, 0, -1},
+    {0.0f, 885, 0, -1},
+    {98.46353912353516f, 1607, 1610, 5},
+    {97.40103912353516f, 1608, 1609, 2},
+    {0.0f, 886, 0, -1},
+    {0.0f, 887, 0, -1},
+    {31.15414810180664f, 1611, 1612, 3},
+    {0.0f, 888, 0, -1},
+    {101.03472137451172f, 1613, 1614, 8},
+    {0.0f, 889, 0, -1},
+    {0.0f, 890, 0, -1},
+    {100.28993225097656f, 1616, 1621, 2},
+    {30.173246383666992f, 1617, 1620, 3},
+    {95.43576049804688f, 1618, 1619, 5},
+    {0.0f, 891, 0, -1},
+    {0.0f, 892, 0, -1},
+    {0.0f, 893, 0, -1},
+    {31.484477996826172f, 1622, 1623, 0},
+    {0.0f, 894, 0, -1},
+    {0.0f, 895, 0, -1},
+    {75.26200866699219f, 1625, 1632, 7},
+    {74.52081298828125f, 1626, 1629, 7},
+    {73.542724609375f, 1627, 1628, 1},
+    {0.0f, 896, 0, -1},
+    {0.0f, 897, 0, -1},
+    {31.070606231689453f, 1630, 1631, 3},
+    {0.0f, 898, 0, -1},
+    {0.0f, 899, 0, -1},
+    {75.19471740722656f, 1633, 1634, 1},
+    {0.0f, 900, 0, -1},
+    {0.0f, 901, 0, -1},
+    {74.25981140136719f, 1636, 1639, 4},
+    {31.484477996826172f, 1637, 1638, 3},
+    {0.0f, 902, 0, -1},
+    {0.0f, 903, 0, -1},
+    {75.26200866699219f, 1640, 1643, 7},
+    {74.25981140136719f, 1641, 1642, 1},
+    {0.0f, 904, 0, -1},
+    {0.0f, 905, 0, -1},
+    {0.0f, 906, 0, -1},
+    {94.77951049804688f, 1645, 1646, 8},
+    {0.0f, 907, 0, -1},
+    {31.070606231689453f, 1647, 1650, 6},
+    {31.325590133666992f, 1648, 1649, 0},
+    {0.0f, 908, 0, -1},
+    {0.0f, 909, 0, -1},
+    {103.0173568725586f, 1651, 1652, 2},
+    {0.0f, 910, 0, -1},
+    {0.0f, 911, 0, -1},
+    {74.52081298828125f, 1654, 1659, 7},
+    {73.40901184082031f, 1655, 1656, 4},
+    {0.0f, 912, 0, -1},
+    {101.15103912353516f, 1657, 1658, 8},
+    {0.0f, 913, 0, -1},
+    {0.0f, 914, 0, -1},
+    {98.46353912353516f, 1660, 1661, 8},
+    {0.0f, 915, 0, -1},
+    {0.0f, 916, 0, -1},
+    {98.46353912353516f, 1663, 1668, 5},
+    {30.70430564880371f, 1664, 1667, 0},
+    {97.27430725097656f, 1665, 1666, 2},
+    {0.0f, 917, 0, -1},
+    {0.0f, 918, 0, -1},
+    {0.0f, 919, 0, -1},
+    {99.20833587646484f, 1669, 1670, 8},
+    {0.0f, 920, 0, -1},
+    {101.03472137451172f, 1671, 1672, 8},
+    {0.0f, 921, 0, -1},
+    {0.0f, 922, 0, -1},
+    {99.20833587646484f, 1674, 1677, 2},
+    {97.27430725097656f, 1675, 1676, 2},
+    {0.0f, 923, 0, -1},
+    {0.0f, 924, 0, -1},
+    {101.03472137451172f, 1678, 1681, 5},
+    {74.25981140136719f, 1679, 1680, 1},
+    {0.0f, 925, 0, -1},
+    {0.0f, 926, 0, -1},
+    {102.10590362548828f, 1682, 1683, 5},
+    {0.0f, 927, 0, -1},
+    {0.0f, 928, 0, -1},
+    {99.33506774902344f, 1685, 1690, 2},
+    {75.82221984863281f, 1686, 1687, 7},
+    {0.0f, 929, 0, -1},
+    {28.411266326904297f, 1688, 1689, 6},
+    {0.0f, 930, 0, -1},
+    {0.0f, 931, 0, -1},
+    {100.16319274902344f, 1691, 1692, 8},
+    {0.0f, 932, 0, -1},
+    {0.0f, 933, 0, -1},
+    {99.20833587646484f, 1694, 1699, 5},
+    {74.65631866455078f, 1695, 1696, 1},
+    {0.0f, 934, 0, -1},
+    {75.82221984863281f, 1697, 1698, 4},
+    {0.0f, 935, 0, -1},
+    {0.0f, 936, 0, -1},
+    {102.10590362548828f, 1700, 1701, 2},
+    {0.0f, 937, 0, -1},
+    {0.0f, 938, 0, -1},
+    {97.27430725097656f, 1703, 1706, 8},
+    {98.46353912353516f, 1704, 1705, 2},
+    {0.0f, 939, 0, -1},
+    {0.0f, 940, 0, -1},
+    {100.27951049804688f, 1707, 1708, 8},
+    {0.0f, 941, 0, -1},
+    {0.0f, 942, 0, -1},
+    {98.46353912353516f, 1710, 1715, 5},
+    {30.70430564880371f, 1711, 1714, 0},
+    {76.75601959228516f, 1712, 1713, 7},
+    {0.0f, 943, 0, -1},
+    {0.0f, 944, 0, -1},
+    {0.0f, 945, 0, -1},
+    {100.28993225097656f, 1716, 1717, 5},
+    {0.0f, 946, 0, -1},
+    {31.484477996826172f, 1718, 1719, 3},
+    {0.0f, 947, 0, -1},
+    {0.0f, 948, 0, -1},
+    {31.070606231689453f, 1721, 1728, 6},
+    {30.173246383666992f, 1722, 1725, 6},
+    {95.43576049804688f, 1723, 1724, 8},
+    {0.0f, 949, 0, -1},
+    {0.0f, 950, 0, -1},
+    {30.70430564880371f, 1726, 1727, 6},
+    {0.0f, 951, 0, -1},
+    {0.0f, 952, 0, -1},
+    {102.91840362548828f, 1729, 1730, 2},
+    {0.0f, 953, 0, -1},
+    {0.0f, 954, 0, -1},
+    {75.12651062011719f, 1732, 1739, 1},
+    {31.070606231689453f, 1733, 1736, 6},
+    {31.325590133666992f, 1734, 1735, 0},
+    {0.0f, 955, 0, -1},
+    {0.0f, 956, 0, -1},
+    {102.10590362548828f, 1737, 1738, 5},
+    {0.0f, 957, 0, -1},
+    {0.0f, 958, 0, -1},
+    {0.0f, 959, 0, -1},
+    {31.469270706176758f, 1741, 1748, 3},
+    {30.173246383666992f, 1742, 1745, 6},
+    {30.173246383666992f, 1743, 1744, 3},
+    {0.0f, 960, 0, -1},
+    {0.0f, 961, 0, -1},
+    {31.325590133666992f, 1746, 1747, 0},
+    {0.0f, 962, 0, -1},
+    {0.0f, 963, 0, -1},
+    {0.0f, 964, 0, -1},
+    {98.46353912353516f, 1750, 1753, 5},
+    {95.43576049804688f, 1751, 1752, 8},
+    {0.0f, 965, 0, -1},
+    {0.0f, 966, 0, -1},
+    {74.58810424804688f, 1754, 1755, 7},
+    {0.0f, 967, 0, -1},
+    {0.0f, 968, 0, -1},
+    {74.52081298828125f, 1757, 1764, 1},
+    {74.13191223144531f, 1758, 1761, 4},
+    {31.72939109802246f, 1759, 1760, 0},
+    {0.0f, 969, 0, -1},
+    {0.0f, 970, 0, -1},
+    {31.325590133666992f, 1762, 1763, 0},
+    {0.0f, 971, 0, -1},
+    {0.0f, 972, 0, -1},
+    {97.40103912353516f, 1765, 1766, 2},
+    {0.0f, 973, 0, -1},
+    {0.0f, 974, 0, -1},
+    {74.52081298828125f, 1768, 1771, 1},
+    {31.15414810180664f, 1769, 1770, 3},
+    {0.0f, 975, 0, -1},
+    {0.0f, 976, 0, -1},
+    {29.392690658569336f, 1772, 1775, 6},
+    {30.173246383666992f, 1773, 1774, 0},
+    {0.0f, 977, 0, -1},
+    {0.0f, 978, 0, -1},
+    {0.0f, 979, 0, -1},
+    {31.15414810180664f, 1777, 1782, 0},
+    {29.392690658569336f, 1778, 1781, 6},
+    {75.26200866699219f, 1779, 1780, 1},
+    {0.0f, 980, 0, -1},
+    {0.0f, 981, 0, -1},
+    {0.0f, 982, 0, -1},
+    {31.229496002197266f, 1783, 1784, 6},
+    {0.0f, 983, 0, -1},
+    {0.0f, 984, 0, -1},
+    {98.46353912353516f, 1786, 1789, 5},
+    {30.173246383666992f, 1787, 1788, 3},
+    {0.0f, 985, 0, -1},
+    {0.0f, 986, 0, -1},
+    {31.325590133666992f, 1790, 1793, 3},
+    {99.33506774902344f, 1791, 1792, 5},
+    {0.0f, 987, 0, -1},
+    {0.0f, 988, 0, -1},
+    {0.0f, 989, 0, -1},
+    {31.15414810180664f, 1795, 1800, 0},
+    {98.46353912353516f, 1796, 1799, 2},
+    {29.392690658569336f, 1797, 1798, 3},
+    {0.0f, 990, 0, -1},
+    {0.0f, 991, 0, -1},
+    {0.0f, 992, 0, -1},
+    {31.552812576293945f, 1801, 1802, 0},
+    {0.0f, 993, 0, -1},
+    {73.93911743164062f, 1803, 1804, 7},
+    {0.0f, 994, 0, -1},
+    {0.0f, 995, 0, -1},
+    {75.21652221679688f, 1806, 1811, 7},
+    {31.484477996826172f, 1807, 1808, 0},
+    {0.0f, 996, 0, -1},
+    {31.484477996826172f, 1809, 1810, 3},
+    {0.0f, 997, 0, -1},
+    {0.0f, 998, 0, -1},
+    {0.0f, 999, 0, -1},
+    {74.39530944824219f, 1813, 1818, 1},
+    {73.93911743164062f, 1814, 1817, 1},
+    {31.484477996826172f, 1815, 1816, 3},
+    {0.0f, 1000, 0, -1},
+    {0.0f, 1001, 0, -1},
+    {0.0f, 1002, 0, -1},
+    {0.0f, 1003, 0, -1},
+    {31.229496002197266f, 1820, 1821, 0},
+    {0.0f, 1004, 0, -1},
+    {31.628158569335938f, 1822, 1825, 3},
+    {101.15103912353516f, 1823, 1824, 8},
+    {0.0f, 1005, 0, -1},
+    {0.0f, 1006, 0, -1},
+    {0.0f, 1007, 0, -1},
+    {30.87574577331543f, 1827, 1832, 3},
+    {30.70430564880371f, 1828, 1831, 0},
+    {30.173246383666992f, 1829, 1830, 0},
+    {0.0f, 1008, 0, -1},
+    {0.0f, 1009, 0, -1},
+    {0.0f, 1010, 0, -1},
+    {31.325590133666992f, 1833, 1834, 3},
+    {0.0f, 1011, 0, -1},
+    {73.93911743164062f, 1835, 1836, 7},
+    {0.0f, 1012, 0, -1},
+    {102.10590362548828f, 1837, 1838, 5},
+    {0.0f, 1013, 0, -1},
+    {0.0f, 1014, 0, -1},
+    {74.52081298828125f, 1840, 1847, 1},
+    {103.03472137451172f, 1841, 1844, 2},
+    {31.070606231689453f, 1842, 1843, 3},
+    {0.0f, 1015, 0, -1},
+    {0.0f, 1016, 0, -1},
+    {103.94617462158203f, 1845, 1846, 2},
+    {0.0f, 1017, 0, -1},
+    {0.0f, 1018, 0, -1},
+    {74.65631866455078f, 1848, 1849, 1},
+    {0.0f, 1019, 0, -1},
+    {75.82221984863281f, 1850, 1851, 4},
+    {0.0f, 1020, 0, -1},
+    {0.0f, 1021, 0, -1},
+    {31.229496002197266f, 1853, 1858, 0},
+    {75.26200866699219f, 1854, 1855, 4},
+    {0.0f, 1022, 0, -1},
+    {95.43576049804688f, 1856, 1857, 5},
+    {0.0f, 1023, 0, -1},
+    {0.0f, 1024, 0, -1},
+    {103.13367462158203f, 1859, 1862, 5},
+    {31.628158569335938f, 1860, 1861, 0},
+    {0.0f, 1025, 0, -1},
+    {0.0f, 1026, 0, -1},
+    {0.0f, 1027, 0, -1},
+    {30.87574577331543f, 1864, 1867, 3},
+    {97.27430725097656f, 1865, 1866, 5},
+    {0.0f, 1028, 0, -1},
+    {0.0f, 1029, 0, -1},
+    {31.070606231689453f, 1868, 1869, 6},
+    {0.0f, 1030, 0, -1},
+    {73.93911743164062f, 1870, 1871, 7},
+    {0.0f, 1031, 0, -1},
+    {73.40901184082031f, 1872, 1873, 1},
+    {0.0f, 1032, 0, -1},
+    {0.0f, 1033, 0, -1},
+    {30.959287643432617f, 1875, 1878, 6},
+    {30.173246383666992f, 1876, 1877, 6},
+    {0.0f, 1034, 0, -1},
+    {0.0f, 1035, 0, -1},
+    {103.0173568725586f, 1879, 1880, 5},
+    {0.0f, 1036, 0, -1},
+    {0.0f, 1037, 0, -1},
+    {30.87574577331543f, 1882, 1885, 0},
+    {30.173246383666992f, 1883, 1884, 0},
+    {0.0f, 1038, 0, -1},
+    {0.0f, 1039, 0, -1},
+    {31.400936126708984f, 1886, 1887, 0},
+    {0.0f, 1040, 0, -1},
+    {31.484477996826172f, 1888, 1891, 6},
+    {31.628158569335938f, 1889, 1890, 0},
+    {0.0f, 1041, 0, -1},
+    {0.0f, 1042, 0, -1},
+    {0.0f, 1043, 0, -1},
+    {74.20011901855469f, 1893, 1898, 1},
+    {103.13367462158203f, 1894, 1897, 5},
+    {31.484477996826172f, 1895, 1896, 3},
+    {0.0f, 1044, 0, -1},
+    {0.0f, 1045, 0, -1},
+    {0.0f, 1046, 0, -1},
+    {93.71701049804688f, 1899, 1900, 8},
+    {0.0f, 1047, 0, -1},
+    {0.0f, 1048, 0, -1},
+    {75.19471740722656f, 1902, 1907, 4},
+    {31.484477996826172f, 1903, 1906, 0},
+    {31.325590133666992f, 1904, 1905, 0},
+    {0.0f, 1049, 0, -1},
+    {0.0f, 1050, 0, -1},
+    {0.0f, 1051, 0, -1},
+    {75.82221984863281f, 1908, 1909, 4},
+    {0.0f, 1052, 0, -1},
+    {0.0f, 1053, 0, -1},
+    {29.72888946533203f, 1911, 1914, 6},
+    {97.27430725097656f, 1912, 1913, 2},
+    {0.0f, 1054, 0, -1},
+    {0.0f, 1055, 0, -1},
+    {101.03472137451172f, 1915, 1918, 5},
+    {74.52081298828125f, 1916, 1917, 4},
+    {0.0f, 1056, 0, -1},
+    {0.0f, 1057, 0, -1},
+    {0.0f, 1058, 0, -1},
+    {101.03472137451172f, 1920, 1925, 5},
+    {75.19471740722656f, 1921, 1922, 7},
+    {0.0f, 1059, 0, -1},
+    {97.27430725097656f, 1923, 1924, 5},
+    {0.0f, 1060, 0, -1},
+    {0.0f, 1061, 0, -1},
+    {73.93911743164062f, 1926, 1927, 7},
+    {0.0f, 1062, 0, -1},
+    {0.0f, 1063, 0, -1},
+};
+
+static const uint16_t ROOTS[] = {
+    0, 9, 18, 27, 38, 47, 56, 65, 74, 81, 90, 101,
+    112, 125, 136, 143, 152, 161, 172, 181, 190, 199, 208, 217,
+    228, 239, 246, 251, 260, 271, 280, 291, 304, 313, 322, 333,
+    344, 355, 366, 377, 388, 399, 408, 419, 430, 441, 450, 457,
+    464, 473, 482, 495, 502, 509, 518, 529, 540, 547, 556, 563,
+    572, 579, 588, 595, 602, 615, 624, 631, 642, 653, 662, 671,
+    682, 689, 698, 709, 720, 729, 742, 755, 764, 775, 786, 795,
+    806, 815, 828, 839, 846, 853, 862, 873, 884, 895, 904, 913,
+    924, 935, 942, 951, 962, 971, 980, 989, 998, 1007, 1016, 1025,
+    1034, 1043, 1050, 1057, 1066, 1073, 1082, 1095, 1104, 1113, 1122, 1133,
+    1144, 1151, 1164, 1175, 1184, 1193, 1206, 1215, 1228, 1237, 1248, 1259,
+    1270, 1281, 1290, 1303, 1314, 1323, 1336, 1347, 1358, 1369, 1378, 1387,
+    1396, 1405, 1414, 1421, 1430, 1441, 1450, 1459, 1470, 1479, 1490, 1499,
+    1506, 1517, 1526, 1535, 1542, 1555, 1568, 1581, 1592, 1601, 1606, 1615,
+    1624, 1635, 1644, 1653, 1662, 1673, 1684, 1693, 1702, 1709, 1720, 1731,
+    1740, 1749, 1756, 1767, 1776, 1785, 1794, 1805, 1812, 1819, 1826, 1839,
+    1852, 1863, 1874, 1881, 1892, 1901, 1910, 1919,
+};
+
+static const float LEAF_VALUES[] = {
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.69649314880371f, 73.00680541992188f, 104.04513549804688f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.509445190429688f, 74.7236099243164f, 98.33680725097656f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    31.40913200378418f, 74.0670166015625f, 102.22222137451172f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+    31.559825897216797f, 73.81121826171875f, 101.98958587646484f,
+    30.899166107177734f, 74.58902740478516f, 98.59027862548828f,
+    31.242048263549805f, 74.45260620117188f, 100.07986450195312f,
+    31.7762508392334f, 72.99742889404297f, 105.26388549804688f,
+    31.762290954589844f, 73.27423858642578f, 103.84722137451172f,
+};
+
+const ForestModel NEXT_DAY_MODEL = {
+    NODES, ROOTS, LEAF_VALUES, 200, 1928, 1064, 9, 3,
+};
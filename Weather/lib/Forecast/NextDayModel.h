@@ -0,0 +1,21 @@
+#pragma once
+
+#include "QuantizedForest.h"
+#include "RandomForest.h"
+
+// The next-day forecaster from forecast_model.pkl, generated into
+// NextDayModel.cpp and NextDayModelQuantized.cpp by scripts/export_forest.py.
+//
+// Input is the daily means of the three previous days, most recent first:
+//   [temp, hum, aqi] of day t-1, then t-2, then t-3
+// Output is the predicted means for day t: temperature, humidity, aqi.
+static const uint8_t NEXT_DAY_LAGS = 3;
+static const uint8_t NEXT_DAY_FEATURES = 9;
+static const uint8_t NEXT_DAY_OUTPUTS = 3;
+
+// float32 copy of the forest; matches scikit-learn to float rounding
+extern const ForestModel NEXT_DAY_MODEL;
+
+// int16 copy, half the size, possibly pruned to a byte budget; what the
+// firmware runs
+extern const QuantizedForest NEXT_DAY_QUANTIZED;
@@ -0,0 +1,3029 @@
+// Generated by scripts/export_forest.py from forecast_model.pkl - do not edit.
+#include "NextDayModel.h"
+
+// 200 of 200 trees (budget 100%), 1928 nodes, 1064 leaves,
+// 18400 bytes
+static const QuantizedNode NODES[] = {
+    {19077, 1, 1},
+    {31616, 3, 6},
+    {23991, 5, 8},
+    {0, 0, 255},
+    {26402, 7, 5},
+    {0, 1, 255},
+    {0, 2, 255},
+    {26372, 9, 2},
+    {0, 3, 255},
+    {0, 4, 255},
+    {0, 5, 255},
+    {31441, 12, 3},
+    {24431, 14, 8},
+    {19010, 16, 4},
+    {0, 6, 255},
+    {0, 7, 255},
+    {32240, 18, 3},
+    {19077, 20, 4},
+    {0, 8, 255},
+    {0, 9, 255},
+    {0, 10, 255},
+    {0, 11, 255},
+    {19267, 23, 7},
+    {25894, 25, 5},
+    {30098, 27, 6},
+    {25206, 29, 8},
+    {26347, 31, 2},
+    {0, 12, 255},
+    {0, 13, 255},
+    {0, 14, 255},
+    {0, 15, 255},
+    {0, 16, 255},
+    {0, 17, 255},
+    {25206, 34, 5},
+    {31441, 36, 0},
+    {25397, 38, 8},
+    {24902, 40, 2},
+    {0, 18, 255},
+    {0, 19, 255},
+    {25864, 42, 8},
+    {0, 20, 255},
+    {0, 21, 255},
+    {0, 22, 255},
+    {0, 23, 255},
+    {19249, 45, 7},
+    {32240, 47, 0},
+    {30897, 49, 3},
+    {0, 24, 255},
+    {25894, 51, 8},
+    {0, 25, 255},
+    {0, 26, 255},
+    {0, 27, 255},
+    {0, 28, 255},
+    {25429, 54, 2},
+    {31096, 56, 0},
+    {18928, 58, 1},
+    {0, 29, 255},
+    {0, 30, 255},
+    {32490, 60, 0},
+    {25894, 62, 2},
+    {19010, 64, 7},
+    {0, 31, 255},
+    {0, 32, 255},
+    {0, 33, 255},
+    {0, 34, 255},
+    {0, 35, 255},
+    {31816, 67, 0},
+    {19267, 69, 4},
+    {19010, 71, 4},
+    {0, 36, 255},
+    {19267, 73, 1},
+    {0, 37, 255},
+    {19112, 75, 7},
+    {0, 38, 255},
+    {0, 39, 255},
+    {0, 40, 255},
+    {0, 41, 255},
+    {30817, 78, 3},
+    {0, 42, 255},
+    {19010, 80, 4},
+    {26402, 82, 5},
+    {0, 43, 255},
+    {32077, 84, 6},
+    {0, 44, 255},
+    {0, 45, 255},
+    {0, 46, 255},
+    {24934, 87, 8},
+    {19267, 89, 4},
+    {31901, 91, 6},
+    {0, 47, 255},
+    {30098, 93, 3},
+    {0, 48, 255},
+    {0, 49, 255},
+    {0, 50, 255},
+    {0, 51, 255},
+    {19077, 96, 1},
+    {18977, 98, 4},
+    {24934, 100, 2},
+    {32490, 102, 0},
+    {32077, 104, 0},
+    {0, 52, 255},
+    {0, 53, 255},
+    {0, 54, 255},
+    {0, 55, 255},
+    {0, 56, 255},
+    {0, 57, 255},
+    {31358, 107, 6},
+    {19112, 109, 1},
+    {18792, 111, 4},
+    {0, 58, 255},
+    {19410, 113, 4},
+    {0, 59, 255},
+    {0, 60, 255},
+    {0, 61, 255},
+    {0, 62, 255},
+    {19077, 116, 7},
+    {18792, 118, 4},
+    {25206, 120, 8},
+    {0, 63, 255},
+    {25894, 122, 8},
+    {0, 64, 255},
+    {0, 65, 255},
+    {0, 66, 255},
+    {0, 67, 255},
+    {25206, 125, 5},
+    {19272, 127, 4},
+    {25864, 129, 2},
+    {0, 68, 255},
+    {0, 69, 255},
+    {0, 70, 255},
+    {18977, 131, 7},
+    {0, 71, 255},
+    {0, 72, 255},
+    {31901, 134, 0},
+    {19410, 136, 7},
+    {26376, 138, 2},
+    {0, 73, 255},
+    {30098, 140, 3},
+    {0, 74, 255},
+    {18723, 142, 1},
+    {0, 75, 255},
+    {0, 76, 255},
+    {0, 77, 255},
+    {0, 78, 255},
+    {19094, 145, 1},
+    {25674, 147, 8},
+    {19267, 149, 1},
+    {25206, 151, 8},
+    {26610, 153, 2},
+    {0, 79, 255},
+    {0, 80, 255},
+    {0, 81, 255},
+    {0, 82, 255},
+    {0, 83, 255},
+    {0, 84, 255},
+    {31616, 156, 3},
+    {23991, 158, 8},
+    {19077, 160, 7},
+    {0, 85, 255},
+    {0, 86, 255},
+    {32240, 162, 6},
+    {0, 87, 255},
+    {26372, 164, 2},
+    {0, 88, 255},
+    {0, 89, 255},
+    {0, 90, 255},
+    {19010, 167, 4},
+    {32240, 169, 3},
+    {19267, 171, 7},
+    {0, 91, 255},
+    {0, 92, 255},
+    {19010, 173, 1},
+    {0, 93, 255},
+    {0, 94, 255},
+    {0, 95, 255},
+    {25397, 176, 2},
+    {19649, 178, 7},
+    {19077, 180, 7},
+    {0, 96, 255},
+    {0, 97, 255},
+    {32240, 182, 3},
+    {25894, 184, 2},
+    {0, 98, 255},
+    {0, 99, 255},
+    {0, 100, 255},
+    {0, 101, 255},
+    {31979, 187, 0},
+    {30098, 189, 6},
+    {18792, 191, 4},
+    {0, 102, 255},
+    {0, 103, 255},
+    {0, 104, 255},
+    {18928, 193, 4},
+    {0, 105, 255},
+    {0, 106, 255},
+    {19077, 196, 1},
+    {25674, 198, 5},
+    {30098, 200, 6},
+    {0, 107, 255},
+    {0, 108, 255},
+    {24902, 202, 2},
+    {0, 109, 255},
+    {0, 110, 255},
+    {0, 111, 255},
+    {31096, 205, 3},
+    {24902, 207, 2},
+    {25429, 209, 8},
+    {0, 112, 255},
+    {0, 113, 255},
+    {25206, 211, 8},
+    {32240, 213, 6},
+    {0, 114, 255},
+    {0, 115, 255},
+    {26372, 215, 2},
+    {0, 116, 255},
+    {0, 117, 255},
+    {0, 118, 255},
+    {19267, 218, 7},
+    {19027, 220, 4},
+    {24902, 222, 5},
+    {32420, 224, 0},
+    {0, 119, 255},
+    {0, 120, 255},
+    {0, 121, 255},
+    {0, 122, 255},
+    {0, 123, 255},
+    {24934, 227, 8},
+    {19410, 229, 7},
+    {25894, 231, 5},
+    {0, 124, 255},
+    {30098, 233, 3},
+    {0, 125, 255},
+    {0, 126, 255},
+    {0, 127, 255},
+    {0, 128, 255},
+    {19045, 236, 1},
+    {32154, 238, 3},
+    {30897, 240, 0},
+    {0, 129, 255},
+    {0, 130, 255},
+    {0, 131, 255},
+    {0, 132, 255},
+    {30442, 243, 6},
+    {0, 133, 255},
+    {25894, 245, 5},
+    {25429, 247, 5},
+    {0, 134, 255},
+    {0, 135, 255},
+    {0, 136, 255},
+    {19010, 250, 4},
+    {18928, 252, 7},
+    {25397, 254, 5},
+    {0, 137, 255},
+    {25894, 256, 8},
+    {0, 138, 255},
+    {0, 139, 255},
+    {0, 140, 255},
+    {0, 141, 255},
+    {25397, 259, 2},
+    {30897, 261, 0},
+    {19094, 263, 7},
+    {0, 142, 255},
+    {0, 143, 255},
+    {18928, 265, 7},
+    {0, 144, 255},
+    {0, 145, 255},
+    {26372, 267, 2},
+    {0, 146, 255},
+    {0, 147, 255},
+    {31816, 270, 0},
+    {30442, 272, 3},
+    {31901, 274, 3},
+    {0, 148, 255},
+    {0, 149, 255},
+    {0, 150, 255},
+    {18928, 276, 7},
+    {0, 151, 255},
+    {25894, 278, 8},
+    {0, 152, 255},
+    {0, 153, 255},
+    {19232, 281, 1},
+    {31816, 283, 6},
+    {0, 154, 255},
+    {32077, 285, 0},
+    {26139, 287, 5},
+    {0, 155, 255},
+    {0, 156, 255},
+    {0, 157, 255},
+    {0, 158, 255},
+    {24703, 290, 8},
+    {0, 159, 255},
+    {32154, 292, 0},
+    {0, 160, 255},
+    {32490, 294, 0},
+    {32387, 296, 0},
+    {0, 161, 255},
+    {0, 162, 255},
+    {0, 163, 255},
+    {19094, 299, 4},
+    {31816, 301, 6},
+    {19267, 303, 4},
+    {0, 164, 255},
+    {18928, 305, 7},
+    {0, 165, 255},
+    {0, 166, 255},
+    {0, 167, 255},
+    {32387, 307, 0},
+    {0, 168, 255},
+    {0, 169, 255},
+    {31441, 310, 3},
+    {25206, 312, 2},
+    {25864, 314, 5},
+    {19267, 316, 1},
+    {0, 170, 255},
+    {19010, 318, 1},
+    {0, 171, 255},
+    {0, 172, 255},
+    {0, 173, 255},
+    {0, 174, 255},
+    {0, 175, 255},
+    {18926, 321, 1},
+    {26610, 323, 2},
+    {19410, 325, 7},
+    {0, 176, 255},
+    {0, 177, 255},
+    {0, 178, 255},
+    {29093, 327, 6},
+    {0, 179, 255},
+    {0, 180, 255},
+    {24263, 330, 8},
+    {0, 181, 255},
+    {31816, 332, 6},
+    {32077, 334, 0},
+    {26372, 336, 2},
+    {0, 182, 255},
+    {0, 183, 255},
+    {0, 184, 255},
+    {0, 185, 255},
+    {19249, 339, 7},
+    {18859, 341, 1},
+    {19410, 343, 7},
+    {0, 186, 255},
+    {0, 187, 255},
+    {0, 188, 255},
+    {24431, 345, 5},
+    {0, 189, 255},
+    {0, 190, 255},
+    {25864, 348, 5},
+    {19077, 350, 1},
+    {18928, 352, 7},
+    {25429, 354, 5},
+    {25206, 356, 2},
+    {0, 191, 255},
+    {18792, 358, 1},
+    {0, 192, 255},
+    {0, 193, 255},
+    {0, 194, 255},
+    {0, 195, 255},
+    {0, 196, 255},
+    {0, 197, 255},
+    {31901, 361, 0},
+    {19112, 363, 1},
+    {19010, 365, 4},
+    {0, 198, 255},
+    {19267, 367, 1},
+    {0, 199, 255},
+    {0, 200, 255},
+    {0, 201, 255},
+    {0, 202, 255},
+    {25674, 370, 2},
+    {29548, 372, 6},
+    {31816, 374, 6},
+    {0, 203, 255},
+    {0, 204, 255},
+    {0, 205, 255},
+    {0, 206, 255},
+    {19094, 377, 4},
+    {32077, 379, 3},
+    {29548, 381, 6},
+    {0, 207, 255},
+    {26402, 383, 5},
+    {0, 208, 255},
+    {0, 209, 255},
+    {26372, 385, 2},
+    {0, 210, 255},
+    {0, 211, 255},
+    {0, 212, 255},
+    {31616, 388, 3},
+    {24902, 390, 5},
+    {31816, 392, 6},
+    {0, 213, 255},
+    {0, 214, 255},
+    {0, 215, 255},
+    {18928, 394, 7},
+    {0, 216, 255},
+    {18792, 396, 1},
+    {0, 217, 255},
+    {0, 218, 255},
+    {24934, 399, 8},
+    {19410, 401, 7},
+    {32240, 403, 0},
+    {0, 219, 255},
+    {19649, 405, 7},
+    {0, 220, 255},
+    {32154, 407, 6},
+    {0, 221, 255},
+    {0, 222, 255},
+    {0, 223, 255},
+    {0, 224, 255},
+    {18995, 410, 1},
+    {18928, 412, 7},
+    {19249, 414, 1},
+    {0, 225, 255},
+    {32077, 416, 6},
+    {0, 226, 255},
+    {0, 227, 255},
+    {0, 228, 255},
+    {0, 229, 255},
+    {19267, 419, 7},
+    {25429, 421, 8},
+    {31441, 423, 0},
+    {25206, 425, 8},
+    {0, 230, 255},
+    {0, 231, 255},
+    {0, 232, 255},
+    {0, 233, 255},
+    {0, 234, 255},
+    {25864, 428, 2},
+    {30897, 430, 6},
+    {32387, 432, 3},
+    {0, 235, 255},
+    {0, 236, 255},
+    {32387, 434, 0},
+    {0, 237, 255},
+    {0, 238, 255},
+    {0, 239, 255},
+    {31816, 437, 0},
+    {31441, 439, 0},
+    {25704, 441, 8},
+    {23792, 443, 8},
+    {0, 240, 255},
+    {25429, 445, 5},
+    {0, 241, 255},
+    {0, 242, 255},
+    {0, 243, 255},
+    {0, 244, 255},
+    {0, 245, 255},
+    {25397, 448, 5},
+    {19410, 450, 7},
+    {19010, 452, 4},
+    {0, 246, 255},
+    {19649, 454, 7},
+    {32154, 456, 6},
+    {0, 247, 255},
+    {0, 248, 255},
+    {0, 249, 255},
+    {0, 250, 255},
+    {0, 251, 255},
+    {31441, 459, 3},
+    {19112, 461, 1},
+    {32077, 463, 3},
+    {0, 252, 255},
+    {19649, 465, 7},
+    {19077, 467, 4},
+    {0, 253, 255},
+    {0, 254, 255},
+    {0, 255, 255},
+    {0, 256, 255},
+    {0, 257, 255},
+    {19249, 470, 4},
+    {19077, 472, 7},
+    {23792, 474, 8},
+    {18792, 476, 4},
+    {25429, 478, 5},
+    {0, 258, 255},
+    {0, 259, 255},
+    {0, 260, 255},
+    {32387, 480, 0},
+    {0, 261, 255},
+    {0, 262, 255},
+    {0, 263, 255},
+    {0, 264, 255},
+    {19077, 483, 1},
+    {26376, 485, 2},
+    {19112, 487, 1},
+    {31816, 489, 3},
+    {26610, 491, 2},
+    {0, 265, 255},
+    {19410, 493, 4},
+    {0, 266, 255},
+    {0, 267, 255},
+    {0, 268, 255},
+    {0, 269, 255},
+    {0, 270, 255},
+    {0, 271, 255},
+    {24703, 496, 8},
+    {29093, 498, 6},
+    {31616, 500, 6},
+    {0, 272, 255},
+    {0, 273, 255},
+    {0, 274, 255},
+    {26372, 502, 2},
+    {0, 275, 255},
+    {0, 276, 255},
+    {18928, 505, 1},
+    {26402, 507, 5},
+    {25397, 509, 5},
+    {0, 277, 255},
+    {0, 278, 255},
+    {0, 279, 255},
+    {0, 280, 255},
+    {19255, 512, 7},
+    {32240, 514, 0},
+    {0, 281, 255},
+    {0, 282, 255},
+    {32240, 516, 3},
+    {0, 283, 255},
+    {0, 284, 255},
+    {31901, 519, 0},
+    {30098, 521, 6},
+    {31979, 523, 6},
+    {19267, 525, 1},
+    {0, 285, 255},
+    {0, 286, 255},
+    {0, 287, 255},
+    {0, 288, 255},
+    {0, 289, 255},
+    {25397, 528, 2},
+    {30098, 530, 3},
+    {25429, 532, 8},
+    {0, 290, 255},
+    {0, 291, 255},
+    {19112, 534, 7},
+    {0, 292, 255},
+    {0, 293, 255},
+    {0, 294, 255},
+    {19077, 537, 1},
+    {32077, 539, 3},
+    {31441, 541, 0},
+    {25206, 543, 8},
+    {0, 295, 255},
+    {0, 296, 255},
+    {0, 297, 255},
+    {0, 298, 255},
+    {0, 299, 255},
+    {19094, 546, 7},
+    {32240, 548, 6},
+    {31441, 550, 3},
+    {25894, 552, 8},
+    {0, 300, 255},
+    {0, 301, 255},
+    {0, 302, 255},
+    {0, 303, 255},
+    {0, 304, 255},
+    {29892, 555, 6},
+    {0, 305, 255},
+    {32240, 557, 0},
+    {31816, 559, 3},
+    {32387, 561, 0},
+    {0, 306, 255},
+    {0, 307, 255},
+    {0, 308, 255},
+    {0, 309, 255},
+    {25206, 564, 5},
+    {19249, 566, 1},
+    {19010, 568, 4},
+    {0, 310, 255},
+    {0, 311, 255},
+    {18826, 570, 1},
+    {25894, 572, 2},
+    {0, 312, 255},
+    {0, 313, 255},
+    {0, 314, 255},
+    {0, 315, 255},
+    {32240, 575, 0},
+    {31616, 577, 3},
+    {18792, 579, 4},
+    {0, 316, 255},
+    {0, 317, 255},
+    {0, 318, 255},
+    {26372, 581, 2},
+    {0, 319, 255},
+    {0, 320, 255},
+    {19506, 584, 7},
+    {18928, 586, 1},
+    {0, 321, 255},
+    {18792, 588, 4},
+    {31441, 590, 6},
+    {0, 322, 255},
+    {32387, 592, 0},
+    {0, 323, 255},
+    {0, 324, 255},
+    {0, 325, 255},
+    {0, 326, 255},
+    {25429, 595, 2},
+    {31441, 597, 0},
+    {25894, 599, 5},
+    {24902, 601, 2},
+    {0, 327, 255},
+    {19112, 603, 7},
+    {32420, 605, 0},
+    {0, 328, 255},
+    {0, 329, 255},
+    {0, 330, 255},
+    {0, 331, 255},
+    {0, 332, 255},
+    {0, 333, 255},
+    {31272, 608, 3},
+    {30098, 610, 3},
+    {19027, 612, 7},
+    {0, 334, 255},
+    {0, 335, 255},
+    {26610, 614, 2},
+    {0, 336, 255},
+    {0, 337, 255},
+    {0, 338, 255},
+    {25641, 617, 8},
+    {19112, 619, 4},
+    {18792, 621, 4},
+    {0, 339, 255},
+    {0, 340, 255},
+    {0, 341, 255},
+    {0, 342, 255},
+    {19094, 624, 1},
+    {31901, 626, 3},
+    {19649, 628, 7},
+    {0, 343, 255},
+    {25864, 630, 8},
+    {0, 344, 255},
+    {0, 345, 255},
+    {0, 346, 255},
+    {0, 347, 255},
+    {31616, 633, 0},
+    {0, 348, 255},
+    {18928, 635, 1},
+    {18928, 637, 7},
+    {25429, 639, 5},
+    {0, 349, 255},
+    {26372, 641, 2},
+    {0, 350, 255},
+    {0, 351, 255},
+    {0, 352, 255},
+    {0, 353, 255},
+    {25429, 644, 2},
+    {19410, 646, 7},
+    {25894, 648, 5},
+    {0, 354, 255},
+    {19649, 650, 7},
+    {25429, 652, 5},
+    {0, 355, 255},
+    {0, 356, 255},
+    {0, 357, 255},
+    {0, 358, 255},
+    {0, 359, 255},
+    {19094, 655, 4},
+    {19010, 657, 4},
+    {31441, 659, 0},
+    {26402, 661, 5},
+    {0, 360, 255},
+    {30897, 663, 0},
+    {0, 361, 255},
+    {0, 362, 255},
+    {0, 363, 255},
+    {0, 364, 255},
+    {0, 365, 255},
+    {31779, 666, 3},
+    {19112, 668, 1},
+    {26372, 670, 5},
+    {0, 366, 255},
+    {24902, 672, 2},
+    {0, 367, 255},
+    {0, 368, 255},
+    {0, 369, 255},
+    {0, 370, 255},
+    {30897, 675, 6},
+    {31096, 677, 0},
+    {18977, 679, 4},
+    {0, 371, 255},
+    {0, 372, 255},
+    {32240, 681, 6},
+    {19112, 683, 7},
+    {0, 373, 255},
+    {0, 374, 255},
+    {0, 375, 255},
+    {0, 376, 255},
+    {19027, 686, 1},
+    {25864, 688, 5},
+    {19112, 690, 1},
+    {0, 377, 255},
+    {32077, 692, 6},
+    {0, 378, 255},
+    {24431, 694, 5},
+    {0, 379, 255},
+    {0, 380, 255},
+    {0, 381, 255},
+    {0, 382, 255},
+    {24902, 697, 8},
+    {25206, 699, 2},
+    {25671, 701, 8},
+    {0, 383, 255},
+    {0, 384, 255},
+    {0, 385, 255},
+    {0, 386, 255},
+    {19267, 704, 7},
+    {25864, 706, 5},
+    {25206, 708, 2},
+    {25894, 710, 2},
+    {32387, 712, 3},
+    {0, 387, 255},
+    {0, 388, 255},
+    {0, 389, 255},
+    {0, 390, 255},
+    {26372, 714, 2},
+    {0, 391, 255},
+    {0, 392, 255},
+    {0, 393, 255},
+    {31816, 717, 0},
+    {0, 394, 255},
+    {32077, 719, 0},
+    {0, 395, 255},
+    {0, 396, 255},
+    {31901, 722, 3},
+    {19267, 724, 7},
+    {32420, 726, 0},
+    {0, 397, 255},
+    {30442, 728, 3},
+    {0, 398, 255},
+    {0, 399, 255},
+    {0, 400, 255},
+    {0, 401, 255},
+    {25641, 731, 2},
+    {19267, 733, 1},
+    {18928, 735, 1},
+    {0, 402, 255},
+    {0, 403, 255},
+    {18792, 737, 4},
+    {0, 404, 255},
+    {0, 405, 255},
+    {32077, 739, 6},
+    {0, 406, 255},
+    {0, 407, 255},
+    {19249, 742, 4},
+    {32240, 744, 0},
+    {19410, 746, 4},
+    {32077, 748, 0},
+    {0, 408, 255},
+    {0, 409, 255},
+    {0, 410, 255},
+    {0, 411, 255},
+    {0, 412, 255},
+    {25206, 751, 5},
+    {24431, 753, 8},
+    {19094, 755, 7},
+    {0, 413, 255},
+    {0, 414, 255},
+    {0, 415, 255},
+    {0, 416, 255},
+    {31702, 758, 0},
+    {0, 417, 255},
+    {18928, 760, 1},
+    {32310, 762, 3},
+    {0, 418, 255},
+    {0, 419, 255},
+    {0, 420, 255},
+    {31816, 765, 6},
+    {19272, 767, 7},
+    {18977, 769, 7},
+    {19112, 771, 7},
+    {0, 421, 255},
+    {0, 422, 255},
+    {0, 423, 255},
+    {0, 424, 255},
+    {0, 425, 255},
+    {19077, 774, 1},
+    {32077, 776, 3},
+    {24431, 778, 8},
+    {25894, 780, 2},
+    {0, 426, 255},
+    {19649, 782, 7},
+    {0, 427, 255},
+    {0, 428, 255},
+    {0, 429, 255},
+    {0, 430, 255},
+    {0, 431, 255},
+    {25206, 785, 5},
+    {24934, 787, 2},
+    {31901, 789, 3},
+    {0, 432, 255},
+    {0, 433, 255},
+    {0, 434, 255},
+    {25864, 791, 8},
+    {0, 435, 255},
+    {0, 436, 255},
+    {19010, 794, 4},
+    {32387, 796, 0},
+    {24902, 798, 8},
+    {0, 437, 255},
+    {0, 438, 255},
+    {0, 439, 255},
+    {25429, 800, 5},
+    {0, 440, 255},
+    {0, 441, 255},
+    {31096, 803, 3},
+    {0, 442, 255},
+    {19077, 805, 7},
+    {18792, 807, 4},
+    {32077, 809, 0},
+    {0, 443, 255},
+    {25894, 811, 8},
+    {0, 444, 255},
+    {0, 445, 255},
+    {0, 446, 255},
+    {0, 447, 255},
+    {19077, 814, 1},
+    {31616, 816, 6},
+    {31096, 818, 0},
+    {0, 448, 255},
+    {18826, 820, 1},
+    {0, 449, 255},
+    {0, 450, 255},
+    {0, 451, 255},
+    {0, 452, 255},
+    {24703, 823, 8},
+    {30098, 825, 3},
+    {19094, 827, 7},
+    {0, 453, 255},
+    {0, 454, 255},
+    {0, 455, 255},
+    {0, 456, 255},
+    {25397, 830, 2},
+    {29093, 832, 6},
+    {19010, 834, 4},
+    {0, 457, 255},
+    {0, 458, 255},
+    {19010, 836, 7},
+    {19010, 838, 1},
+    {0, 459, 255},
+    {0, 460, 255},
+    {0, 461, 255},
+    {0, 462, 255},
+    {31979, 841, 0},
+    {19112, 843, 1},
+    {26402, 845, 5},
+    {0, 463, 255},
+    {29093, 847, 6},
+    {32240, 849, 3},
+    {0, 464, 255},
+    {0, 465, 255},
+    {0, 466, 255},
+    {0, 467, 255},
+    {0, 468, 255},
+    {19267, 852, 7},
+    {19077, 854, 7},
+    {19249, 856, 1},
+    {18826, 858, 1},
+    {31816, 860, 3},
+    {0, 469, 255},
+    {0, 470, 255},
+    {0, 471, 255},
+    {0, 472, 255},
+    {0, 473, 255},
+    {0, 474, 255},
+    {30442, 863, 6},
+    {24902, 865, 2},
+    {25864, 867, 5},
+    {0, 475, 255},
+    {0, 476, 255},
+    {19077, 869, 4},
+    {0, 477, 255},
+    {0, 478, 255},
+    {0, 479, 255},
+    {24902, 872, 8},
+    {30897, 874, 3},
+    {25674, 876, 5},
+    {30098, 878, 3},
+    {0, 480, 255},
+    {0, 481, 255},
+    {32240, 880, 6},
+    {0, 482, 255},
+    {0, 483, 255},
+    {0, 484, 255},
+    {0, 485, 255},
+    {19045, 883, 1},
+    {18928, 885, 1},
+    {0, 486, 255},
+    {32240, 887, 3},
+    {0, 487, 255},
+    {0, 488, 255},
+    {0, 489, 255},
+    {31441, 890, 3},
+    {19267, 892, 4},
+    {26376, 894, 2},
+    {0, 490, 255},
+    {0, 491, 255},
+    {31816, 896, 3},
+    {0, 492, 255},
+    {0, 493, 255},
+    {0, 494, 255},
+    {25429, 899, 8},
+    {19077, 901, 4},
+    {32077, 903, 6},
+    {0, 495, 255},
+    {0, 496, 255},
+    {0, 497, 255},
+    {0, 498, 255},
+    {19255, 906, 7},
+    {18825, 908, 1},
+    {19267, 910, 1},
+    {0, 499, 255},
+    {0, 500, 255},
+    {0, 501, 255},
+    {0, 502, 255},
+    {25704, 913, 2},
+    {24902, 915, 5},
+    {31901, 917, 6},
+    {30897, 919, 0},
+    {0, 503, 255},
+    {0, 504, 255},
+    {18928, 921, 7},
+    {0, 505, 255},
+    {0, 506, 255},
+    {0, 507, 255},
+    {0, 508, 255},
+    {31272, 924, 0},
+    {0, 509, 255},
+    {25397, 926, 8},
+    {0, 510, 255},
+    {32387, 928, 3},
+    {25894, 930, 8},
+    {0, 511, 255},
+    {0, 512, 255},
+    {0, 513, 255},
+    {19077, 933, 1},
+    {25429, 935, 8},
+    {24934, 937, 2},
+    {19077, 939, 4},
+    {18792, 941, 4},
+    {0, 514, 255},
+    {0, 515, 255},
+    {0, 516, 255},
+    {0, 517, 255},
+    {0, 518, 255},
+    {26139, 943, 5},
+    {0, 519, 255},
+    {0, 520, 255},
+    {32224, 946, 3},
+    {30897, 948, 6},
+    {0, 521, 255},
+    {30897, 950, 3},
+    {32077, 952, 0},
+    {0, 522, 255},
+    {0, 523, 255},
+    {0, 524, 255},
+    {0, 525, 255},
+    {19255, 955, 4},
+    {25641, 957, 8},
+    {0, 526, 255},
+    {0, 527, 255},
+    {18928, 959, 7},
+    {0, 528, 255},
+    {0, 529, 255},
+    {25206, 962, 5},
+    {31441, 964, 0},
+    {25674, 966, 5},
+    {19649, 968, 7},
+    {0, 530, 255},
+    {0, 531, 255},
+    {32240, 970, 3},
+    {0, 532, 255},
+    {0, 533, 255},
+    {0, 534, 255},
+    {0, 535, 255},
+    {19077, 973, 1},
+    {19077, 975, 7},
+    {23991, 977, 8},
+    {25894, 979, 8},
+    {31441, 981, 6},
+    {0, 536, 255},
+    {0, 537, 255},
+    {0, 538, 255},
+    {0, 539, 255},
+    {0, 540, 255},
+    {0, 541, 255},
+    {19267, 984, 7},
+    {25864, 986, 2},
+    {24934, 988, 2},
+    {0, 542, 255},
+    {0, 543, 255},
+    {0, 544, 255},
+    {0, 545, 255},
+    {31901, 991, 0},
+    {25206, 993, 2},
+    {32310, 995, 0},
+    {30098, 997, 3},
+    {0, 546, 255},
+    {0, 547, 255},
+    {18928, 999, 7},
+    {0, 548, 255},
+    {0, 549, 255},
+    {0, 550, 255},
+    {0, 551, 255},
+    {31441, 1002, 3},
+    {19643, 1004, 7},
+    {18977, 1006, 4},
+    {0, 552, 255},
+    {0, 553, 255},
+    {18928, 1008, 7},
+    {25429, 1010, 5},
+    {0, 554, 255},
+    {0, 555, 255},
+    {0, 556, 255},
+    {0, 557, 255},
+    {25429, 1013, 2},
+    {24902, 1015, 5},
+    {19027, 1017, 4},
+    {0, 558, 255},
+    {0, 559, 255},
+    {0, 560, 255},
+    {0, 561, 255},
+    {30641, 1020, 6},
+    {30897, 1022, 0},
+    {25864, 1024, 5},
+    {0, 562, 255},
+    {0, 563, 255},
+    {0, 564, 255},
+    {32490, 1026, 0},
+    {32240, 1028, 3},
+    {0, 565, 255},
+    {0, 566, 255},
+    {0, 567, 255},
+    {18928, 1031, 1},
+    {18826, 1033, 1},
+    {19267, 1035, 7},
+    {0, 568, 255},
+    {0, 569, 255},
+    {32077, 1037, 0},
+    {0, 570, 255},
+    {0, 571, 255},
+    {0, 572, 255},
+    {24902, 1040, 8},
+    {30897, 1042, 3},
+    {32154, 1044, 3},
+    {0, 573, 255},
+    {0, 574, 255},
+    {19112, 1046, 7},
+    {0, 575, 255},
+    {0, 576, 255},
+    {0, 577, 255},
+    {19094, 1049, 1},
+    {25864, 1051, 2},
+    {19649, 1053, 7},
+    {0, 578, 255},
+    {32240, 1055, 6},
+    {0, 579, 255},
+    {0, 580, 255},
+    {32240, 1057, 3},
+    {0, 581, 255},
+    {0, 582, 255},
+    {0, 583, 255},
+    {32048, 1060, 0},
+    {24431, 1062, 8},
+    {32387, 1064, 3},
+    {30098, 1066, 3},
+    {0, 584, 255},
+    {0, 585, 255},
+    {0, 586, 255},
+    {0, 587, 255},
+    {0, 588, 255},
+    {25429, 1069, 2},
+    {19410, 1071, 7},
+    {25937, 1073, 5},
+    {0, 589, 255},
+    {24902, 1075, 2},
+    {0, 590, 255},
+    {0, 591, 255},
+    {0, 592, 255},
+    {0, 593, 255},
+    {19255, 1078, 7},
+    {25429, 1080, 8},
+    {24431, 1082, 5},
+    {0, 594, 255},
+    {18928, 1084, 4},
+    {0, 595, 255},
+    {0, 596, 255},
+    {0, 597, 255},
+    {0, 598, 255},
+    {19045, 1087, 4},
+    {32387, 1089, 3},
+    {30897, 1091, 3},
+    {26372, 1093, 2},
+    {0, 599, 255},
+    {0, 600, 255},
+    {0, 601, 255},
+    {0, 602, 255},
+    {0, 603, 255},
+    {25206, 1096, 5},
+    {30897, 1098, 3},
+    {32077, 1100, 3},
+    {0, 604, 255},
+    {0, 605, 255},
+    {25429, 1102, 5},
+    {0, 606, 255},
+    {0, 607, 255},
+    {0, 608, 255},
+    {31616, 1105, 0},
+    {24431, 1107, 5},
+    {18977, 1109, 1},
+    {0, 609, 255},
+    {0, 610, 255},
+    {18792, 1111, 4},
+    {0, 611, 255},
+    {0, 612, 255},
+    {18792, 1113, 1},
+    {0, 613, 255},
+    {0, 614, 255},
+    {31441, 1116, 3},
+    {25206, 1118, 2},
+    {31816, 1120, 6},
+    {23792, 1122, 8},
+    {0, 615, 255},
+    {25206, 1124, 8},
+    {32240, 1126, 3},
+    {0, 616, 255},
+    {0, 617, 255},
+    {0, 618, 255},
+    {0, 619, 255},
+    {0, 620, 255},
+    {0, 621, 255},
+    {19094, 1129, 1},
+    {18928, 1131, 1},
+    {30897, 1133, 0},
+    {18928, 1135, 7},
+    {31816, 1137, 3},
+    {0, 622, 255},
+    {0, 623, 255},
+    {0, 624, 255},
+    {32240, 1139, 3},
+    {0, 625, 255},
+    {0, 626, 255},
+    {0, 627, 255},
+    {0, 628, 255},
+    {24703, 1142, 8},
+    {0, 629, 255},
+    {31816, 1144, 6},
+    {31816, 1146, 3},
+    {26372, 1148, 2},
+    {0, 630, 255},
+    {0, 631, 255},
+    {0, 632, 255},
+    {0, 633, 255},
+    {25674, 1151, 2},
+    {19112, 1153, 1},
+    {19010, 1155, 7},
+    {0, 634, 255},
+    {24902, 1157, 2},
+    {0, 635, 255},
+    {0, 636, 255},
+    {0, 637, 255},
+    {0, 638, 255},
+    {32310, 1160, 0},
+    {19077, 1162, 1},
+    {18792, 1164, 4},
+    {19112, 1166, 7},
+    {0, 639, 255},
+    {0, 640, 255},
+    {0, 641, 255},
+    {0, 642, 255},
+    {0, 643, 255},
+    {19267, 1169, 7},
+    {18874, 1171, 4},
+    {19643, 1173, 7},
+    {0, 644, 255},
+    {19010, 1175, 1},
+    {0, 645, 255},
+    {0, 646, 255},
+    {0, 647, 255},
+    {0, 648, 255},
+    {31616, 1178, 3},
+    {24902, 1180, 5},
+    {25429, 1182, 8},
+    {19267, 1184, 1},
+    {0, 649, 255},
+    {0, 650, 255},
+    {32490, 1186, 0},
+    {0, 651, 255},
+    {0, 652, 255},
+    {32077, 1188, 6},
+    {0, 653, 255},
+    {0, 654, 255},
+    {0, 655, 255},
+    {30442, 1191, 6},
+    {24902, 1193, 2},
+    {25864, 1195, 5},
+    {0, 656, 255},
+    {0, 657, 255},
+    {19077, 1197, 4},
+    {0, 658, 255},
+    {0, 659, 255},
+    {0, 660, 255},
+    {31979, 1200, 0},
+    {19267, 1202, 4},
+    {26402, 1204, 5},
+    {0, 661, 255},
+    {24431, 1206, 5},
+    {32387, 1208, 0},
+    {0, 662, 255},
+    {0, 663, 255},
+    {0, 664, 255},
+    {0, 665, 255},
+    {0, 666, 255},
+    {19027, 1211, 1},
+    {19077, 1213, 7},
+    {19112, 1215, 1},
+    {0, 667, 255},
+    {0, 668, 255},
+    {0, 669, 255},
+    {0, 670, 255},
+    {25429, 1218, 2},
+    {19410, 1220, 7},
+    {25641, 1222, 8},
+    {0, 671, 255},
+    {29093, 1224, 6},
+    {0, 672, 255},
+    {0, 673, 255},
+    {0, 674, 255},
+    {0, 675, 255},
+    {31616, 1227, 3},
+    {31441, 1229, 0},
+    {32077, 1231, 3},
+    {30897, 1233, 0},
+    {0, 676, 255},
+    {0, 677, 255},
+    {18928, 1235, 7},
+    {0, 678, 255},
+    {0, 679, 255},
+    {0, 680, 255},
+    {26139, 1237, 5},
+    {0, 681, 255},
+    {0, 682, 255},
+    {18928, 1240, 1},
+    {32077, 1242, 6},
+    {19267, 1244, 7},
+    {0, 683, 255},
+    {0, 684, 255},
+    {19010, 1246, 1},
+    {0, 685, 255},
+    {0, 686, 255},
+    {0, 687, 255},
+    {19255, 1249, 4},
+    {25429, 1251, 8},
+    {0, 688, 255},
+    {19010, 1253, 1},
+    {18825, 1255, 4},
+    {0, 689, 255},
+    {0, 690, 255},
+    {0, 691, 255},
+    {0, 692, 255},
+    {24902, 1258, 8},
+    {31096, 1260, 0},
+    {19077, 1262, 7},
+    {0, 693, 255},
+    {0, 694, 255},
+    {0, 695, 255},
+    {19010, 1264, 1},
+    {0, 696, 255},
+    {0, 697, 255},
+    {30897, 1267, 6},
+    {24902, 1269, 5},
+    {26128, 1271, 2},
+    {30098, 1273, 3},
+    {0, 698, 255},
+    {0, 699, 255},
+    {0, 700, 255},
+    {0, 701, 255},
+    {0, 702, 255},
+    {19094, 1276, 1},
+    {19094, 1278, 7},
+    {0, 703, 255},
+    {26372, 1280, 2},
+    {0, 704, 255},
+    {0, 705, 255},
+    {0, 706, 255},
+    {31816, 1283, 0},
+    {30897, 1285, 3},
+    {25429, 1287, 8},
+    {29093, 1289, 6},
+    {0, 707, 255},
+    {19112, 1291, 7},
+    {18792, 1293, 1},
+    {0, 708, 255},
+    {0, 709, 255},
+    {0, 710, 255},
+    {0, 711, 255},
+    {0, 712, 255},
+    {0, 713, 255},
+    {25864, 1296, 5},
+    {19249, 1298, 7},
+    {18928, 1300, 7},
+    {0, 714, 255},
+    {24902, 1302, 5},
+    {0, 715, 255},
+    {0, 716, 255},
+    {0, 717, 255},
+    {0, 718, 255},
+    {25641, 1305, 2},
+    {23792, 1307, 8},
+    {18928, 1309, 1},
+    {0, 719, 255},
+    {0, 720, 255},
+    {26372, 1311, 2},
+    {0, 721, 255},
+    {0, 722, 255},
+    {0, 723, 255},
+    {19267, 1314, 7},
+    {31816, 1316, 6},
+    {31441, 1318, 0},
+    {19077, 1320, 4},
+    {32420, 1322, 0},
+    {24902, 1324, 2},
+    {0, 724, 255},
+    {0, 725, 255},
+    {0, 726, 255},
+    {0, 727, 255},
+    {0, 728, 255},
+    {0, 729, 255},
+    {0, 730, 255},
+    {19045, 1327, 4},
+    {18977, 1329, 7},
+    {23991, 1331, 8},
+    {0, 731, 255},
+    {0, 732, 255},
+    {0, 733, 255},
+    {0, 734, 255},
+    {19077, 1334, 1},
+    {31816, 1336, 6},
+    {19112, 1338, 1},
+    {19112, 1340, 7},
+    {26347, 1342, 2},
+    {0, 735, 255},
+    {29093, 1344, 6},
+    {0, 736, 255},
+    {0, 737, 255},
+    {0, 738, 255},
+    {0, 739, 255},
+    {0, 740, 255},
+    {0, 741, 255},
+    {32240, 1347, 0},
+    {24934, 1349, 8},
+    {32490, 1351, 0},
+    {0, 742, 255},
+    {0, 743, 255},
+    {32240, 1353, 3},
+    {0, 744, 255},
+    {0, 745, 255},
+    {0, 746, 255},
+    {31096, 1356, 3},
+    {24902, 1358, 2},
+    {25429, 1360, 8},
+    {0, 747, 255},
+    {0, 748, 255},
+    {19077, 1362, 4},
+    {25894, 1364, 8},
+    {0, 749, 255},
+    {0, 750, 255},
+    {0, 751, 255},
+    {0, 752, 255},
+    {24736, 1367, 5},
+    {0, 753, 255},
+    {31816, 1369, 6},
+    {25894, 1371, 2},
+    {32490, 1373, 0},
+    {0, 754, 255},
+    {0, 755, 255},
+    {25894, 1375, 8},
+    {0, 756, 255},
+    {0, 757, 255},
+    {0, 758, 255},
+    {19077, 1378, 1},
+    {31901, 1380, 3},
+    {30098, 1382, 6},
+    {0, 759, 255},
+    {0, 760, 255},
+    {30897, 1384, 0},
+    {0, 761, 255},
+    {0, 762, 255},
+    {0, 763, 255},
+    {19027, 1387, 7},
+    {18928, 1389, 7},
+    {31616, 1391, 3},
+    {0, 764, 255},
+    {0, 765, 255},
+    {19643, 1393, 7},
+    {0, 766, 255},
+    {0, 767, 255},
+    {0, 768, 255},
+    {24902, 1396, 8},
+    {24934, 1398, 2},
+    {26102, 1400, 2},
+    {0, 769, 255},
+    {0, 770, 255},
+    {0, 771, 255},
+    {0, 772, 255},
+    {31358, 1403, 0},
+    {0, 773, 255},
+    {19010, 1405, 4},
+    {32420, 1407, 0},
+    {0, 774, 255},
+    {0, 775, 255},
+    {0, 776, 255},
+    {19027, 1410, 1},
+    {25429, 1412, 8},
+    {19410, 1414, 7},
+    {0, 777, 255},
+    {26372, 1416, 2},
+    {0, 778, 255},
+    {23792, 1418, 8},
+    {0, 779, 255},
+    {0, 780, 255},
+    {0, 781, 255},
+    {0, 782, 255},
+    {31702, 1421, 6},
+    {30897, 1423, 6},
+    {26372, 1425, 5},
+    {0, 783, 255},
+    {0, 784, 255},
+    {0, 785, 255},
+    {0, 786, 255},
+    {25397, 1428, 2},
+    {24902, 1430, 2},
+    {25864, 1432, 5},
+    {0, 787, 255},
+    {0, 788, 255},
+    {19010, 1434, 1},
+    {26139, 1436, 5},
+    {0, 789, 255},
+    {0, 790, 255},
+    {0, 791, 255},
+    {0, 792, 255},
+    {19077, 1439, 7},
+    {18977, 1441, 7},
+    {31441, 1443, 3},
+    {0, 793, 255},
+    {0, 794, 255},
+    {0, 795, 255},
+    {32077, 1445, 0},
+    {0, 796, 255},
+    {0, 797, 255},
+    {19010, 1448, 4},
+    {18928, 1450, 7},
+    {19112, 1452, 4},
+    {0, 798, 255},
+    {25894, 1454, 8},
+    {25429, 1456, 5},
+    {30897, 1458, 3},
+    {0, 799, 255},
+    {0, 800, 255},
+    {0, 801, 255},
+    {0, 802, 255},
+    {0, 803, 255},
+    {0, 804, 255},
+    {19094, 1461, 1},
+    {32154, 1463, 3},
+    {19267, 1465, 1},
+    {31816, 1467, 3},
+    {0, 805, 255},
+    {0, 806, 255},
+    {0, 807, 255},
+    {0, 808, 255},
+    {0, 809, 255},
+    {31272, 1470, 0},
+    {0, 810, 255},
+    {25674, 1472, 8},
+    {19077, 1474, 4},
+    {0, 811, 255},
+    {0, 812, 255},
+    {0, 813, 255},
+    {25206, 1477, 5},
+    {24902, 1479, 5},
+    {31901, 1481, 6},
+    {0, 814, 255},
+    {0, 815, 255},
+    {31816, 1483, 3},
+    {0, 816, 255},
+    {0, 817, 255},
+    {0, 818, 255},
+    {25429, 1486, 2},
+    {30897, 1488, 3},
+    {32077, 1490, 3},
+    {0, 819, 255},
+    {0, 820, 255},
+    {19077, 1492, 4},
+    {0, 821, 255},
+    {0, 822, 255},
+    {0, 823, 255},
+    {19255, 1495, 7},
+    {32154, 1497, 3},
+    {0, 824, 255},
+    {0, 825, 255},
+    {18792, 1499, 4},
+    {0, 826, 255},
+    {0, 827, 255},
+    {32310, 1502, 0},
+    {19010, 1504, 1},
+    {18723, 1506, 1},
+    {0, 828, 255},
+    {0, 829, 255},
+    {0, 830, 255},
+    {0, 831, 255},
+    {19094, 1509, 1},
+    {19027, 1511, 4},
+    {19267, 1513, 1},
+    {32490, 1515, 0},
+    {0, 832, 255},
+    {0, 833, 255},
+    {0, 834, 255},
+    {32077, 1517, 6},
+    {0, 835, 255},
+    {0, 836, 255},
+    {0, 837, 255},
+    {24703, 1520, 8},
+    {30897, 1522, 0},
+    {32077, 1524, 3},
+    {0, 838, 255},
+    {0, 839, 255},
+    {25206, 1526, 8},
+    {0, 840, 255},
+    {0, 841, 255},
+    {0, 842, 255},
+    {30442, 1529, 6},
+    {19649, 1531, 7},
+    {26102, 1533, 2},
+    {0, 843, 255},
+    {0, 844, 255},
+    {0, 845, 255},
+    {26610, 1535, 2},
+    {0, 846, 255},
+    {0, 847, 255},
+    {25641, 1538, 5},
+    {19112, 1540, 1},
+    {18928, 1542, 7},
+    {0, 848, 255},
+    {30897, 1544, 0},
+    {0, 849, 255},
+    {25894, 1546, 8},
+    {0, 850, 255},
+    {0, 851, 255},
+    {0, 852, 255},
+    {0, 853, 255},
+    {31358, 1549, 3},
+    {23792, 1551, 8},
+    {32310, 1553, 3},
+    {0, 854, 255},
+    {0, 855, 255},
+    {0, 856, 255},
+    {0, 857, 255},
+    {19232, 1556, 4},
+    {32154, 1558, 3},
+    {24902, 1560, 2},
+    {0, 858, 255},
+    {18792, 1562, 4},
+    {0, 859, 255},
+    {0, 860, 255},
+    {0, 861, 255},
+    {0, 862, 255},
+    {18995, 1565, 1},
+    {26402, 1567, 5},
+    {23991, 1569, 8},
+    {32240, 1571, 3},
+    {0, 863, 255},
+    {0, 864, 255},
+    {0, 865, 255},
+    {0, 866, 255},
+    {0, 867, 255},
+    {31816, 1574, 0},
+    {30442, 1576, 3},
+    {19094, 1578, 7},
+    {0, 868, 255},
+    {0, 869, 255},
+    {26372, 1580, 2},
+    {0, 870, 255},
+    {0, 871, 255},
+    {0, 872, 255},
+    {25641, 1583, 2},
+    {24431, 1585, 5},
+    {19077, 1587, 7},
+    {0, 873, 255},
+    {0, 874, 255},
+    {32077, 1589, 6},
+    {0, 875, 255},
+    {0, 876, 255},
+    {0, 877, 255},
+    {19267, 1592, 7},
+    {26128, 1594, 2},
+    {31441, 1596, 0},
+    {0, 878, 255},
+    {0, 879, 255},
+    {24902, 1598, 2},
+    {0, 880, 255},
+    {0, 881, 255},
+    {0, 882, 255},
+    {25641, 1601, 8},
+    {31441, 1603, 3},
+    {0, 883, 255},
+    {30098, 1605, 6},
+    {0, 884, 255},
+    {0, 885, 255},
+    {0, 886, 255},
+    {19094, 1608, 1},
+    {25864, 1610, 5},
+    {19649, 1612, 7},
+    {31441, 1614, 6},
+    {0, 887, 255},
+    {0, 888, 255},
+    {0, 889, 255},
+    {0, 890, 255},
+    {0, 891, 255},
+    {19010, 1617, 4},
+    {32490, 1619, 0},
+    {19112, 1621, 4},
+    {32387, 1623, 0},
+    {0, 892, 255},
+    {31816, 1625, 3},
+    {0, 893, 255},
+    {0, 894, 255},
+    {0, 895, 255},
+    {0, 896, 255},
+    {0, 897, 255},
+    {31096, 1628, 6},
+    {19410, 1630, 7},
+    {31816, 1632, 6},
+    {0, 898, 255},
+    {19267, 1634, 1},
+    {0, 899, 255},
+    {32240, 1636, 6},
+    {0, 900, 255},
+    {0, 901, 255},
+    {32240, 1638, 3},
+    {0, 902, 255},
+    {0, 903, 255},
+    {0, 904, 255},
+    {31901, 1641, 0},
+    {19112, 1643, 1},
+    {32240, 1645, 0},
+    {0, 905, 255},
+    {24902, 1647, 2},
+    {0, 906, 255},
+    {25864, 1649, 8},
+    {0, 907, 255},
+    {0, 908, 255},
+    {0, 909, 255},
+    {0, 910, 255},
+    {24934, 1652, 2},
+    {0, 911, 255},
+    {25397, 1654, 5},
+    {0, 912, 255},
+    {0, 913, 255},
+    {19045, 1657, 7},
+    {26372, 1659, 5},
+    {19267, 1661, 7},
+    {0, 914, 255},
+    {0, 915, 255},
+    {0, 916, 255},
+    {30897, 1663, 3},
+    {0, 917, 255},
+    {0, 918, 255},
+    {25206, 1666, 5},
+    {31441, 1668, 0},
+    {18977, 1670, 4},
+    {0, 919, 255},
+    {0, 920, 255},
+    {18928, 1672, 7},
+    {31816, 1674, 3},
+    {0, 921, 255},
+    {0, 922, 255},
+    {0, 923, 255},
+    {0, 924, 255},
+    {19077, 1677, 1},
+    {25864, 1679, 2},
+    {30897, 1681, 3},
+    {0, 925, 255},
+    {18826, 1683, 1},
+    {23792, 1685, 8},
+    {0, 926, 255},
+    {0, 927, 255},
+    {0, 928, 255},
+    {0, 929, 255},
+    {0, 930, 255},
+    {24902, 1688, 8},
+    {19643, 1690, 7},
+    {32077, 1692, 3},
+    {0, 931, 255},
+    {0, 932, 255},
+    {25894, 1694, 2},
+    {32420, 1696, 0},
+    {0, 933, 255},
+    {0, 934, 255},
+    {0, 935, 255},
+    {0, 936, 255},
+    {25674, 1699, 2},
+    {30897, 1701, 3},
+    {32240, 1703, 0},
+    {24431, 1705, 5},
+    {0, 937, 255},
+    {0, 938, 255},
+    {0, 939, 255},
+    {0, 940, 255},
+    {0, 941, 255},
+    {31979, 1708, 0},
+    {31096, 1710, 0},
+    {32240, 1712, 6},
+    {0, 942, 255},
+    {0, 943, 255},
+    {26139, 1714, 5},
+    {0, 944, 255},
+    {0, 945, 255},
+    {0, 946, 255},
+    {19267, 1717, 7},
+    {31816, 1719, 6},
+    {19112, 1721, 1},
+    {32077, 1723, 0},
+    {32077, 1725, 6},
+    {0, 947, 255},
+    {24431, 1727, 5},
+    {0, 948, 255},
+    {0, 949, 255},
+    {0, 950, 255},
+    {0, 951, 255},
+    {0, 952, 255},
+    {0, 953, 255},
+    {25864, 1730, 2},
+    {19094, 1732, 1},
+    {32387, 1734, 3},
+    {0, 954, 255},
+    {0, 955, 255},
+    {25894, 1736, 8},
+    {0, 956, 255},
+    {0, 957, 255},
+    {0, 958, 255},
+    {25397, 1739, 5},
+    {19112, 1741, 1},
+    {26139, 1743, 2},
+    {0, 959, 255},
+    {19410, 1745, 4},
+    {0, 960, 255},
+    {0, 961, 255},
+    {0, 962, 255},
+    {0, 963, 255},
+    {31616, 1748, 3},
+    {31096, 1750, 0},
+    {32077, 1752, 3},
+    {0, 964, 255},
+    {0, 965, 255},
+    {0, 966, 255},
+    {18928, 1754, 7},
+    {0, 967, 255},
+    {32240, 1756, 3},
+    {0, 968, 255},
+    {0, 969, 255},
+    {19488, 1759, 7},
+    {32240, 1761, 0},
+    {0, 970, 255},
+    {0, 971, 255},
+    {32387, 1763, 3},
+    {18928, 1765, 4},
+    {0, 972, 255},
+    {0, 973, 255},
+    {0, 974, 255},
+    {19010, 1768, 4},
+    {18825, 1770, 4},
+    {19267, 1772, 7},
+    {0, 975, 255},
+    {0, 976, 255},
+    {31816, 1774, 3},
+    {0, 977, 255},
+    {0, 978, 255},
+    {0, 979, 255},
+    {19094, 1777, 1},
+    {25429, 1779, 8},
+    {0, 980, 255},
+    {19077, 1781, 4},
+    {0, 981, 255},
+    {0, 982, 255},
+    {0, 983, 255},
+    {31816, 1784, 6},
+    {30897, 1786, 6},
+    {26347, 1788, 2},
+    {24431, 1790, 8},
+    {31441, 1792, 6},
+    {0, 984, 255},
+    {0, 985, 255},
+    {0, 986, 255},
+    {0, 987, 255},
+    {0, 988, 255},
+    {0, 989, 255},
+    {24263, 1795, 8},
+    {0, 990, 255},
+    {18928, 1797, 1},
+    {18792, 1799, 4},
+    {25206, 1801, 8},
+    {0, 991, 255},
+    {18928, 1803, 4},
+    {0, 992, 255},
+    {0, 993, 255},
+    {0, 994, 255},
+    {0, 995, 255},
+    {19077, 1806, 1},
+    {25864, 1808, 2},
+    {24902, 1810, 5},
+    {0, 996, 255},
+    {18825, 1812, 4},
+    {0, 997, 255},
+    {0, 998, 255},
+    {0, 999, 255},
+    {0, 1000, 255},
+    {25429, 1815, 2},
+    {19112, 1817, 1},
+    {25864, 1819, 5},
+    {0, 1001, 255},
+    {19649, 1821, 7},
+    {31441, 1823, 6},
+    {0, 1002, 255},
+    {0, 1003, 255},
+    {0, 1004, 255},
+    {0, 1005, 255},
+    {0, 1006, 255},
+    {31979, 1826, 0},
+    {0, 1007, 255},
+    {32387, 1828, 3},
+    {25894, 1830, 8},
+    {0, 1008, 255},
+    {0, 1009, 255},
+    {0, 1010, 255},
+    {19267, 1833, 7},
+    {18874, 1835, 4},
+    {19410, 1837, 7},
+    {0, 1011, 255},
+    {19112, 1839, 7},
+    {0, 1012, 255},
+    {19649, 1841, 7},
+    {0, 1013, 255},
+    {0, 1014, 255},
+    {0, 1015, 255},
+    {0, 1016, 255},
+    {31096, 1844, 3},
+    {19410, 1846, 4},
+    {32154, 1848, 3},
+    {0, 1017, 255},
+    {0, 1018, 255},
+    {19010, 1850, 1},
+    {18723, 1852, 1},
+    {0, 1019, 255},
+    {0, 1020, 255},
+    {0, 1021, 255},
+    {0, 1022, 255},
+    {24934, 1855, 5},
+    {29093, 1857, 6},
+    {26128, 1859, 5},
+    {0, 1023, 255},
+    {0, 1024, 255},
+    {31816, 1861, 3},
+    {0, 1025, 255},
+    {0, 1026, 255},
+    {0, 1027, 255},
+    {19232, 1864, 4},
+    {19010, 1866, 4},
+    {0, 1028, 255},
+    {32387, 1868, 3},
+    {0, 1029, 255},
+    {32077, 1870, 6},
+    {0, 1030, 255},
+    {0, 1031, 255},
+    {0, 1032, 255},
+    {19077, 1873, 1},
+    {25206, 1875, 8},
+    {30897, 1877, 3},
+    {0, 1033, 255},
+    {0, 1034, 255},
+    {19649, 1879, 7},
+    {0, 1035, 255},
+    {0, 1036, 255},
+    {0, 1037, 255},
+    {30442, 1882, 6},
+    {19410, 1884, 4},
+    {19094, 1886, 7},
+    {0, 1038, 255},
+    {0, 1039, 255},
+    {18977, 1888, 7},
+    {0, 1040, 255},
+    {0, 1041, 255},
+    {0, 1042, 255},
+    {25125, 1891, 8},
+    {19112, 1893, 1},
+    {32240, 1895, 6},
+    {0, 1043, 255},
+    {30098, 1897, 3},
+    {32077, 1899, 6},
+    {0, 1044, 255},
+    {0, 1045, 255},
+    {0, 1046, 255},
+    {0, 1047, 255},
+    {0, 1048, 255},
+    {25641, 1902, 2},
+    {24902, 1904, 2},
+    {18792, 1906, 4},
+    {0, 1049, 255},
+    {0, 1050, 255},
+    {0, 1051, 255},
+    {25894, 1908, 8},
+    {0, 1052, 255},
+    {0, 1053, 255},
+    {31616, 1911, 0},
+    {30897, 1913, 0},
+    {32154, 1915, 0},
+    {0, 1054, 255},
+    {0, 1055, 255},
+    {0, 1056, 255},
+    {32240, 1917, 6},
+    {32387, 1919, 0},
+    {0, 1057, 255},
+    {0, 1058, 255},
+    {0, 1059, 255},
+    {19094, 1922, 1},
+    {19027, 1924, 4},
+    {0, 1060, 255},
+    {32154, 1926, 6},
+    {0, 1061, 255},
+    {0, 1062, 255},
+    {0, 1063, 255},
+};
+
+static const uint16_t ROOTS[] = {
+    0, 11, 22, 33, 44, 53, 66, 77, 86, 95, 106, 115,
+    124, 133, 144, 155, 166, 175, 186, 195, 204, 217, 226, 235,
+    242, 249, 258, 269, 280, 289, 298, 309, 320, 329, 338, 347,
+    360, 369, 376, 387, 398, 409, 418, 427, 436, 447, 458, 469,
+    482, 495, 504, 511, 518, 527, 536, 545, 554, 563, 574, 583,
+    594, 607, 616, 623, 632, 643, 654, 665, 674, 685, 696, 703,
+    716, 721, 730, 741, 750, 757, 764, 773, 784, 793, 802, 813,
+    822, 829, 840, 851, 862, 871, 882, 889, 898, 905, 912, 923,
+    932, 945, 954, 961, 972, 983, 990, 1001, 1012, 1019, 1030, 1039,
+    1048, 1059, 1068, 1077, 1086, 1095, 1104, 1115, 1128, 1141, 1150, 1159,
+    1168, 1177, 1190, 1199, 1210, 1217, 1226, 1239, 1248, 1257, 1266, 1275,
+    1282, 1295, 1304, 1313, 1326, 1333, 1346, 1355, 1366, 1377, 1386, 1395,
+    1402, 1409, 1420, 1427, 1438, 1447, 1460, 1469, 1476, 1485, 1494, 1501,
+    1508, 1519, 1528, 1537, 1548, 1555, 1564, 1573, 1582, 1591, 1600, 1607,
+    1616, 1627, 1640, 1651, 1656, 1665, 1676, 1687, 1698, 1707, 1716, 1729,
+    1738, 1747, 1758, 1767, 1776, 1783, 1794, 1805, 1814, 1825, 1832, 1843,
+    1854, 1863, 1872, 1881, 1890, 1901, 1910, 1921,
+};
+
+static const int16_t LEAF_VALUES[] = {
+    32163, 18961, 26169,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32539, 18687, 26948,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    31242, 19129, 25174,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32525, 18758, 26585,
+    32539, 18687, 26948,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31992, 19060, 25620,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32539, 18687, 26948,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    31242, 19129, 25174,
+    32163, 18961, 26169,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32525, 18758, 26585,
+    32539, 18687, 26948,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    32163, 18961, 26169,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32163, 18961, 26169,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32317, 18896, 26109,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    31641, 19095, 25239,
+    32457, 18690, 26636,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32163, 18961, 26169,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    31641, 19095, 25239,
+    32163, 18961, 26169,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32317, 18896, 26109,
+    31992, 19060, 25620,
+    31641, 19095, 25239,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    32525, 18758, 26585,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32539, 18687, 26948,
+    32317, 18896, 26109,
+    31992, 19060, 25620,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32539, 18687, 26948,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32317, 18896, 26109,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    32539, 18687, 26948,
+    31992, 19060, 25620,
+    31242, 19129, 25174,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32539, 18687, 26948,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32163, 18961, 26169,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32457, 18690, 26636,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32457, 18690, 26636,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    31242, 19129, 25174,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    32539, 18687, 26948,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    32163, 18961, 26169,
+    31992, 19060, 25620,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    32163, 18961, 26169,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    31641, 19095, 25239,
+    32539, 18687, 26948,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32317, 18896, 26109,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32525, 18758, 26585,
+    32539, 18687, 26948,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32525, 18758, 26585,
+    32539, 18687, 26948,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32525, 18758, 26585,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    32163, 18961, 26169,
+    31641, 19095, 25239,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    31641, 19095, 25239,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32457, 18690, 26636,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    32539, 18687, 26948,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32163, 18961, 26169,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32457, 18690, 26636,
+    32163, 18961, 26169,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    31992, 19060, 25620,
+    32539, 18687, 26948,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    31242, 19129, 25174,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32525, 18758, 26585,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32525, 18758, 26585,
+    32539, 18687, 26948,
+    31641, 19095, 25239,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    31641, 19095, 25239,
+    32539, 18687, 26948,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32525, 18758, 26585,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    32163, 18961, 26169,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31242, 19129, 25174,
+    32163, 18961, 26169,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32457, 18690, 26636,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    31242, 19129, 25174,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    32163, 18961, 26169,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32525, 18758, 26585,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32163, 18961, 26169,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    32525, 18758, 26585,
+    32539, 18687, 26948,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32539, 18687, 26948,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32317, 18896, 26109,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32163, 18961, 26169,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    31992, 19060, 25620,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32539, 18687, 26948,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31641, 19095, 25239,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32539, 18687, 26948,
+    31992, 19060, 25620,
+    31242, 19129, 25174,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32525, 18758, 26585,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    31992, 19060, 25620,
+    32539, 18687, 26948,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    32317, 18896, 26109,
+    31992, 19060, 25620,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32539, 18687, 26948,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    31242, 19129, 25174,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    31641, 19095, 25239,
+    32163, 18961, 26169,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32163, 18961, 26169,
+    32457, 18690, 26636,
+    31992, 19060, 25620,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    32317, 18896, 26109,
+    31992, 19060, 25620,
+    31242, 19129, 25174,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32539, 18687, 26948,
+    31242, 19129, 25174,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    32317, 18896, 26109,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32525, 18758, 26585,
+    32539, 18687, 26948,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32525, 18758, 26585,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31242, 19129, 25174,
+    32539, 18687, 26948,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32525, 18758, 26585,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    31641, 19095, 25239,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32525, 18758, 26585,
+    32539, 18687, 26948,
+    32163, 18961, 26169,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32457, 18690, 26636,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32163, 18961, 26169,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    32539, 18687, 26948,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    32317, 18896, 26109,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    32539, 18687, 26948,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32163, 18961, 26169,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32539, 18687, 26948,
+    32163, 18961, 26169,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32525, 18758, 26585,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    32525, 18758, 26585,
+    32539, 18687, 26948,
+    32163, 18961, 26169,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    31992, 19060, 25620,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    31242, 19129, 25174,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32163, 18961, 26169,
+    31641, 19095, 25239,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31992, 19060, 25620,
+    32457, 18690, 26636,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    31242, 19129, 25174,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    32457, 18690, 26636,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31242, 19129, 25174,
+    32539, 18687, 26948,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    32525, 18758, 26585,
+    32457, 18690, 26636,
+    32163, 18961, 26169,
+    31641, 19095, 25239,
+    31992, 19060, 25620,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    31992, 19060, 25620,
+    32525, 18758, 26585,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31992, 19060, 25620,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32539, 18687, 26948,
+    31992, 19060, 25620,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32317, 18896, 26109,
+    32163, 18961, 26169,
+    32525, 18758, 26585,
+    32539, 18687, 26948,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32539, 18687, 26948,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31641, 19095, 25239,
+    32317, 18896, 26109,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    32163, 18961, 26169,
+    32317, 18896, 26109,
+    31992, 19060, 25620,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    31242, 19129, 25174,
+    32163, 18961, 26169,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    31992, 19060, 25620,
+    32539, 18687, 26948,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31242, 19129, 25174,
+    31641, 19095, 25239,
+    32163, 18961, 26169,
+    32539, 18687, 26948,
+    32457, 18690, 26636,
+    32525, 18758, 26585,
+    31641, 19095, 25239,
+    32163, 18961, 26169,
+    32457, 18690, 26636,
+    32539, 18687, 26948,
+};
+
+static const float FEATURE_SCALE[] = {1024.0f, 256.0f, 256.0f, 1024.0f, 256.0f, 256.0f, 1024.0f, 256.0f, 256.0f};
+static const float OUTPUT_SCALE[] = {1024.0f, 256.0f, 256.0f};
+
+const QuantizedForest NEXT_DAY_QUANTIZED = {
+    NODES, ROOTS, LEAF_VALUES, FEATURE_SCALE, OUTPUT_SCALE, 200, 1928, 1064, 9, 3,
+};
@@ -0,0 +1,41 @@
+#include "QuantizedForest.h"
+
+#include <math.h>
+
+// Most outputs a model may have; their sums are kept on the stack
+static const uint8_t MAX_OUTPUTS = 8;
+
+size_t quantizedForestBytes(const QuantizedForest &model) {
+  return model.nodeCount * sizeof(QuantizedNode) + model.treeCount * sizeof(uint16_t) +
+         model.leafCount * model.outputCount * sizeof(int16_t) +
+         (model.featureCount + model.outputCount) * sizeof(float);
+}
+
+void quantizeFeatures(const QuantizedForest &model, const float *features, int16_t *quantized) {
+  for (uint8_t f = 0; f < model.featureCount; f++) {
+    // Clamping keeps every comparison right: the thresholds lie well inside int16
+    float scaled = floorf(features[f] * model.featureScale[f]);
+    if (!(scaled >= INT16_MIN)) scaled = INT16_MIN;  // also catches NAN
+    if (scaled > INT16_MAX) scaled = INT16_MAX;
+    quantized[f] = (int16_t)scaled;
+  }
+}
+
+void quantizedPredict(const QuantizedForest &model, const int16_t *features, float *outputs) {
+  int32_t sums[MAX_OUTPUTS] = {};
+  uint8_t outputCount = model.outputCount < MAX_OUTPUTS ? model.outputCount : MAX_OUTPUTS;
+
+  for (uint16_t tree = 0; tree < model.treeCount; tree++) {
+    const QuantizedNode *node = &model.nodes[model.roots[tree]];
+    while (node->feature != QUANTIZED_LEAF) {
+      uint16_t next = node->left + (features[node->feature] > node->threshold);
+      node = &model.nodes[next];
+    }
+    const int16_t *leaf = &model.leafValues[node->left * model.outputCount];
+    for (uint8_t o = 0; o < outputCount; o++) sums[o] += leaf[o];
+  }
+
+  for (uint8_t o = 0; o < outputCount; o++) {
+    outputs[o] = (float)sums[o] / model.treeCount / model.outputScale[o];
+  }
+}
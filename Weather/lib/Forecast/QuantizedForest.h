@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+static const uint8_t QUANTIZED_LEAF = 0xff;
+
+// One node of a quantized tree, 6 bytes. Each tree is stored breadth-first
+// in one contiguous run with siblings next to each other, so a node only
+// needs the index of its left child; the right child follows it.
+struct QuantizedNode {
+  int16_t threshold;  // go left when the quantized feature <= threshold
+  uint16_t left;      // left child index; for a leaf, its row in leafValues
+  uint8_t feature;    // QUANTIZED_LEAF for a leaf
+};
+
+// A regression forest with int16 features, thresholds and leaf values.
+// A feature is quantized as floor(x * featureScale), clamped to int16; an
+// output is the mean leaf value divided by outputScale. Scales are powers of
+// two, so the float math is exact. scripts/export_forest.py generates these,
+// optionally keeping only the trees that fit a byte budget.
+struct QuantizedForest {
+  const QuantizedNode *nodes;
+  const uint16_t *roots;        // first node of each tree
+  const int16_t *leafValues;    // outputCount values per leaf
+  const float *featureScale;
+  const float *outputScale;
+  uint16_t treeCount;
+  uint16_t nodeCount;
+  uint16_t leafCount;
+  uint8_t featureCount;
+  uint8_t outputCount;
+};
+
+// Flash taken by the model's arrays
+size_t quantizedForestBytes(const QuantizedForest &model);
+
+void quantizeFeatures(const QuantizedForest &model, const float *features, int16_t *quantized);
+
+void quantizedPredict(const QuantizedForest &model, const int16_t *features, float *outputs);
@@ -0,0 +1,16 @@
+#include "RandomForest.h"
+
+void forestPredict(const ForestModel &model, const float *features, float *outputs) {
+  for (uint8_t o = 0; o < model.outputCount; o++) outputs[o] = 0;
+
+  for (uint16_t tree = 0; tree < model.treeCount; tree++) {
+    const ForestNode *node = &model.nodes[model.roots[tree]];
+    while (node->feature >= 0) {
+      node = &model.nodes[features[node->feature] <= node->threshold ? node->left : node->right];
+    }
+    const float *leaf = &model.leafValues[node->left * model.outputCount];
+    for (uint8_t o = 0; o < model.outputCount; o++) outputs[o] += leaf[o];
+  }
+
+  for (uint8_t o = 0; o < model.outputCount; o++) outputs[o] /= model.treeCount;
+}
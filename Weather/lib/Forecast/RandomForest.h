@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// One node of an exported decision tree. Nodes of all trees share one array.
+struct ForestNode {
+  float threshold;   // go left when x[feature] <= threshold
+  uint16_t left;     // child node index; for a leaf, its row in ForestModel::leafValues
+  uint16_t right;
+  int8_t feature;    // -1 for a leaf
+};
+
+// A regression forest as flat, flash-resident arrays; see
+// scripts/export_forest.py for how a scikit-learn model is turned into one.
+struct ForestModel {
+  const ForestNode *nodes;
+  const uint16_t *roots;      // first node of each tree
+  const float *leafValues;    // outputCount values per leaf
+  uint16_t treeCount;
+  uint16_t nodeCount;
+  uint16_t leafCount;
+  uint8_t featureCount;
+  uint8_t outputCount;
+};
+
+// Averages the leaf each tree routes `features` to, like
+// RandomForestRegressor.predict() on float32 input.
+void forestPredict(const ForestModel &model, const float *features, float *outputs);
@@ -0,0 +1,41 @@
+#pragma once
+
+// The platform services the firmware uses, behind one include.
+//
+// On the ESP32 this is the Arduino core itself. The PlatformIO "native"
+// environment gets Linux stand-ins with the same names (NativePlatform.h):
+// millis()/delay() on a VirtualClock, Serial on stdout, FreeRTOS tasks and
+// mutexes on threads, WiFi that is up unless told otherwise, Preferences in
+// files, and NetServer/NetClient on POSIX sockets. Sensors are reached
+// through ClimateSensor and AnalogInput (SensorInputs.h), raw sockets
+// through Sockets.h.
+#if defined(ARDUINO_ARCH_ESP32)
+#include <Arduino.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include <time.h>
+
+typedef WiFiServer NetServer;
+typedef WiFiClient NetClient;
+
+// Wall-clock time, valid once NTP has set it
+inline time_t wallClock() {
+  return time(NULL);
+}
+
+// Bytes of heap currently free
+inline uint32_t freeHeap() {
+  return ESP.getFreeHeap();
+}
+
+// Timeouts of network exchanges; one clock on the device
+inline unsigned long networkMillis() {
+  return millis();
+}
+
+// Only the native --replay report listens to these
+inline void uplinkSampleAccepted(unsigned long, unsigned long) {}
+inline void uplinkBatchAccepted(size_t) {}
+#else
+#include "NativePlatform.h"
+#endif
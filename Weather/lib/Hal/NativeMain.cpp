@@ -0,0 +1,16 @@
+#include "NativePlatform.h"
+
+// Unit tests (pio test -e native) bring their own main()
+#if !defined(ARDUINO_ARCH_ESP32) && !defined(PIO_UNIT_TESTING)
+
+// The sketch's entry points, as the Arduino core calls them on the ESP32
+void setup();
+void loop();
+
+int main(int argc, char **argv) {
+  nativeConfigure(argc, argv);
+  setup();
+  for (;;) loop();
+}
+
+#endif
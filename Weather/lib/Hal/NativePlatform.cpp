@@ -0,0 +1,399 @@
+#include "NativePlatform.h"
+
+#if !defined(ARDUINO_ARCH_ESP32)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <malloc.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <sys/ioctl.h>
+#include <sys/prctl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <thread>
+
+// Shortest real sleep, so fast clocks do not turn task delays into spinning
+static const uint64_t MIN_REAL_SLEEP_US = 20;
+static const int SEND_TIMEOUT_S = 5;
+// Above this the shortest real sleep is longer than the 2 s sample period
+static const double MAX_SPEED = 10000;
+
+static std::string statePath = ".native_state";
+static const char *replayPath = NULL;
+
+NativeSerial Serial;
+NativeWiFi WiFi;
+
+VirtualClock::VirtualClock() : realBase_(0), virtualBase_(0), speed_(1), epoch_(time(NULL)) {
+  realBase_ = realMicros();
+}
+
+uint64_t VirtualClock::realMicros() const {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+uint64_t VirtualClock::micros() {
+  std::lock_guard<std::mutex> guard(lock_);
+  return virtualBase_ + (uint64_t)((realMicros() - realBase_) * speed_);
+}
+
+void VirtualClock::setSpeed(double speed) {
+  uint64_t now = micros();
+  std::lock_guard<std::mutex> guard(lock_);
+  realBase_ = realMicros();
+  virtualBase_ = now;
+  speed_ = speed > 0 ? speed : 1;
+}
+
+double VirtualClock::speed() {
+  std::lock_guard<std::mutex> guard(lock_);
+  return speed_;
+}
+
+void VirtualClock::advance(uint64_t micros) {
+  std::lock_guard<std::mutex> guard(lock_);
+  virtualBase_ += micros;
+}
+
+void VirtualClock::sleep(uint64_t micros) {
+  uint64_t real = (uint64_t)(micros / speed());
+  std::this_thread::sleep_for(std::chrono::microseconds(real > MIN_REAL_SLEEP_US ? real : MIN_REAL_SLEEP_US));
+}
+
+void VirtualClock::setEpoch(time_t epoch) {
+  std::lock_guard<std::mutex> guard(lock_);
+  epoch_ = epoch;
+}
+
+time_t VirtualClock::epoch() {
+  std::lock_guard<std::mutex> guard(lock_);
+  return epoch_;
+}
+
+VirtualClock &nativeClock() {
+  static VirtualClock clock;
+  return clock;
+}
+
+unsigned long millis() {
+  return nativeClock().micros() / 1000;
+}
+
+unsigned long micros() {
+  return nativeClock().micros();
+}
+
+void delay(unsigned long ms) {
+  nativeClock().sleep((uint64_t)ms * 1000);
+}
+
+void yield() {
+  std::this_thread::yield();
+}
+
+time_t wallClock() {
+  return nativeClock().epoch() + nativeClock().micros() / 1000000;
+}
+
+unsigned long networkMillis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+uint32_t freeHeap() {
+  return (uint32_t)mallinfo2().fordblks;
+}
+
+void configTzTime(const char *tz, const char *, const char *, const char *) {
+  setenv("TZ", tz, 1);
+  tzset();
+}
+
+std::string nativeStatePath(const char *name) {
+  mkdir(statePath.c_str(), 0755);
+  return statePath + "/" + name;
+}
+
+static void usage(const char *program) {
+  fprintf(stderr,
+          "usage: %s [--speed X] [--epoch SECONDS] [--state DIR] [--offline] [--replay CSV]\n"
+          "  --speed X        run the device clock X times faster than real time, up to %.0f\n"
+          "  --epoch SECONDS  wall-clock time at boot (default: now)\n"
+          "  --state DIR      where NVS keys and flash partitions are kept (default .native_state)\n"
+          "  --offline        start with the WiFi link down\n"
+          "  --replay CSV     read the sensors from a recording (timestamp,temperature_c,\n"
+          "                   humidity_pct,aqi), starting the clock at its first row;\n"
+          "                   exits with a report once every recorded sample is uplinked\n",
+          program, MAX_SPEED);
+  exit(2);
+}
+
+void nativeConfigure(int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+    if (strcmp(arg, "--speed") == 0 && value) {
+      double speed = atof(value);
+      if (speed <= 0 || speed > MAX_SPEED) usage(argv[0]);
+      nativeClock().setSpeed(speed);
+      i++;
+    } else if (strcmp(arg, "--epoch") == 0 && value) {
+      nativeClock().setEpoch((time_t)atoll(value));
+      i++;
+    } else if (strcmp(arg, "--state") == 0 && value) {
+      statePath = value;
+      i++;
+    } else if (strcmp(arg, "--replay") == 0 && value) {
+      replayPath = value;
+      i++;
+    } else if (strcmp(arg, "--offline") == 0) {
+      WiFi.setLinkUp(false);
+    } else {
+      usage(argv[0]);
+    }
+  }
+  // A peer closing early must fail the send, not kill the process
+  signal(SIGPIPE, SIG_IGN);
+  // The default 50 us of timer slack would stretch every short sleep, and
+  // with it each task delay, by up to 500 device-ms at 10000x
+  prctl(PR_SET_TIMERSLACK, 1UL);
+}
+
+const char *nativeReplayPath() {
+  return replayPath;
+}
+
+size_t NativeSerial::print(const char *text) {
+  std::lock_guard<std::mutex> guard(lock_);
+  size_t length = fputs(text, stdout) >= 0 ? strlen(text) : 0;
+  fflush(stdout);
+  return length;
+}
+
+size_t NativeSerial::println(const char *text) {
+  std::lock_guard<std::mutex> guard(lock_);
+  int length = ::printf("%s\n", text);
+  fflush(stdout);
+  return length > 0 ? length : 0;
+}
+
+size_t NativeSerial::printf(const char *format, ...) {
+  std::lock_guard<std::mutex> guard(lock_);
+  va_list args;
+  va_start(args, format);
+  int length = vprintf(format, args);
+  va_end(args);
+  fflush(stdout);
+  return length > 0 ? length : 0;
+}
+
+size_t NativeSerial::write(const uint8_t *data, size_t length) {
+  std::lock_guard<std::mutex> guard(lock_);
+  length = fwrite(data, 1, length, stdout);
+  fflush(stdout);
+  return length;
+}
+
+int NativeSerial::available() {
+  int waiting = 0;
+  if (ioctl(STDIN_FILENO, FIONREAD, &waiting) != 0) return 0;
+  return waiting;
+}
+
+int NativeSerial::read() {
+  if (available() <= 0) return -1;
+  unsigned char c;
+  return ::read(STDIN_FILENO, &c, 1) == 1 ? c : -1;
+}
+
+// A task handle points at its name, which lives as long as the process
+struct NativeTask {
+  std::string name;
+};
+
+static NativeTask mainTask = {"loopTask"};
+static thread_local NativeTask *currentTask = &mainTask;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t, void *parameter, UBaseType_t,
+                                   TaskHandle_t *created, BaseType_t) {
+  NativeTask *handle = new NativeTask{name ? name : ""};
+  std::thread thread([task, parameter, handle]() {
+    currentTask = handle;
+    task(parameter);
+  });
+  if (created) *created = handle;
+  thread.detach();
+  return pdPASS;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+  return currentTask;
+}
+
+const char *pcTaskGetName(TaskHandle_t task) {
+  return static_cast<NativeTask *>(task ? task : currentTask)->name.c_str();
+}
+
+void vTaskDelay(TickType_t ticks) {
+  delay(ticks);
+}
+
+void vTaskDelete(TaskHandle_t) {
+  for (;;) std::this_thread::sleep_for(std::chrono::hours(1));
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+  return new std::mutex;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t) {
+  static_cast<std::mutex *>(mutex)->lock();
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex) {
+  static_cast<std::mutex *>(mutex)->unlock();
+  return pdTRUE;
+}
+
+bool Preferences::begin(const char *name, bool readOnly) {
+  namespace_ = name;
+  readOnly_ = readOnly;
+  return true;
+}
+
+std::string Preferences::path(const char *key) const {
+  return nativeStatePath((namespace_ + "." + key).c_str());
+}
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t length) {
+  if (readOnly_) return 0;
+  // Written aside and renamed, so a crash leaves the old value, as NVS does
+  std::string target = path(key);
+  std::string temporary = target + ".tmp";
+  FILE *file = fopen(temporary.c_str(), "wb");
+  if (!file) return 0;
+  bool ok = fwrite(value, 1, length, file) == length;
+  ok = fclose(file) == 0 && ok;
+  if (!ok || rename(temporary.c_str(), target.c_str()) != 0) return 0;
+  return length;
+}
+
+size_t Preferences::getBytes(const char *key, void *buffer, size_t maxLength) {
+  size_t length = getBytesLength(key);
+  if (length == 0 || length > maxLength) return 0;
+  FILE *file = fopen(path(key).c_str(), "rb");
+  if (!file) return 0;
+  size_t got = fread(buffer, 1, length, file);
+  fclose(file);
+  return got == length ? length : 0;
+}
+
+size_t Preferences::getBytesLength(const char *key) {
+  struct stat info;
+  return stat(path(key).c_str(), &info) == 0 ? info.st_size : 0;
+}
+
+int NetClient::available() {
+  int pending = 0;
+  if (fd_ < 0 || ioctl(fd_, FIONREAD, &pending) != 0) return 0;
+  return pending;
+}
+
+int NetClient::read(uint8_t *buffer, size_t size) {
+  if (fd_ < 0) return -1;
+  return recv(fd_, buffer, size, MSG_DONTWAIT);
+}
+
+bool NetClient::connected() {
+  if (fd_ < 0) return false;
+  char byte;
+  int n = recv(fd_, &byte, 1, MSG_PEEK | MSG_DONTWAIT);
+  return n > 0 || (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK));
+}
+
+void NetClient::stop() {
+  if (fd_ >= 0) close(fd_);
+  fd_ = -1;
+}
+
+size_t NetClient::write(const uint8_t *data, size_t length) {
+  size_t sent = 0;
+  while (fd_ >= 0 && sent < length) {
+    ssize_t n = send(fd_, data + sent, length - sent, MSG_NOSIGNAL);
+    if (n <= 0) {
+      if (n < 0 && errno == EINTR) continue;
+      break;
+    }
+    sent += n;
+  }
+  return sent;
+}
+
+size_t NetClient::print(const char *text) {
+  return write((const uint8_t *)text, strlen(text));
+}
+
+size_t NetClient::println(const char *text) {
+  return print(text) + print("\r\n");
+}
+
+size_t NetClient::printf(const char *format, ...) {
+  char buffer[256];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  if (length < 0) return 0;
+  if ((size_t)length < sizeof(buffer)) return write((const uint8_t *)buffer, length);
+
+  std::string large(length + 1, '\0');
+  va_start(args, format);
+  vsnprintf(&large[0], large.size(), format, args);
+  va_end(args);
+  return write((const uint8_t *)large.data(), length);
+}
+
+void NetServer::begin() {
+  if (fd_ >= 0) return;
+  fd_ = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd_ < 0) return;
+  int yes = 1;
+  setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+  struct sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = htons(port_);
+  if (bind(fd_, (struct sockaddr *)&address, sizeof(address)) != 0 || listen(fd_, 16) != 0) {
+    Serial.printf("Cannot listen on port %u: %s\n", port_, strerror(errno));
+    close(fd_);
+    fd_ = -1;
+    return;
+  }
+  fcntl(fd_, F_SETFL, fcntl(fd_, F_GETFL, 0) | O_NONBLOCK);
+  Serial.printf("Listening on http://127.0.0.1:%u/\n", port_);
+}
+
+NetClient NetServer::available() {
+  if (fd_ < 0) return NetClient();
+  int fd = accept(fd_, NULL, NULL);
+  if (fd < 0) return NetClient();
+
+  int yes = 1;
+  if (noDelay_) setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+  struct timeval timeout = {SEND_TIMEOUT_S, 0};
+  setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+  return NetClient(fd);
+}
+
+#endif
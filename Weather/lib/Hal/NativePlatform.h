@@ -0,0 +1,214 @@
+#pragma once
+
+// Linux stand-ins for the Arduino and FreeRTOS APIs the firmware uses; see
+// Hal.h. Only the parts the firmware calls exist, with the same names and
+// semantics as on the ESP32.
+#if !defined(ARDUINO_ARCH_ESP32)
+
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <mutex>
+#include <string>
+
+// Host memory is flat; constant data needs no flash attribute
+#define PROGMEM
+
+// Device time for millis()/micros()/delay(). Starts at 0 and runs at
+// `speed` times real time, so a day of firmware time can pass in seconds;
+// advance() jumps it forward. Sleeps are scaled by the same factor.
+class VirtualClock {
+public:
+  VirtualClock();
+
+  uint64_t micros();
+  void setSpeed(double speed);
+  double speed();
+  void advance(uint64_t micros);
+  // Sleeps for `micros` of device time
+  void sleep(uint64_t micros);
+
+  // Wall-clock time at device time 0; wallClock() follows the virtual clock
+  void setEpoch(time_t epoch);
+  time_t epoch();
+
+private:
+  uint64_t realMicros() const;
+
+  std::mutex lock_;
+  uint64_t realBase_;
+  uint64_t virtualBase_;
+  double speed_;
+  time_t epoch_;
+};
+
+VirtualClock &nativeClock();
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+time_t wallClock();
+// Real milliseconds: the network and the peers on it do not follow the
+// virtual clock, so their timeouts must not either
+unsigned long networkMillis();
+
+// Bytes the allocator holds free; the host has no fixed heap to report
+uint32_t freeHeap();
+
+// Applies a POSIX TZ string; there is no NTP to start, wallClock() is already set
+void configTzTime(const char *tz, const char *server1, const char *server2 = NULL, const char *server3 = NULL);
+
+// Files in this directory hold what the ESP32 keeps in NVS and flash
+// partitions; set with --state, default ".native_state"
+std::string nativeStatePath(const char *name);
+
+// Command-line options of the native firmware binary; see NativePlatform.cpp
+void nativeConfigure(int argc, char **argv);
+
+// The --replay CSV file, or NULL to simulate the weather (SimulatedWeather.h)
+const char *nativeReplayPath();
+
+// Uplink progress for the --replay report (ReplayReport.h): each sample the
+// server accepted, with the device time it was accepted at, then its batch
+void uplinkSampleAccepted(unsigned long takenAt, unsigned long now);
+void uplinkBatchAccepted(size_t samples);
+
+class NativeSerial {
+public:
+  void begin(unsigned long) {}
+  size_t print(const char *text);
+  size_t println(const char *text = "");
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+  size_t write(const uint8_t *data, size_t length);
+  // Bytes typed on stdin, without blocking
+  int available();
+  int read();
+
+private:
+  std::mutex lock_;
+};
+
+extern NativeSerial Serial;
+
+// FreeRTOS subset; one tick is one millisecond, as on the ESP32 Arduino core
+typedef uint32_t TickType_t;
+typedef unsigned UBaseType_t;
+typedef int BaseType_t;
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+typedef void *SemaphoreHandle_t;
+
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portMAX_DELAY 0xffffffffu
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+
+// Runs `task` on its own thread; stack size, priority and core are ignored
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t stackDepth, void *parameter,
+                                   UBaseType_t priority, TaskHandle_t *created, BaseType_t core);
+// The main thread is "loopTask", as setup() runs in on the ESP32
+TaskHandle_t xTaskGetCurrentTaskHandle();
+const char *pcTaskGetName(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+// Only the calling task (NULL) can be deleted; its thread then parks forever
+void vTaskDelete(TaskHandle_t task);
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t timeout);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex);
+
+enum wl_status_t { WL_IDLE_STATUS = 0, WL_CONNECTED = 3, WL_DISCONNECTED = 6 };
+
+// The host's network is always there; setLinkUp(false) (or --offline)
+// simulates losing the access point.
+class NativeWiFi {
+public:
+  NativeWiFi() : linkUp_(true), joined_(false) {}
+
+  void begin(const char *, const char *) { joined_ = true; }
+  bool reconnect() {
+    joined_ = true;
+    return true;
+  }
+  void setAutoReconnect(bool) {}
+  wl_status_t status() const { return joined_ && linkUp_ ? WL_CONNECTED : WL_DISCONNECTED; }
+  // Shaped like IPAddress, whose toString() returns an Arduino String
+  struct Address {
+    std::string toString() const { return "127.0.0.1"; }
+  };
+  Address localIP() const { return Address(); }
+
+  void setLinkUp(bool up) { linkUp_ = up; }
+
+private:
+  volatile bool linkUp_;
+  volatile bool joined_;
+};
+
+extern NativeWiFi WiFi;
+
+// Key/value store with the Preferences API; one file per key.
+class Preferences {
+public:
+  bool begin(const char *name, bool readOnly = false);
+  void end() {}
+  size_t putBytes(const char *key, const void *value, size_t length);
+  size_t getBytes(const char *key, void *buffer, size_t maxLength);
+  size_t getBytesLength(const char *key);
+
+private:
+  std::string path(const char *key) const;
+
+  std::string namespace_;
+  bool readOnly_;
+};
+
+// Accepted TCP connection, with the WiFiClient calls the firmware makes.
+// Copies share the socket, as WiFiClient copies do; stop() closes it.
+class NetClient {
+public:
+  NetClient() : fd_(-1) {}
+  explicit NetClient(int fd) : fd_(fd) {}
+
+  explicit operator bool() const { return fd_ >= 0; }
+
+  int available();
+  int read(uint8_t *buffer, size_t size);
+  bool connected();
+  void stop();
+
+  // Blocks until everything is sent or the send timeout passes
+  size_t write(const uint8_t *data, size_t length);
+  size_t print(const char *text);
+  size_t println(const char *text = "");
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+private:
+  int fd_;
+};
+
+// Non-blocking TCP listener with the WiFiServer calls the firmware makes.
+class NetServer {
+public:
+  explicit NetServer(uint16_t port) : port_(port), fd_(-1), noDelay_(false) {}
+
+  void begin();
+  void setNoDelay(bool noDelay) { noDelay_ = noDelay; }
+  // Next pending connection, or a client that tests false
+  NetClient available();
+
+private:
+  uint16_t port_;
+  int fd_;
+  bool noDelay_;
+};
+
+#endif
@@ -0,0 +1,103 @@
+#include "ReplayReport.h"
+
+#if !defined(ARDUINO_ARCH_ESP32)
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+static const unsigned long WATCH_INTERVAL_MS = 20;
+
+ReplayReport &replayReport() {
+  static ReplayReport report;
+  return report;
+}
+
+void uplinkSampleAccepted(unsigned long takenAt, unsigned long now) {
+  replayReport().sampleAccepted(takenAt, now);
+}
+
+void uplinkBatchAccepted(size_t) {
+  replayReport().batchAccepted();
+}
+
+void ReplayReport::start(const SensorReplay &replay) {
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    replay_ = &replay;
+    startReal_ = networkMillis();
+    startDevice_ = millis();
+    latencies_.reserve((replay.end() - replay.start()) / 2 + 1);  // a sample every 2 s
+  }
+  std::thread(&ReplayReport::watch, this).detach();
+}
+
+void ReplayReport::sampleRead(unsigned long now) {
+  std::lock_guard<std::mutex> guard(lock_);
+  read_++;
+  lastRead_ = now;
+}
+
+void ReplayReport::sampleAccepted(unsigned long takenAt, unsigned long now) {
+  std::lock_guard<std::mutex> guard(lock_);
+  if (!replay_) return;
+  latencies_.push_back(now - takenAt);
+  lastAccepted_ = takenAt;
+}
+
+void ReplayReport::batchAccepted() {
+  std::lock_guard<std::mutex> guard(lock_);
+  batches_++;
+}
+
+// The sampler stamps a sample before reading the sensors, so the last sample
+// read is the last one accepted when the two are less than a period apart.
+void ReplayReport::watch() {
+  unsigned long endedAt = 0;
+  for (;;) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(WATCH_INTERVAL_MS));
+    if (wallClock() <= replay_->end()) continue;
+    if (endedAt == 0) endedAt = networkMillis();
+
+    bool drained;
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      drained = read_ == 0 || (!latencies_.empty() && lastRead_ - lastAccepted_ < 1000);
+    }
+    if (drained || networkMillis() - endedAt >= DRAIN_TIMEOUT_MS) finish(drained);
+  }
+}
+
+static double percentile(const std::vector<uint32_t> &sorted, double fraction) {
+  size_t index = (size_t)(fraction * (sorted.size() - 1) + 0.5);
+  return sorted[index] / 1000.0;
+}
+
+void ReplayReport::finish(bool drained) {
+  std::lock_guard<std::mutex> guard(lock_);
+  double realSeconds = (networkMillis() - startReal_) / 1000.0;
+  double deviceSeconds = (millis() - startDevice_) / 1000.0;
+  if (realSeconds <= 0) realSeconds = 0.001;
+
+  fprintf(stderr, "\nReplay of %s: %u rows (%u skipped), %.2f days\n", replay_->path(),
+          (unsigned)replay_->rows(), (unsigned)replay_->skipped(), (replay_->end() - replay_->start()) / 86400.0);
+  fprintf(stderr, "  %.1f s of device time in %.2f s real: %.0fx\n", deviceSeconds, realSeconds,
+          deviceSeconds / realSeconds);
+  fprintf(stderr, "  samples: %u read, %u accepted in %u batches; %.0f samples/s, %.1f batches/s real\n",
+          (unsigned)read_, (unsigned)latencies_.size(), (unsigned)batches_, latencies_.size() / realSeconds,
+          batches_ / realSeconds);
+  if (!latencies_.empty()) {
+    std::vector<uint32_t> sorted(latencies_);
+    std::sort(sorted.begin(), sorted.end());
+    fprintf(stderr, "  sample-to-uplink latency, device s: p50 %.1f  p95 %.1f  p99 %.1f  max %.1f\n",
+            percentile(sorted, 0.50), percentile(sorted, 0.95), percentile(sorted, 0.99),
+            sorted.back() / 1000.0);
+  }
+  if (!drained) fprintf(stderr, "  gave up waiting for the uplink to drain\n");
+
+  // The firmware's tasks never return; leave without running destructors under them
+  fflush(stdout);
+  _exit(drained ? 0 : 1);
+}
+#endif
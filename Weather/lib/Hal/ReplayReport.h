@@ -0,0 +1,49 @@
+#pragma once
+
+#include "SensorReplay.h"
+
+#if !defined(ARDUINO_ARCH_ESP32)
+#include <mutex>
+#include <vector>
+
+// Measures a --replay run and ends it.
+//
+// Counts the samples read from the recording and, through the uplink hooks
+// in NativePlatform.h, when the server accepted each one. Once the clock is
+// past the recording and the last sample read from it has been accepted,
+// or DRAIN_TIMEOUT_MS of real time later if it never is, prints throughput
+// and sample-to-uplink latency to stderr and exits the process: 0 if every
+// sample arrived, 1 otherwise.
+class ReplayReport {
+public:
+  static const unsigned long DRAIN_TIMEOUT_MS = 30000;
+
+  ReplayReport() : replay_(NULL), startReal_(0), startDevice_(0), read_(0), lastRead_(0), batches_(0),
+                   lastAccepted_(0) {}
+
+  // Watches `replay` from a thread of its own; call once it is loaded
+  void start(const SensorReplay &replay);
+
+  // A sample was taken from the recording at device time `now`
+  void sampleRead(unsigned long now);
+
+  void sampleAccepted(unsigned long takenAt, unsigned long now);
+  void batchAccepted();
+
+private:
+  void watch();
+  void finish(bool drained);
+
+  std::mutex lock_;
+  const SensorReplay *replay_;
+  unsigned long startReal_;
+  unsigned long startDevice_;
+  size_t read_;
+  unsigned long lastRead_;
+  size_t batches_;
+  unsigned long lastAccepted_;
+  std::vector<uint32_t> latencies_;  // device ms, in acceptance order
+};
+
+ReplayReport &replayReport();
+#endif
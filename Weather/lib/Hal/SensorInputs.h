@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Hal.h"
+
+// Temperature/humidity sensor; NAN from either read means it failed.
+class ClimateSensor {
+public:
+  virtual ~ClimateSensor() {}
+
+  virtual void begin() {}
+  virtual float readTemperature() = 0;  // °C
+  virtual float readHumidity() = 0;     // %
+};
+
+// One analog channel as a 12-bit ADC count.
+class AnalogInput {
+public:
+  virtual ~AnalogInput() {}
+
+  virtual int read() = 0;
+};
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include "DHT.h"
+
+class DhtClimateSensor : public ClimateSensor {
+public:
+  DhtClimateSensor(uint8_t pin, uint8_t type) : dht_(pin, type) {}
+
+  void begin() override { dht_.begin(); }
+  float readTemperature() override { return dht_.readTemperature(); }
+  float readHumidity() override { return dht_.readHumidity(); }
+
+private:
+  DHT dht_;
+};
+
+class PinAnalogInput : public AnalogInput {
+public:
+  explicit PinAnalogInput(uint8_t pin) : pin_(pin) {}
+
+  int read() override { return analogRead(pin_); }
+
+private:
+  uint8_t pin_;
+};
+#endif
@@ -0,0 +1,81 @@
+#include "SensorReplay.h"
+
+#if !defined(ARDUINO_ARCH_ESP32)
+#include <algorithm>
+
+static bool parseTime(const char *text, time_t &time) {
+  int a, b, c, hour, minute, second = 0;
+  if (sscanf(text, "%d-%d-%d%*1[ T]%d:%d:%d", &a, &b, &c, &hour, &minute, &second) < 5) return false;
+
+  struct tm local = {};
+  bool isoOrder = a > 31;
+  local.tm_year = (isoOrder ? a : c) - 1900;
+  local.tm_mon = b - 1;
+  local.tm_mday = isoOrder ? c : a;
+  local.tm_hour = hour;
+  local.tm_min = minute;
+  local.tm_sec = second;
+  local.tm_isdst = -1;
+  time = mktime(&local);
+  return time != (time_t)-1;
+}
+
+bool SensorReplay::load(const char *path, const char *timeZone) {
+  path_ = path;
+  rows_.clear();
+  skipped_ = 0;
+  configTzTime(timeZone, NULL);
+
+  FILE *file = fopen(path, "r");
+  if (!file) {
+    fprintf(stderr, "%s: cannot open\n", path);
+    return false;
+  }
+
+  char line[256];
+  bool first = true;
+  while (fgets(line, sizeof(line), file)) {
+    bool header = first && strncmp(line, "timestamp", 9) == 0;
+    first = false;
+    if (header || line[strspn(line, " \r\n")] == '\0') continue;
+
+    Row row;
+    const char *values = strchr(line, ',');
+    if (!values || !parseTime(line, row.time) ||
+        sscanf(values, ",%f,%f,%f", &row.temperature, &row.humidity, &row.mq135Raw) != 3) {
+      skipped_++;
+      continue;
+    }
+    rows_.push_back(row);
+  }
+  fclose(file);
+
+  if (rows_.empty()) {
+    fprintf(stderr, "%s: no timestamp,temperature_c,humidity_pct,aqi rows\n", path);
+    return false;
+  }
+  std::stable_sort(rows_.begin(), rows_.end(), [](const Row &a, const Row &b) { return a.time < b.time; });
+  return true;
+}
+
+bool SensorReplay::at(time_t now, Row &reading) const {
+  if (now < start()) {
+    reading = rows_.front();
+    return false;
+  }
+  std::vector<Row>::const_iterator after = std::upper_bound(
+      rows_.begin(), rows_.end(), now, [](time_t time, const Row &row) { return time < row.time; });
+  const Row &before = *(after - 1);
+  reading = before;
+  if (after == rows_.end()) return now == before.time;
+  if (before.time == now) return true;
+  if (after->time - before.time > (time_t)MAX_GAP_S) return false;
+
+  float f = (float)(now - before.time) / (after->time - before.time);
+  reading.time = now;
+  reading.temperature = before.temperature + f * (after->temperature - before.temperature);
+  reading.humidity = before.humidity + f * (after->humidity - before.humidity);
+  reading.mq135Raw = before.mq135Raw + f * (after->mq135Raw - before.mq135Raw);
+  return true;
+}
+#endif
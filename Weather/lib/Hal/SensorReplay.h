@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Hal.h"
+
+#if !defined(ARDUINO_ARCH_ESP32)
+#include <string>
+#include <vector>
+
+// A sensor recording for the native build's --replay mode, in the schema
+// of sensor_data.csv:
+//
+//   timestamp,temperature_c,humidity_pct,aqi
+//   29-10-2025 00:00,29.73,64.22,80
+//
+// Timestamps are local time, "DD-MM-YYYY HH:MM[:SS]" as app.py writes them,
+// or ISO "YYYY-MM-DD HH:MM[:SS]" with a space or a 'T';
+// "aqi" is the raw MQ-135 count the firmware uploads. Readings between two
+// rows are interpolated; a gap longer than MAX_GAP_S reads as a failed
+// sensor, as the outage behind it would have on the device.
+//
+// The replayed samples are uplinked like live ones, so an app.py serving
+// /ingest must not append to the CSV being replayed; point it at its own
+// file with WEATHER_INGEST_CSV (see platformio.ini).
+class SensorReplay {
+public:
+  static const uint32_t MAX_GAP_S = 900;
+
+  struct Row {
+    time_t time;
+    float temperature;
+    float humidity;
+    float mq135Raw;
+  };
+
+  // Reads `path` with timestamps in the POSIX zone `timeZone`, which becomes
+  // the process's zone. False, with the reason on stderr, if nothing usable
+  // is in it.
+  bool load(const char *path, const char *timeZone);
+
+  bool loaded() const { return !rows_.empty(); }
+  const char *path() const { return path_.c_str(); }
+  size_t rows() const { return rows_.size(); }
+  size_t skipped() const { return skipped_; }
+  time_t start() const { return rows_.front().time; }
+  time_t end() const { return rows_.back().time; }
+
+  // The readings at wall-clock `now`. False outside the recording or in a
+  // gap, with `reading` set to the nearest row before `now` (or the first)
+  bool at(time_t now, Row &reading) const;
+
+private:
+  std::string path_;
+  std::vector<Row> rows_;
+  size_t skipped_;
+};
+#endif
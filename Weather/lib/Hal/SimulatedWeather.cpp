@@ -0,0 +1,76 @@
+#include "SimulatedWeather.h"
+
+#if !defined(ARDUINO_ARCH_ESP32)
+#include "ReplayReport.h"
+
+static const float TWO_PI_F = 6.2831853f;
+
+static float clampf(float value, float low, float high) {
+  return value < low ? low : (value > high ? high : value);
+}
+
+SimulatedWeather::SimulatedWeather(const char *timeZone, uint32_t seed, float failureRate)
+    : timeZone_(timeZone), state_(seed ? seed : 1), failureRate_(failureRate) {}
+
+void SimulatedWeather::begin() {
+  configTzTime(timeZone_, NULL);
+  const char *path = nativeReplayPath();
+  if (!path) return;
+  if (!replay_.load(path, timeZone_)) exit(2);
+  nativeClock().setEpoch(replay_.start() - millis() / 1000);
+  replayReport().start(replay_);
+}
+
+float SimulatedWeather::dayFraction() {
+  time_t now = wallClock();
+  struct tm local;
+  localtime_r(&now, &local);
+  return (local.tm_hour * 3600 + local.tm_min * 60 + local.tm_sec) / 86400.0f;
+}
+
+// Sum of three xorshift uniforms: cheap, roughly normal, deterministic per seed
+float SimulatedWeather::noise(float scale) {
+  float sum = 0;
+  for (int i = 0; i < 3; i++) {
+    state_ ^= state_ << 13;
+    state_ ^= state_ >> 17;
+    state_ ^= state_ << 5;
+    sum += (state_ & 0xffff) / 65535.0f - 0.5f;
+  }
+  return sum * 2 * scale;
+}
+
+bool SimulatedWeather::failed() {
+  return (noise(0.5f) + 1.5f) / 3.0f < failureRate_;
+}
+
+float SimulatedWeather::readTemperature() {
+  SensorReplay::Row row;
+  if (replay_.loaded()) return replay_.at(wallClock(), row) ? row.temperature : NAN;
+  if (failed()) return NAN;
+  float day = dayFraction() * TWO_PI_F;
+  float temperature = 30.0f + 4.5f * cosf(day - 14 / 24.0f * TWO_PI_F) + 0.8f * sinf(2 * day + 0.3f);
+  return roundf(clampf(temperature + noise(0.5f), 23.3f, 35.6f) * 10) / 10;
+}
+
+float SimulatedWeather::readHumidity() {
+  SensorReplay::Row row;
+  if (replay_.loaded()) return replay_.at(wallClock(), row) ? row.humidity : NAN;
+  if (failed()) return NAN;
+  float day = dayFraction() * TWO_PI_F;
+  float humidity = 72.0f + 15.0f * cosf(day - 4 / 24.0f * TWO_PI_F);
+  return roundf(clampf(humidity + noise(2.0f), 50.0f, 95.0f) * 10) / 10;
+}
+
+int SimulatedWeather::read() {
+  SensorReplay::Row row;
+  if (replay_.loaded()) {
+    // The MQ-135 has no failure mode; through gaps it holds the last row
+    if (replay_.at(wallClock(), row)) replayReport().sampleRead(millis());
+    return (int)lroundf(row.mq135Raw);
+  }
+  float day = dayFraction() * TWO_PI_F;
+  float raw = 100.0f + 15.0f * sinf(day - 8 / 24.0f * TWO_PI_F) + 10.0f * sinf(2 * day - 17 / 24.0f * TWO_PI_F);
+  return (int)clampf(raw + noise(5.0f), 0, 4095);
+}
+#endif
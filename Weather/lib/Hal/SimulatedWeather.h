@@ -0,0 +1,41 @@
+#pragma once
+
+#include "SensorInputs.h"
+
+#if !defined(ARDUINO_ARCH_ESP32)
+#include "SensorReplay.h"
+
+// Stand-in for the DHT11 and MQ-135 in the native build.
+//
+// Follows the daily cycle of the recorded data (see
+// scripts/sensor_forecast_chennai.py): temperature peaking around 14:00,
+// humidity around 04:00, the MQ-135 count with morning and evening peaks,
+// each with noise, at the local time of wallClock(). Values are rounded to
+// the DHT11's 0.1 steps, and a fraction of climate reads fail like real
+// DHT reads do.
+//
+// With --replay the readings come from that recording instead
+// (SensorReplay.h): begin() loads it, sets the wall clock to its first row
+// and starts the ReplayReport that ends the run.
+class SimulatedWeather : public ClimateSensor, public AnalogInput {
+public:
+  // `timeZone` is the firmware's POSIX zone, which local times are in
+  explicit SimulatedWeather(const char *timeZone, uint32_t seed = 1, float failureRate = 0.01f);
+
+  void begin() override;
+  float readTemperature() override;
+  float readHumidity() override;
+  int read() override;
+
+private:
+  // Fraction of the local day elapsed, 0..1
+  static float dayFraction();
+  float noise(float scale);
+  bool failed();
+
+  const char *timeZone_;
+  uint32_t state_;
+  float failureRate_;
+  SensorReplay replay_;
+};
+#endif
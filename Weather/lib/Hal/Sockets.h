@@ -0,0 +1,16 @@
+#pragma once
+
+// BSD sockets for code that drives its own connections: lwIP on the ESP32,
+// the C library on Linux.
+#if defined(ARDUINO_ARCH_ESP32)
+#include <lwip/netdb.h>
+#include <lwip/sockets.h>
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
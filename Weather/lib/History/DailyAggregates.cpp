@@ -0,0 +1,106 @@
+#include "DailyAggregates.h"
+
+#include <string.h>
+
+#include "Telemetry.h"
+
+static const uint8_t STATE_VERSION = 1;
+
+static void startDay(DayAggregate &aggregate, uint32_t day) {
+  memset(&aggregate, 0, sizeof(aggregate));
+  aggregate.day = day;
+}
+
+DailyAggregates::DailyAggregates() : count_(0), newest_(DAYS - 1) {}
+
+uint32_t DailyAggregates::dayNumber(int year, int month, int day) {
+  year -= month <= 2;
+  int era = (year >= 0 ? year : year - 399) / 400;
+  int yoe = year - era * 400;
+  int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + doe - 719468;
+}
+
+void DailyAggregates::add(uint32_t day, float temperature, float humidity, int mq135Raw) {
+  if (count_ > 0 && day < days_[newest_].day) return;
+  if (count_ == 0 || day != days_[newest_].day) {
+    newest_ = (newest_ + 1) % DAYS;
+    if (count_ < DAYS) count_++;
+    startDay(days_[newest_], day);
+  }
+
+  TelemetryRecord record = telemetryRecord(0, temperature, humidity, mq135Raw);
+  DayAggregate &today = days_[newest_];
+  if (today.count == 0 || record.mq135Raw < today.min.mq135Raw) today.min.mq135Raw = record.mq135Raw;
+  if (today.count == 0 || record.mq135Raw > today.max.mq135Raw) today.max.mq135Raw = record.mq135Raw;
+  today.mq135Sum += record.mq135Raw;
+  today.count++;
+
+  if (record.temperatureCenti == TELEMETRY_MISSING || record.humidityCenti == 0xffff) return;
+  bool first = today.dhtCount == 0;
+  if (first || record.temperatureCenti < today.min.temperatureCenti) {
+    today.min.temperatureCenti = record.temperatureCenti;
+  }
+  if (first || record.temperatureCenti > today.max.temperatureCenti) {
+    today.max.temperatureCenti = record.temperatureCenti;
+  }
+  if (first || record.humidityCenti < today.min.humidityCenti) today.min.humidityCenti = record.humidityCenti;
+  if (first || record.humidityCenti > today.max.humidityCenti) today.max.humidityCenti = record.humidityCenti;
+  today.temperatureSum += record.temperatureCenti;
+  today.humiditySum += record.humidityCenti;
+  today.dhtCount++;
+}
+
+const DayAggregate *DailyAggregates::find(uint32_t day) const {
+  for (size_t i = 0; i < count_; i++) {
+    if (at(i).day == day) return &at(i);
+  }
+  return NULL;
+}
+
+bool DailyAggregates::mean(const DayAggregate &day, float &temperature, float &humidity, float &mq135Raw) {
+  if (day.dhtCount == 0) return false;
+  temperature = day.temperatureSum / 100.0f / day.dhtCount;
+  humidity = day.humiditySum / 100.0f / day.dhtCount;
+  mq135Raw = (float)day.mq135Sum / day.count;
+  return true;
+}
+
+bool DailyAggregates::lagVector(uint32_t today, size_t lags, uint32_t minDhtSamples, float *features) const {
+  float values[3 * DAYS];
+  if (lags > DAYS) return false;
+  for (size_t lag = 1; lag <= lags; lag++) {
+    const DayAggregate *day = find(today - lag);
+    if (day == NULL || day->dhtCount < minDhtSamples) return false;
+    float *out = &values[(lag - 1) * 3];
+    if (!mean(*day, out[0], out[1], out[2])) return false;
+  }
+  memcpy(features, values, lags * 3 * sizeof(float));
+  return true;
+}
+
+size_t DailyAggregates::save(uint8_t *out) const {
+  out[0] = 'D';
+  out[1] = 'A';
+  out[2] = STATE_VERSION;
+  out[3] = count_;
+  for (size_t i = 0; i < count_; i++) memcpy(out + 4 + i * sizeof(DayAggregate), &at(i), sizeof(DayAggregate));
+  return 4 + count_ * sizeof(DayAggregate);
+}
+
+bool DailyAggregates::restore(const uint8_t *data, size_t length) {
+  if (length < 4 || data[0] != 'D' || data[1] != 'A' || data[2] != STATE_VERSION) return false;
+  size_t count = data[3];
+  if (count > DAYS || length != 4 + count * sizeof(DayAggregate)) return false;
+
+  DayAggregate days[DAYS];
+  for (size_t i = 0; i < count; i++) {
+    memcpy(&days[i], data + 4 + i * sizeof(DayAggregate), sizeof(DayAggregate));
+    if (i > 0 && days[i].day <= days[i - 1].day) return false;
+  }
+  memcpy(days_, days, count * sizeof(DayAggregate));
+  count_ = count;
+  newest_ = count > 0 ? count - 1 : DAYS - 1;
+  return true;
+}
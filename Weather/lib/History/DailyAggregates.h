@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "SampleHistory.h"
+
+// Running statistics for one local calendar day, in the telemetry format's
+// fixed-point units.
+struct DayAggregate {
+  uint32_t day;              // days since 1970-01-01, local time
+  uint32_t count;            // samples
+  uint32_t dhtCount;         // samples with temperature and humidity
+  int32_t temperatureSum;
+  uint32_t humiditySum;
+  uint32_t mq135Sum;
+  PackedSample min, max;
+};
+
+// Mean/min/max per metric for the last DAYS calendar days, as
+// feature_engineering() in the training script computes them from the CSV,
+// but updated in O(1) per sample. The state is small enough to persist
+// whole (save()/restore()), so the days survive a reboot.
+// Not thread-safe: callers on different tasks must serialize access.
+class DailyAggregates {
+public:
+  static const size_t DAYS = 8;
+  // magic, version, day count, then the days oldest first
+  static const size_t STATE_SIZE = 4 + DAYS * sizeof(DayAggregate);
+
+  DailyAggregates();
+
+  // Days since 1970-01-01 for a proleptic Gregorian date
+  static uint32_t dayNumber(int year, int month, int day);
+
+  // Folds a reading into `day`, which becomes the newest day; the oldest one
+  // drops out when the ring is full. Readings for days before the newest
+  // are ignored. NAN temperature or humidity counts as unknown.
+  void add(uint32_t day, float temperature, float humidity, int mq135Raw);
+
+  size_t size() const { return count_; }
+  // i-th oldest day; i must be below size()
+  const DayAggregate &at(size_t i) const { return days_[(newest_ + DAYS - (count_ - 1) + i) % DAYS]; }
+  // NULL unless `day` is stored
+  const DayAggregate *find(uint32_t day) const;
+
+  // Means in °C, % and raw counts; false if the day has no DHT samples
+  static bool mean(const DayAggregate &day, float &temperature, float &humidity, float &mq135Raw);
+
+  // The model's lag vector: [temperature, humidity, mq135] means of the
+  // `lags` days before `today`, the day before first. False, leaving
+  // `features` alone, unless every one of them has `minDhtSamples`.
+  bool lagVector(uint32_t today, size_t lags, uint32_t minDhtSamples, float *features) const;
+
+  // Writes the state to `out` (STATE_SIZE bytes); returns the bytes used
+  size_t save(uint8_t *out) const;
+  // Replaces the state with a saved one; false, leaving it unchanged, if
+  // `data` is not a state this version wrote
+  bool restore(const uint8_t *data, size_t length);
+
+private:
+  DayAggregate days_[DAYS];
+  size_t count_;
+  size_t newest_;
+};
@@ -0,0 +1,186 @@
+#include "SampleHistory.h"
+
+#include "Telemetry.h"
+
+static const PackedSample EMPTY_SAMPLE = {TELEMETRY_MISSING, 0xffff, HISTORY_EMPTY};
+
+static bool hasDht(const PackedSample &sample) {
+  return sample.temperatureCenti != TELEMETRY_MISSING && sample.humidityCenti != 0xffff;
+}
+
+SampleHistory::SampleHistory() {
+  clear(minuteAcc_, 0);
+  clear(fiveMinuteAcc_, 0);
+}
+
+void SampleHistory::add(uint32_t seconds, float temperature, float humidity, int mq135Raw) {
+  TelemetryRecord record = telemetryRecord(0, temperature, humidity, mq135Raw);
+  PackedSample sample = {record.temperatureCenti, record.humidityCenti, record.mq135Raw};
+  if (!hasDht(sample)) {
+    sample.temperatureCenti = TELEMETRY_MISSING;
+    sample.humidityCenti = 0xffff;
+  }
+
+  raw_.put(seconds / RAW_SECONDS, sample, EMPTY_SAMPLE);
+  addAggregated(minutes_, minuteAcc_, seconds / 60, sample);
+  addAggregated(fiveMinutes_, fiveMinuteAcc_, seconds / 300, sample);
+}
+
+template <typename TierType>
+void SampleHistory::addAggregated(TierType &tier, Accumulator &acc, uint32_t bucket,
+                                  const PackedSample &sample) {
+  if (acc.count > 0 && bucket != acc.bucket) {
+    Aggregate empty = {EMPTY_SAMPLE, EMPTY_SAMPLE, EMPTY_SAMPLE};
+    tier.put(acc.bucket, finish(acc), empty);
+    clear(acc, bucket);
+  }
+  acc.bucket = bucket;
+  accumulate(acc, sample);
+}
+
+void SampleHistory::clear(Accumulator &acc, uint32_t bucket) {
+  acc.bucket = bucket;
+  acc.count = 0;
+  acc.dhtCount = 0;
+  acc.temperatureSum = 0;
+  acc.humiditySum = 0;
+  acc.mq135Sum = 0;
+  acc.min = EMPTY_SAMPLE;
+  acc.max = EMPTY_SAMPLE;
+}
+
+void SampleHistory::accumulate(Accumulator &acc, const PackedSample &sample) {
+  if (acc.count == 0 || sample.mq135Raw < acc.min.mq135Raw) acc.min.mq135Raw = sample.mq135Raw;
+  if (acc.count == 0 || sample.mq135Raw > acc.max.mq135Raw) acc.max.mq135Raw = sample.mq135Raw;
+  acc.mq135Sum += sample.mq135Raw;
+  acc.count++;
+
+  if (!hasDht(sample)) return;
+  if (acc.dhtCount == 0 || sample.temperatureCenti < acc.min.temperatureCenti) {
+    acc.min.temperatureCenti = sample.temperatureCenti;
+  }
+  if (acc.dhtCount == 0 || sample.temperatureCenti > acc.max.temperatureCenti) {
+    acc.max.temperatureCenti = sample.temperatureCenti;
+  }
+  if (acc.dhtCount == 0 || sample.humidityCenti < acc.min.humidityCenti) {
+    acc.min.humidityCenti = sample.humidityCenti;
+  }
+  if (acc.dhtCount == 0 || sample.humidityCenti > acc.max.humidityCenti) {
+    acc.max.humidityCenti = sample.humidityCenti;
+  }
+  acc.temperatureSum += sample.temperatureCenti;
+  acc.humiditySum += sample.humidityCenti;
+  acc.dhtCount++;
+}
+
+SampleHistory::Aggregate SampleHistory::finish(const Accumulator &acc) {
+  Aggregate aggregate;
+  aggregate.min = acc.min;
+  aggregate.max = acc.max;
+  aggregate.mean.mq135Raw = (acc.mq135Sum + acc.count / 2) / acc.count;
+  if (acc.dhtCount > 0) {
+    // round half away from zero, as the fixed-point conversion does
+    int32_t half = acc.dhtCount / 2;
+    int32_t sum = acc.temperatureSum;
+    aggregate.mean.temperatureCenti = (sum >= 0 ? sum + half : sum - half) / (int32_t)acc.dhtCount;
+    aggregate.mean.humidityCenti = (acc.humiditySum + half) / acc.dhtCount;
+  } else {
+    aggregate.mean.temperatureCenti = TELEMETRY_MISSING;
+    aggregate.mean.humidityCenti = 0xffff;
+  }
+  return aggregate;
+}
+
+uint32_t SampleHistory::resolution(Tier tier) {
+  switch (tier) {
+    case RAW:
+      return RAW_SECONDS;
+    case MINUTE:
+      return 60;
+    default:
+      return 300;
+  }
+}
+
+SampleHistory::Tier SampleHistory::tierFor(uint32_t seconds) {
+  if (seconds >= 300) return FIVE_MINUTES;
+  if (seconds >= 60) return MINUTE;
+  return RAW;
+}
+
+bool SampleHistory::span(Tier tier, uint32_t &first, uint32_t &last) const {
+  uint32_t step = resolution(tier);
+  switch (tier) {
+    case RAW:
+      if (raw_.empty()) return false;
+      first = raw_.oldest() * step;
+      last = raw_.newest() * step;
+      return true;
+    case MINUTE:
+      if (minutes_.empty()) return false;
+      first = minutes_.oldest() * step;
+      last = minutes_.newest() * step;
+      return true;
+    default:
+      if (fiveMinutes_.empty()) return false;
+      first = fiveMinutes_.oldest() * step;
+      last = fiveMinutes_.newest() * step;
+      return true;
+  }
+}
+
+size_t SampleHistory::read(Tier tier, uint32_t from, uint32_t to, HistoryPoint *out, size_t max) const {
+  uint32_t step = resolution(tier);
+  uint32_t first = 1, last = 0;
+  span(tier, first, last);
+
+  uint32_t bucket = from / step;
+  uint32_t end = to / step;
+  size_t count = 0;
+  for (; bucket <= end && count < max; bucket++, count++) {
+    HistoryPoint &point = out[count];
+    point.time = bucket * step;
+    if (point.time < first || point.time > last) {
+      point.mean = point.min = point.max = EMPTY_SAMPLE;
+    } else if (tier == RAW) {
+      point.mean = point.min = point.max = raw_.at(bucket);
+    } else {
+      const Aggregate &slot = (tier == MINUTE) ? minutes_.at(bucket) : fiveMinutes_.at(bucket);
+      point.mean = slot.mean;
+      point.min = slot.min;
+      point.max = slot.max;
+    }
+  }
+  return count;
+}
+
+bool SampleHistory::windowMean(uint32_t from, uint32_t to, size_t minBuckets, float &temperature,
+                               float &humidity, float &mq135Raw) const {
+  if (fiveMinutes_.empty()) return false;
+  uint32_t first = fiveMinutes_.oldest();
+  uint32_t last = fiveMinutes_.newest();
+  uint32_t bucket = (from + 299) / 300;
+  uint32_t end = (to + 299) / 300;
+  if (bucket < first) bucket = first;
+  if (end > last + 1) end = last + 1;
+
+  int32_t temperatureSum = 0;
+  uint32_t humiditySum = 0, mq135Sum = 0;
+  size_t dhtCount = 0, count = 0;
+  for (; bucket < end; bucket++) {
+    const PackedSample &mean = fiveMinutes_.at(bucket).mean;
+    if (mean.mq135Raw == HISTORY_EMPTY) continue;
+    mq135Sum += mean.mq135Raw;
+    count++;
+    if (!hasDht(mean)) continue;
+    temperatureSum += mean.temperatureCenti;
+    humiditySum += mean.humidityCenti;
+    dhtCount++;
+  }
+  if (dhtCount == 0 || dhtCount < minBuckets) return false;
+
+  temperature = temperatureSum / 100.0f / dhtCount;
+  humidity = humiditySum / 100.0f / dhtCount;
+  mq135Raw = (float)mq135Sum / count;
+  return true;
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Sensor values packed into the telemetry format's fixed-point units.
+struct PackedSample {
+  int16_t temperatureCenti;   // TELEMETRY_MISSING when unknown
+  uint16_t humidityCenti;     // 0xffff when unknown
+  uint16_t mq135Raw;          // HISTORY_EMPTY in a slot nothing landed in
+};
+
+static const uint16_t HISTORY_EMPTY = 0xffff;
+
+// One bucket of a tier. In the raw tier mean, min and max are the same sample.
+struct HistoryPoint {
+  uint32_t time;   // seconds since boot at the start of the bucket
+  PackedSample mean;
+  PackedSample min;
+  PackedSample max;
+};
+
+// Fixed-size ring of consecutive time buckets; the slot a bucket lives in
+// follows from its number, so no timestamps are stored.
+template <typename Slot, size_t N>
+class HistoryTier {
+public:
+  HistoryTier() : newest_(0), filled_(0) {}
+
+  // Stores `slot` as bucket `bucket`, blanking any skipped buckets. Writes to
+  // an older bucket are ignored, unless the clock jumped back further than the
+  // tier reaches, which restarts the tier.
+  void put(uint32_t bucket, const Slot &slot, const Slot &empty) {
+    if (filled_ > 0 && bucket <= newest_) {
+      if (newest_ - bucket >= N) {
+        filled_ = 0;
+      } else {
+        if (bucket == newest_) slots_[bucket % N] = slot;
+        return;
+      }
+    }
+    if (filled_ > 0) {
+      uint32_t advance = bucket - newest_;
+      for (uint32_t i = 1; i < advance && i <= N; i++) {
+        slots_[(newest_ + i) % N] = empty;
+      }
+      filled_ = (filled_ + advance > N) ? N : filled_ + advance;
+    } else {
+      filled_ = 1;
+    }
+    newest_ = bucket;
+    slots_[bucket % N] = slot;
+  }
+
+  bool empty() const { return filled_ == 0; }
+  uint32_t oldest() const { return newest_ - (filled_ - 1); }
+  uint32_t newest() const { return newest_; }
+  // bucket must lie within [oldest(), newest()]
+  const Slot &at(uint32_t bucket) const { return slots_[bucket % N]; }
+
+  static size_t capacity() { return N; }
+
+private:
+  uint32_t newest_;
+  uint32_t filled_;
+  Slot slots_[N];
+};
+
+// In-RAM sensor history at three resolutions with a fixed memory budget.
+//
+// Every sample lands in the raw tier, one slot per sampling interval. The
+// minute and five-minute tiers keep mean/min/max per bucket; they are
+// accumulated from the raw samples and a bucket is written once the first
+// sample of the next one arrives, so the in-progress bucket is not visible.
+// Not thread-safe: callers on different tasks must serialize access.
+class SampleHistory {
+public:
+  enum Tier { RAW, MINUTE, FIVE_MINUTES, TIER_COUNT };
+
+  // 30 min at 2 s, 6 h at 1 min, 72 h at 5 min; ~27 KB in total. The last
+  // tier covers the three days the next-day forecaster looks back over.
+  static const uint32_t RAW_SECONDS = 2;
+  static const size_t RAW_SLOTS = 900;
+  static const size_t MINUTE_SLOTS = 360;
+  static const size_t FIVE_MINUTE_SLOTS = 864;
+
+  SampleHistory();
+
+  // Records one reading; NAN temperature or humidity is stored as unknown.
+  void add(uint32_t seconds, float temperature, float humidity, int mq135Raw);
+
+  static uint32_t resolution(Tier tier);
+  // Coarsest tier no finer than `seconds`; anything below the raw tier maps to it
+  static Tier tierFor(uint32_t seconds);
+
+  // Range of stored buckets, in seconds since boot; false while the tier is empty
+  bool span(Tier tier, uint32_t &first, uint32_t &last) const;
+
+  // Copies up to `max` buckets starting at the one containing `from` and
+  // ending at the one containing `to`. Every bucket in the range is returned,
+  // so the count does not depend on concurrent writes: empty ones and those
+  // outside span() come back with mq135Raw == HISTORY_EMPTY.
+  size_t read(Tier tier, uint32_t from, uint32_t to, HistoryPoint *out, size_t max) const;
+
+  // Means over the five-minute buckets starting in [from, to), each bucket
+  // weighted equally. False, leaving the outputs alone, unless at least
+  // `minBuckets` of them hold temperature and humidity.
+  bool windowMean(uint32_t from, uint32_t to, size_t minBuckets, float &temperature, float &humidity,
+                  float &mq135Raw) const;
+
+private:
+  struct Aggregate {
+    PackedSample mean, min, max;
+  };
+
+  // Running sums for the bucket an aggregated tier is currently filling
+  struct Accumulator {
+    uint32_t bucket;
+    uint16_t count;
+    uint16_t dhtCount;
+    int32_t temperatureSum;
+    uint32_t humiditySum;
+    uint32_t mq135Sum;
+    PackedSample min, max;
+  };
+
+  static void clear(Accumulator &acc, uint32_t bucket);
+  static void accumulate(Accumulator &acc, const PackedSample &sample);
+  static Aggregate finish(const Accumulator &acc);
+  template <typename TierType>
+  void addAggregated(TierType &tier, Accumulator &acc, uint32_t bucket, const PackedSample &sample);
+
+  HistoryTier<PackedSample, RAW_SLOTS> raw_;
+  HistoryTier<Aggregate, MINUTE_SLOTS> minutes_;
+  HistoryTier<Aggregate, FIVE_MINUTE_SLOTS> fiveMinutes_;
+  Accumulator minuteAcc_;
+  Accumulator fiveMinuteAcc_;
+};
@@ -0,0 +1,283 @@
+#include "HttpParser.h"
+
+#include <string.h>
+
+static char toLower(char c) {
+  return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c;
+}
+
+// Whether a lower-cased Accept-Encoding value accepts `coding`: listed with
+// a q-value above zero or, when it is not listed, a "*" that is. q=0 is a
+// refusal, so "gzip;q=0" does not accept gzip.
+static bool acceptsCoding(const char *value, const char *coding) {
+  size_t codingLength = strlen(coding);
+  int wildcard = -1;  // -1 no "*", else whether it was accepted
+  const char *element = value;
+  while (*element != '\0') {
+    while (*element == ' ' || *element == '\t' || *element == ',') element++;
+    const char *end = element;
+    while (*end != '\0' && *end != ',' && *end != ';' && *end != ' ' && *end != '\t') end++;
+    size_t length = end - element;
+
+    // Parameters up to the next element; only q matters
+    bool accepted = true;
+    const char *p = end;
+    while (*p != '\0' && *p != ',') {
+      if (*p == ';') {
+        p++;
+        while (*p == ' ' || *p == '\t') p++;
+        if (p[0] == 'q' && p[1] == '=') {
+          p += 2;
+          if (*p == '0') {
+            p++;
+            if (*p == '.') p++;
+            while (*p == '0') p++;
+            accepted = *p >= '1' && *p <= '9';
+          }
+          continue;
+        }
+      }
+      p++;
+    }
+
+    if (length == codingLength && memcmp(element, coding, length) == 0) return accepted;
+    if (length == 1 && *element == '*') wildcard = accepted;
+    element = p;
+  }
+  return wildcard == 1;
+}
+
+HttpParser::HttpParser() {
+  reset();
+}
+
+void HttpParser::reset() {
+  request_.method[0] = '\0';
+  request_.path[0] = '\0';
+  request_.ifNoneMatch[0] = '\0';
+  request_.acceptsGzip = false;
+  request_.keepAlive = true;
+  state_ = METHOD;
+  header_ = OTHER;
+  headSize_ = 0;
+  fieldLength_ = 0;
+  versionLength_ = 0;
+  http10_ = false;
+  errorStatus_ = NULL;
+}
+
+HttpParser::Result HttpParser::fail(const char *status) {
+  state_ = FAILED;
+  errorStatus_ = status;
+  return ERROR;
+}
+
+// Applies a finished header line. Values were lower-cased on the way in for
+// the token headers; the ETag is copied verbatim.
+void HttpParser::endHeader() {
+  while (fieldLength_ > 0 && (value_[fieldLength_ - 1] == ' ' || value_[fieldLength_ - 1] == '\t')) {
+    fieldLength_--;
+  }
+  value_[fieldLength_] = '\0';
+
+  switch (header_) {
+    case IF_NONE_MATCH:
+      if (fieldLength_ < HttpRequest::MAX_ETAG) {
+        memcpy(request_.ifNoneMatch, value_, fieldLength_ + 1);
+      }
+      break;
+    case ACCEPT_ENCODING:
+      request_.acceptsGzip = acceptsCoding(value_, "gzip");
+      break;
+    case CONNECTION:
+      if (strstr(value_, "close") != NULL) {
+        request_.keepAlive = false;
+      } else if (strstr(value_, "keep-alive") != NULL) {
+        request_.keepAlive = true;
+      }
+      break;
+    case OTHER:
+      break;
+  }
+  header_ = OTHER;
+  fieldLength_ = 0;
+}
+
+HttpParser::Result HttpParser::feed(const char *data, size_t length, size_t *consumed) {
+  size_t i = 0;
+  Result result = NEED_MORE;
+
+  if (state_ == COMPLETE) result = DONE;
+  if (state_ == FAILED) result = ERROR;
+
+  while (result == NEED_MORE && i < length) {
+    char c = data[i++];
+
+    if (++headSize_ > MAX_HEAD_SIZE) {
+      result = fail("431 Request Header Fields Too Large");
+      break;
+    }
+
+    switch (state_) {
+      case METHOD:
+        if (c == ' ') {
+          if (fieldLength_ == 0) {
+            result = fail("400 Bad Request");
+            break;
+          }
+          request_.method[fieldLength_] = '\0';
+          fieldLength_ = 0;
+          state_ = PATH;
+        } else if (c >= 'A' && c <= 'Z' && fieldLength_ < HttpRequest::MAX_METHOD - 1) {
+          request_.method[fieldLength_++] = c;
+        } else {
+          result = fail("400 Bad Request");
+        }
+        break;
+
+      case PATH:
+        if (c == ' ') {
+          if (fieldLength_ == 0) {
+            result = fail("400 Bad Request");
+            break;
+          }
+          request_.path[fieldLength_] = '\0';
+          fieldLength_ = 0;
+          state_ = VERSION;
+        } else if ((unsigned char)c <= ' ') {
+          result = fail("400 Bad Request");
+        } else if (fieldLength_ >= HttpRequest::MAX_PATH - 1) {
+          result = fail("414 URI Too Long");
+        } else {
+          request_.path[fieldLength_++] = c;
+        }
+        break;
+
+      case VERSION: {
+        static const char PREFIX[] = "HTTP/1.";
+        if (c == '\r' || c == '\n') {
+          if (versionLength_ != sizeof(PREFIX)) {
+            result = fail("505 HTTP Version Not Supported");
+            break;
+          }
+          if (http10_) request_.keepAlive = false;
+          state_ = (c == '\r') ? REQUEST_LINE_LF : HEADER_START;
+        } else if (versionLength_ < sizeof(PREFIX) - 1) {
+          if (c != PREFIX[versionLength_++]) result = fail("400 Bad Request");
+        } else if (versionLength_ == sizeof(PREFIX) - 1 && (c == '0' || c == '1')) {
+          http10_ = (c == '0');
+          versionLength_++;
+        } else {
+          result = fail("505 HTTP Version Not Supported");
+        }
+        break;
+      }
+
+      case REQUEST_LINE_LF:
+      case HEADER_LF:
+        if (c != '\n') {
+          result = fail("400 Bad Request");
+          break;
+        }
+        if (state_ == HEADER_LF) endHeader();
+        state_ = HEADER_START;
+        break;
+
+      case HEADER_START:
+        if (c == '\r') {
+          state_ = HEAD_END_LF;
+          break;
+        }
+        if (c == '\n') {
+          state_ = COMPLETE;
+          result = DONE;
+          break;
+        }
+        // This byte is the first character of a header name
+        fieldLength_ = 0;
+        state_ = HEADER_NAME;
+        // fall through
+
+      case HEADER_NAME:
+        if (c == ':') {
+          header_ = OTHER;
+          if (fieldLength_ < MAX_NAME) {
+            name_[fieldLength_] = '\0';
+            if (strcmp(name_, "if-none-match") == 0) {
+              header_ = IF_NONE_MATCH;
+            } else if (strcmp(name_, "accept-encoding") == 0) {
+              header_ = ACCEPT_ENCODING;
+            } else if (strcmp(name_, "connection") == 0) {
+              header_ = CONNECTION;
+            }
+          }
+          fieldLength_ = 0;
+          state_ = HEADER_VALUE_START;
+        } else if (c == '\r' || c == '\n' || c == ' ') {
+          result = fail("400 Bad Request");
+        } else if (fieldLength_ < MAX_NAME) {
+          // Names longer than any we match are counted but not stored
+          if (fieldLength_ < MAX_NAME - 1) name_[fieldLength_] = toLower(c);
+          fieldLength_++;
+        }
+        break;
+
+      case HEADER_VALUE_START:
+        if (c == ' ' || c == '\t') break;
+        state_ = HEADER_VALUE;
+        // fall through
+
+      case HEADER_VALUE:
+        if (c == '\r') {
+          state_ = HEADER_LF;
+        } else if (c == '\n') {
+          endHeader();
+          state_ = HEADER_START;
+        } else if (header_ != OTHER && fieldLength_ < MAX_VALUE - 1) {
+          value_[fieldLength_++] = (header_ == IF_NONE_MATCH) ? c : toLower(c);
+        }
+        break;
+
+      case HEAD_END_LF:
+        if (c != '\n') {
+          result = fail("400 Bad Request");
+          break;
+        }
+        state_ = COMPLETE;
+        result = DONE;
+        break;
+
+      case COMPLETE:
+      case FAILED:
+        break;
+    }
+  }
+
+  if (consumed) *consumed = i;
+  return result;
+}
+
+bool httpPathIs(const char *target, const char *path) {
+  size_t length = strlen(path);
+  return strncmp(target, path, length) == 0 && (target[length] == '\0' || target[length] == '?');
+}
+
+bool httpQueryParam(const char *target, const char *name, char *value, size_t size) {
+  const char *query = strchr(target, '?');
+  if (query == NULL) return false;
+
+  size_t nameLength = strlen(name);
+  for (const char *p = query + 1; *p != '\0';) {
+    size_t fieldLength = strcspn(p, "&");
+    if (fieldLength > nameLength && strncmp(p, name, nameLength) == 0 && p[nameLength] == '=') {
+      size_t valueLength = fieldLength - nameLength - 1;
+      if (valueLength >= size) return false;
+      memcpy(value, p + nameLength + 1, valueLength);
+      value[valueLength] = '\0';
+      return true;
+    }
+    p += fieldLength;
+    if (*p == '&') p++;
+  }
+  return false;
+}
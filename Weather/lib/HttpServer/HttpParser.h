@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The parts of a request the firmware acts on. Everything is stored inline so
+// a request can be parsed and dispatched without touching the heap.
+struct HttpRequest {
+  static const size_t MAX_METHOD = 8;
+  static const size_t MAX_PATH = 128;
+  static const size_t MAX_ETAG = 48;
+
+  char method[MAX_METHOD];
+  char path[MAX_PATH];          // includes the query string, if any
+  char ifNoneMatch[MAX_ETAG];   // empty when the header is absent
+  bool acceptsGzip;             // gzip, or "*", listed with q > 0
+  bool keepAlive;               // HTTP/1.1 default unless "Connection: close"
+};
+
+// Incremental HTTP/1.x request-head parser.
+//
+// Bytes can be fed in arbitrary pieces as they come off the socket; each byte
+// is examined exactly once and nothing is buffered beyond the fixed fields in
+// HttpRequest. Headers other than If-None-Match, Accept-Encoding and
+// Connection are skipped without being stored.
+class HttpParser {
+public:
+  enum Result { NEED_MORE, DONE, ERROR };
+
+  static const size_t MAX_HEAD_SIZE = 2048;
+
+  HttpParser();
+
+  void reset();
+
+  // Consumes up to `length` bytes and stops right after the blank line that
+  // ends the head. `consumed` (optional) receives how many bytes were used.
+  Result feed(const char *data, size_t length, size_t *consumed = NULL);
+
+  const HttpRequest &request() const { return request_; }
+
+  // Status line to answer with after ERROR, e.g. "400 Bad Request".
+  const char *errorStatus() const { return errorStatus_; }
+
+private:
+  enum State : uint8_t {
+    METHOD,
+    PATH,
+    VERSION,
+    REQUEST_LINE_LF,
+    HEADER_START,
+    HEADER_NAME,
+    HEADER_VALUE_START,
+    HEADER_VALUE,
+    HEADER_LF,
+    HEAD_END_LF,
+    COMPLETE,
+    FAILED
+  };
+
+  enum Header : uint8_t { OTHER, IF_NONE_MATCH, ACCEPT_ENCODING, CONNECTION };
+
+  static const size_t MAX_NAME = 20;
+  static const size_t MAX_VALUE = 64;
+
+  Result fail(const char *status);
+  void endHeader();
+
+  HttpRequest request_;
+  State state_;
+  Header header_;
+  uint16_t headSize_;
+  uint8_t fieldLength_;
+  uint8_t versionLength_;
+  bool http10_;
+  char name_[MAX_NAME];
+  char value_[MAX_VALUE];
+  const char *errorStatus_;
+};
+
+// Helpers for the request target stored in HttpRequest::path.
+
+// True when the path part of `target` (before any '?') is exactly `path`.
+bool httpPathIs(const char *target, const char *path);
+
+// Copies the value of query parameter `name` into `value`, without decoding
+// percent escapes. Returns false when the parameter is absent or its value
+// does not fit.
+bool httpQueryParam(const char *target, const char *name, char *value, size_t size);
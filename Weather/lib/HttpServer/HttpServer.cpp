@@ -0,0 +1,164 @@
+#include "HttpServer.h"
+
+#include "ResponseWriter.h"
+#include "Trace.h"
+
+HttpServer::HttpServer(NetServer &server, Handler handler)
+    : server_(server), handler_(handler) {
+  for (uint8_t i = 0; i < MAX_CONNECTIONS; i++) {
+    connections_[i].active = false;
+    connections_[i].idle = false;
+  }
+}
+
+void HttpServer::begin() {
+  server_.begin();
+  server_.setNoDelay(true);
+}
+
+void HttpServer::poll() {
+  accept();
+  for (uint8_t i = 0; i < MAX_CONNECTIONS; i++) {
+    if (connections_[i].active) {
+      service(connections_[i]);
+    }
+  }
+}
+
+uint8_t HttpServer::activeConnections() const {
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < MAX_CONNECTIONS; i++) {
+    if (connections_[i].active) count++;
+  }
+  return count;
+}
+
+// Take pending clients only while there is a free slot, or an idle kept-alive
+// one to give up; the rest wait in the listen backlog rather than being
+// accepted and starved.
+void HttpServer::accept() {
+  for (;;) {
+    // A free slot, else the longest idle one with no request arriving
+    Connection *slot = NULL;
+    for (uint8_t i = 0; i < MAX_CONNECTIONS && (slot == NULL || slot->active); i++) {
+      Connection &conn = connections_[i];
+      if (!conn.active) {
+        slot = &conn;
+      } else if (conn.idle && (slot == NULL || (long)(conn.idleSince - slot->idleSince) < 0) &&
+                 conn.client.available() == 0) {
+        slot = &conn;
+      }
+    }
+    if (slot == NULL) return;
+
+    NetClient client = server_.available();
+    if (!client) return;
+    if (slot->active) close(*slot);
+
+    slot->active = true;
+    slot->client = client;
+    slot->parser.reset();
+    slot->served = 0;
+    startRequest(*slot);
+  }
+}
+
+void HttpServer::startRequest(Connection &conn) {
+  conn.idle = false;
+  conn.deadline = networkMillis() + REQUEST_TIMEOUT_MS;
+  conn.acceptedAt = micros();
+  conn.parseMicros = 0;
+}
+
+void HttpServer::service(Connection &conn) {
+  char chunk[128];
+  bool answered = false;
+
+  // After a response, finish the piece in hand, which may hold pipelined
+  // requests, and give the other connections a turn
+  while (!answered && conn.client.available() > 0) {
+    int got = conn.client.read((uint8_t *)chunk, sizeof(chunk));
+    if (got <= 0) break;
+
+    for (size_t used = 0; used < (size_t)got;) {
+      if (conn.idle) startRequest(conn);
+
+      size_t consumed = 0;
+      TRACE_BEGIN("http parse");
+      unsigned long started = micros();
+      HttpParser::Result result = conn.parser.feed(chunk + used, got - used, &consumed);
+      conn.parseMicros += micros() - started;
+      TRACE_END("http parse");
+      used += consumed;
+
+      if (result == HttpParser::NEED_MORE) break;
+      if (result == HttpParser::ERROR) {
+        stats_.malformed.add();
+        finish(conn, conn.parser.errorStatus());
+        return;
+      }
+      answered = true;
+      if (!respond(conn)) {
+        close(conn);
+        return;
+      }
+    }
+  }
+
+  if (!conn.client.connected()) {
+    close(conn);
+  } else if ((long)(networkMillis() - conn.deadline) >= 0) {
+    if (conn.idle) {
+      close(conn);
+    } else {
+      stats_.timedOut.add();
+      finish(conn, "408 Request Timeout");
+    }
+  }
+}
+
+// Hands the parsed request to the handler and, when it keeps the connection
+// open, readies the slot for the next one
+bool HttpServer::respond(Connection &conn) {
+  stats_.requests.add();
+  stats_.parse.record(conn.parseMicros);
+  TRACE_BEGIN("http request");
+  unsigned long started = micros();
+  bool keepAlive;
+  if (++conn.served < MAX_KEEP_ALIVE_REQUESTS) {
+    keepAlive = handler_(conn.client, conn.parser.request());
+  } else {
+    HttpRequest last = conn.parser.request();
+    last.keepAlive = false;
+    keepAlive = handler_(conn.client, last);
+  }
+  unsigned long done = micros();
+  TRACE_END("http request");
+  stats_.handle.record(done - started);
+  stats_.request.record(done - conn.acceptedAt);
+  if (!keepAlive) return false;
+
+  conn.parser.reset();
+  conn.idle = true;
+  conn.idleSince = networkMillis();
+  conn.deadline = conn.idleSince + KEEP_ALIVE_TIMEOUT_MS;
+  return true;
+}
+
+void HttpServer::finish(Connection &conn, const char *status) {
+  char buffer[ResponseWriter::MAX_FIELD + 128];
+  ResponseWriter out(conn.client, buffer, sizeof(buffer));
+  out.appendf("HTTP/1.1 %s\r\n", status);
+  out.literal("Content-Length: 0\r\n"
+              "Connection: close\r\n"
+              "\r\n");
+  out.finish();
+  close(conn);
+}
+
+void HttpServer::close(Connection &conn) {
+  conn.client.stop();
+  conn.client = NetClient();
+  conn.active = false;
+  conn.idle = false;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Hal.h"
+
+#include "HttpParser.h"
+#include "Metrics.h"
+
+// Non-blocking HTTP/1.1 front end for a NetServer (WiFiServer on the ESP32).
+//
+// Each accepted client gets a slot with its own parser state and deadline.
+// poll() accepts new clients, feeds whatever bytes each socket has into its
+// parser without waiting, and hands complete requests to the handler, so one
+// slow or idle browser never holds up the others or the rest of loop().
+//
+// When the handler keeps the connection open the slot waits up to
+// KEEP_ALIVE_TIMEOUT_MS for the next request, pipelined ones included. An
+// idle slot is given up to a new client when every slot is taken, and a
+// connection closes after MAX_KEEP_ALIVE_REQUESTS, so busy clients cannot
+// keep the ones in the listen backlog out.
+class HttpServer {
+public:
+  // Called once per complete request; the handler writes the full response
+  // and returns true when the connection stays open for another request
+  // (see ResponseWriter::connection()).
+  typedef bool (*Handler)(NetClient &client, const HttpRequest &request);
+
+  static const uint8_t MAX_CONNECTIONS = 8;
+  static const unsigned long REQUEST_TIMEOUT_MS = 2000;
+  static const unsigned long KEEP_ALIVE_TIMEOUT_MS = 5000;
+  static const uint8_t MAX_KEEP_ALIVE_REQUESTS = 32;
+
+  // Per request: time from accepting the connection, or from the first byte
+  // of a later request on a kept-alive one, to the end of the response,
+  // which includes waiting for a slow client; time spent parsing
+  // its head, summed over the pieces it arrived in; and time spent in the
+  // handler writing the response. Recorded by poll(), readable from any task.
+  struct Stats {
+    DurationHistogram request;
+    DurationHistogram parse;
+    DurationHistogram handle;
+    Counter requests;
+    Counter malformed;
+    Counter timedOut;
+  };
+
+  HttpServer(NetServer &server, Handler handler);
+
+  void begin();
+  void poll();
+
+  uint8_t activeConnections() const;
+  Stats &stats() { return stats_; }
+
+private:
+  struct Connection {
+    bool active;
+    bool idle;                 // kept alive, no byte of the next request yet
+    NetClient client;
+    unsigned long deadline;
+    unsigned long idleSince;   // networkMillis()
+    unsigned long acceptedAt;  // micros()
+    uint8_t served;            // requests answered on this connection
+    uint32_t parseMicros;
+    HttpParser parser;
+  };
+
+  void accept();
+  void service(Connection &conn);
+  void startRequest(Connection &conn);
+  bool respond(Connection &conn);
+  void finish(Connection &conn, const char *status);
+  void close(Connection &conn);
+
+  NetServer &server_;
+  Handler handler_;
+  Connection connections_[MAX_CONNECTIONS];
+  Stats stats_;
+};
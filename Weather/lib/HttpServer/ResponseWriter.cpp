@@ -0,0 +1,73 @@
+#include "ResponseWriter.h"
+
+#include "Trace.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+ResponseWriter::ResponseWriter(NetClient &client, char *buffer, size_t size)
+    : client_(client), buffer_(buffer), segment_(size - MAX_FIELD), length_(0), keepAlive_(false), failed_(false) {}
+
+void ResponseWriter::append(const char *data, size_t length) {
+  while (length > 0) {
+    // Whole segments of a large body skip the copy
+    if (length_ == 0 && length >= segment_) {
+      size_t direct = length - length % segment_;
+      send(data, direct);
+      data += direct;
+      length -= direct;
+      continue;
+    }
+
+    size_t take = segment_ - length_ < length ? segment_ - length_ : length;
+    memcpy(buffer_ + length_, data, take);
+    data += take;
+    length -= take;
+    commit(take);
+  }
+}
+
+void ResponseWriter::appendf(const char *format, ...) {
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(reserve(), MAX_FIELD, format, args);
+  va_end(args);
+  if (length < 0) return;
+  commit((size_t)length < MAX_FIELD ? length : MAX_FIELD - 1);
+}
+
+void ResponseWriter::commit(size_t length) {
+  length_ += length;
+  if (length_ < segment_) return;
+  send(buffer_, segment_);
+  length_ -= segment_;
+  memmove(buffer_, buffer_ + segment_, length_);
+}
+
+void ResponseWriter::connection(const HttpRequest &request) {
+  keepAlive_ = request.keepAlive;
+  if (keepAlive_) {
+    literal("Connection: keep-alive\r\n");
+  } else {
+    literal("Connection: close\r\n");
+  }
+}
+
+bool ResponseWriter::finish() {
+  if (length_ > 0) send(buffer_, length_);
+  length_ = 0;
+  return keepAlive_ && !failed_;
+}
+
+void ResponseWriter::sink(void *writer, const char *data, size_t length) {
+  static_cast<ResponseWriter *>(writer)->append(data, length);
+}
+
+// NetClient::write() only returns early once the socket fails or stays full
+// past its own retries, so a short count means the response is lost
+void ResponseWriter::send(const char *data, size_t length) {
+  if (failed_) return;
+  TRACE_SCOPE("http write");
+  if (client_.write((const uint8_t *)data, length) != length) failed_ = true;
+}
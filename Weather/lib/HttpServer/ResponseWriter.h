@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Hal.h"
+#include "HttpParser.h"
+
+// Assembles an HTTP response in one buffer and sends it in whole TCP segments.
+//
+// HttpServer turns Nagle off, so every client.print() used to leave as its
+// own packet: a six-line header took six. Handlers instead append the
+// header's constant lines (lengths known at compile time) and formatted
+// fields to the writer, which writes to the socket only once it holds a
+// full segment, and finish() sends the rest. A small page goes out in one
+// packet; a larger one as full segments plus one partial.
+//
+// Fields are formatted straight into the buffer: reserve() returns room for
+// MAX_FIELD bytes, so the buffer is a segment plus that much slack, and
+// commit() sends a full segment as soon as one is complete.
+//
+// A response with a Content-Length ends its header with connection(), which
+// keeps the connection open when the client asked for that; the rest send
+// Connection: close, since only closing marks the end of their body.
+//
+// A write the client does not take whole leaves the response cut short, so
+// nothing more is sent and finish() has the connection closed rather than
+// kept open with the rest of the response missing.
+class ResponseWriter {
+public:
+  // lwIP's TCP_MSS in the Arduino-ESP32 core
+  static const size_t SEGMENT = 1436;
+  // Longest appendf() field or reserve() space
+  static const size_t MAX_FIELD = 128;
+  static const size_t BUFFER_SIZE = SEGMENT + MAX_FIELD;
+
+  // `size` must exceed MAX_FIELD; a write then carries size - MAX_FIELD bytes
+  ResponseWriter(NetClient &client, char *buffer, size_t size);
+
+  // For string literals only: the length comes from the array type, so a
+  // char buffer would be sent whole
+  template <size_t N>
+  void literal(const char (&text)[N]) {
+    append(text, N - 1);
+  }
+
+  void append(const char *data, size_t length);
+  void append(const uint8_t *data, size_t length) { append((const char *)data, length); }
+  // A field longer than MAX_FIELD - 1 bytes is cut
+  void appendf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+  // At least MAX_FIELD free bytes; commit() the ones used
+  char *reserve() { return buffer_ + length_; }
+  void commit(size_t length);
+
+  // The Connection header line: keep-alive when `request` asked for it
+  void connection(const HttpRequest &request);
+
+  // Sends what is left; true when connection() kept the connection open
+  // and every write went out whole
+  bool finish();
+
+  // MetricsWriter/traceDump flush callback; `writer` is the ResponseWriter
+  static void sink(void *writer, const char *data, size_t length);
+
+private:
+  void send(const char *data, size_t length);
+
+  NetClient &client_;
+  char *buffer_;
+  size_t segment_;
+  size_t length_;
+  bool keepAlive_;
+  bool failed_;
+};
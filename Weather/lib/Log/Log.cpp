@@ -0,0 +1,103 @@
+#include "Log.h"
+
+#include "Hal.h"
+#include "MpscRing.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+
+namespace {
+
+struct LogLine {
+  uint32_t millis;
+  uint32_t format;  // binary mode: hash of the format string
+  uint8_t level;
+  uint8_t length;   // binary mode: argument bytes used
+  char text[LOG_LINE_SIZE];
+};
+
+MpscRing<LogLine, LOG_RING_LINES> ring;
+uint32_t reportedDrops = 0;
+
+#if defined(LOG_BINARY)
+void writeFrame(uint32_t format, uint32_t millis, uint8_t level, const uint8_t *arguments, uint8_t length) {
+  uint8_t frame[2 + LOG_FRAME_HEADER + LOG_LINE_SIZE + 1];
+  frame[0] = LOG_FRAME_START;
+  frame[1] = LOG_FRAME_HEADER + length;
+  memcpy(frame + 2, &format, 4);
+  memcpy(frame + 6, &millis, 4);
+  frame[10] = level;
+  memcpy(frame + 11, arguments, length);
+  uint8_t check = 0;
+  for (size_t i = 2; i < 11 + (size_t)length; i++) check ^= frame[i];
+  frame[11 + length] = check;
+  Serial.write(frame, 12 + length);
+}
+#endif
+
+}  // namespace
+
+void logWrite(uint8_t level, const char *format, ...) {
+  uint32_t ticket;
+  if (!ring.claim(ticket)) return;
+
+  LogLine &line = ring.item(ticket);
+  line.millis = millis();
+  line.level = level;
+  va_list args;
+  va_start(args, format);
+  vsnprintf(line.text, sizeof(line.text), format, args);
+  va_end(args);
+  ring.publish(ticket);
+}
+
+void logWriteEncoded(uint8_t level, uint32_t format, const uint8_t *arguments, size_t length) {
+  uint32_t ticket;
+  if (!ring.claim(ticket)) return;
+
+  LogLine &line = ring.item(ticket);
+  line.millis = millis();
+  line.format = format;
+  line.level = level;
+  line.length = length;
+  memcpy(line.text, arguments, length);
+  ring.publish(ticket);
+}
+
+size_t logDrain() {
+  size_t written = 0;
+  uint32_t dropped = ring.dropped();
+
+#if defined(LOG_BINARY)
+  if (dropped != reportedDrops) {
+    uint32_t count = dropped - reportedDrops;
+    writeFrame(LOG_FORMAT_ID("%u log lines dropped"), millis(), LOG_LEVEL_WARN, (const uint8_t *)&count, 4);
+    reportedDrops = dropped;
+  }
+
+  for (const LogLine *line = ring.front(); line != NULL; line = ring.front()) {
+    writeFrame(line->format, line->millis, line->level, (const uint8_t *)line->text, line->length);
+    ring.pop();
+    written++;
+  }
+#else
+  static const char LEVELS[] = "?EWID";
+  char out[LOG_LINE_SIZE + 24];
+
+  if (dropped != reportedDrops) {
+    snprintf(out, sizeof(out), "%u log lines dropped\n", (unsigned)(dropped - reportedDrops));
+    Serial.print(out);
+    reportedDrops = dropped;
+  }
+
+  for (const LogLine *line = ring.front(); line != NULL; line = ring.front()) {
+    char level = line->level < sizeof(LEVELS) - 1 ? LEVELS[line->level] : '?';
+    snprintf(out, sizeof(out), "%lu.%03lu %c %s\n", (unsigned long)(line->millis / 1000),
+             (unsigned long)(line->millis % 1000), level, line->text);
+    ring.pop();
+    Serial.print(out);
+    written++;
+  }
+#endif
+  return written;
+}
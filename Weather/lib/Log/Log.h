@@ -0,0 +1,165 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <type_traits>
+
+// Deferred logging for the firmware's tasks.
+//
+// LOG_ERROR() .. LOG_DEBUG() put a line into a slot of a lock-free ring and
+// return; they never touch the UART. A low-priority task calls logDrain(),
+// which writes the queued lines to Serial, so a full UART FIFO stalls only
+// that task. When the ring is full lines are dropped, and the drain reports
+// how many.
+//
+// Calls above LOG_LEVEL (set with -DLOG_LEVEL=...) compile to nothing,
+// arguments included.
+//
+// Building with -DLOG_BINARY skips printf on the device altogether: a call
+// stores the 32-bit FNV-1a hash of its format string, computed by the
+// compiler, and its arguments as raw bytes, and the drain sends those as a
+// frame. scripts/log_formats.py collects the format strings into a table at
+// build time and tools/log_decode.cpp turns frames back into the same text.
+//
+// Frame: LOG_FRAME_START, payload length, payload, XOR of the payload bytes.
+// The payload is the format hash, the time in ms and the level, then one
+// field per conversion in the format: integers as 4 bytes (8 for long
+// long), floating point as a 4-byte float, strings as a length byte and
+// that many bytes. All little-endian.
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#if defined(LOG_BINARY)
+// The printf check never runs; it keeps format warnings in binary builds
+#define LOG_EMIT(level, format, ...)                                                      \
+  do {                                                                                    \
+    if (false) logCheckFormat(format, ##__VA_ARGS__);                                     \
+    logWriteBinary(level, LOG_FORMAT_ID(format), ##__VA_ARGS__);                          \
+  } while (0)
+#else
+#define LOG_EMIT(level, ...) logWrite(level, __VA_ARGS__)
+#endif
+
+#define LOG_DISCARD(...) \
+  do {                   \
+  } while (0)
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(...) LOG_EMIT(LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) LOG_DISCARD()
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(...) LOG_EMIT(LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define LOG_WARN(...) LOG_DISCARD()
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(...) LOG_EMIT(LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(...) LOG_DISCARD()
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...) LOG_EMIT(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) LOG_DISCARD()
+#endif
+
+// Longest line kept, without the timestamp and level, or in binary mode the
+// most argument bytes; longer ones are cut
+static const size_t LOG_LINE_SIZE = 120;
+// Lines the ring holds before dropping
+static const size_t LOG_RING_LINES = 32;
+
+static const uint8_t LOG_FRAME_START = 0xfe;
+// Format hash, time and level ahead of the arguments
+static const size_t LOG_FRAME_HEADER = 9;
+
+// FNV-1a, evaluated at compile time for a literal via LOG_FORMAT_ID
+constexpr uint32_t logFormatId(const char *format, uint32_t hash = 2166136261u) {
+  return *format ? logFormatId(format + 1, (hash ^ (uint8_t)*format) * 16777619u) : hash;
+}
+
+#define LOG_FORMAT_ID(format) (std::integral_constant<uint32_t, logFormatId(format)>::value)
+
+// Queues one line; safe from any task. Use the LOG_ macros instead.
+void logWrite(uint8_t level, const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+// Queues one binary record of already encoded arguments; safe from any task
+void logWriteEncoded(uint8_t level, uint32_t format, const uint8_t *arguments, size_t length);
+
+// Writes every published line to Serial, as "<seconds since boot> <E|W|I|D>
+// <text>" or as frames in binary mode, and returns how many. Only one task
+// may drain.
+size_t logDrain();
+
+inline void logCheckFormat(const char *, ...) __attribute__((format(printf, 1, 2)));
+inline void logCheckFormat(const char *, ...) {}
+
+// Argument encoders for LOG_BINARY; each returns false once `out` is full
+struct LogArguments {
+  uint8_t bytes[LOG_LINE_SIZE];
+  size_t length;
+
+  bool put(const void *data, size_t size) {
+    if (length + size > sizeof(bytes)) return false;
+    memcpy(bytes + length, data, size);  // the ESP32 and hosts are little-endian
+    length += size;
+    return true;
+  }
+
+  bool add(const char *text) {
+    if (text == NULL) text = "(null)";
+    size_t size = strlen(text);
+    if (size > 255) size = 255;
+    if (length + 1 + size > sizeof(bytes)) return false;
+    uint8_t prefix = size;
+    return put(&prefix, 1) && put(text, size);
+  }
+  bool add(char *text) { return add((const char *)text); }
+
+  template <typename T>
+  typename std::enable_if<std::is_floating_point<T>::value, bool>::type add(T value) {
+    float narrow = value;
+    return put(&narrow, sizeof(narrow));
+  }
+
+  template <typename T>
+  typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value, bool>::type add(T value) {
+    if (sizeof(T) == 8 && (std::is_same<T, long long>::value || std::is_same<T, unsigned long long>::value)) {
+      uint64_t wide = (uint64_t)value;
+      return put(&wide, sizeof(wide));
+    }
+    uint32_t narrow = (uint32_t)value;
+    return put(&narrow, sizeof(narrow));
+  }
+
+  template <typename T>
+  bool add(const T *pointer) {
+    uint32_t address = (uint32_t)(uintptr_t)pointer;
+    return put(&address, sizeof(address));
+  }
+};
+
+template <typename... Args>
+void logWriteBinary(uint8_t level, uint32_t format, Args... args) {
+  LogArguments encoded;
+  encoded.length = 0;
+  bool fits = true;
+  (void)fits;
+  ((fits = fits && encoded.add(args)), ...);
+  logWriteEncoded(level, format, encoded.bytes, encoded.length);
+}
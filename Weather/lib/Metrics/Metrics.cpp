@@ -0,0 +1,157 @@
+#include "Metrics.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+DurationHistogram::DurationHistogram() : sequence_(0) {
+  memset(&data_, 0, sizeof(data_));
+  memset(&windowStart_, 0, sizeof(windowStart_));
+}
+
+uint16_t DurationHistogram::bucketFor(uint32_t micros) {
+  if (micros < SUB_BUCKETS) return micros;
+  uint8_t power = 31 - __builtin_clz(micros);
+  if (power >= OVERFLOW_BITS) return BUCKETS - 1;
+  uint8_t shift = power - SUB_BUCKET_BITS;
+  return SUB_BUCKETS + shift * SUB_BUCKETS + ((micros >> shift) & (SUB_BUCKETS - 1));
+}
+
+uint32_t DurationHistogram::bound(uint16_t i) {
+  if (i < SUB_BUCKETS) return i;
+  if (i >= BUCKETS - 1) return UINT32_MAX;
+  uint8_t shift = (i - SUB_BUCKETS) / SUB_BUCKETS;
+  uint32_t low = (uint32_t)(SUB_BUCKETS + (i - SUB_BUCKETS) % SUB_BUCKETS) << shift;
+  return low + (1u << shift) - 1;
+}
+
+void DurationHistogram::record(uint32_t micros) {
+  uint16_t bucket = bucketFor(micros);
+
+  uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+  sequence_.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  data_.buckets[bucket]++;
+  data_.count++;
+  data_.sumMicros += micros;
+  sequence_.store(sequence + 2, std::memory_order_release);
+}
+
+DurationHistogram::Cumulative DurationHistogram::cumulative() const {
+  Cumulative totals;
+  uint32_t before, after;
+  do {
+    before = sequence_.load(std::memory_order_acquire);
+    uint32_t running = 0;
+    uint16_t bucket = 0;
+    for (uint8_t edge = 0; edge < EXPORT_EDGES; edge++) {
+      for (; bucket < (edge + 1) * EXPORT_SPAN; bucket++) running += data_.buckets[bucket];
+      totals.counts[edge] = running;
+    }
+    totals.count = data_.count;
+    totals.sumMicros = data_.sumMicros;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    after = sequence_.load(std::memory_order_relaxed);
+  } while ((before & 1) != 0 || before != after);
+  return totals;
+}
+
+DurationHistogram::Summary DurationHistogram::summarize(bool restart) {
+  uint32_t before, after, count;
+  uint64_t sum;
+  do {
+    before = sequence_.load(std::memory_order_acquire);
+    count = data_.count - windowStart_.count;
+    sum = data_.sumMicros - windowStart_.sumMicros;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    after = sequence_.load(std::memory_order_relaxed);
+  } while ((before & 1) != 0 || before != after);
+
+  // One pass finds every percentile: the smallest bucket bound with at least
+  // that share of the count at or below it. Each bucket is read once, and on
+  // restart becomes the window start as it is read, so a record that lands
+  // meanwhile counts in exactly one window.
+  static const uint16_t PER_MILLE[] = {500, 900, 990, 999, 1000};
+  Summary summary = {count, sum, 0, 0, 0, 0, 0};
+  uint32_t *percentiles[] = {&summary.p50, &summary.p90, &summary.p99, &summary.p999, &summary.max};
+  const size_t PERCENTILES = sizeof(PER_MILLE) / sizeof(PER_MILLE[0]);
+  size_t next = count > 0 ? 0 : PERCENTILES;
+  uint32_t seen = 0;
+  for (uint16_t i = 0; i < BUCKETS; i++) {
+    uint32_t current = data_.buckets[i];
+    seen += current - windowStart_.buckets[i];
+    if (restart) windowStart_.buckets[i] = current;
+    while (next < PERCENTILES) {
+      uint32_t rank = (uint32_t)(((uint64_t)count * PER_MILLE[next] + 999) / 1000);
+      if (seen < (rank > 0 ? rank : 1)) break;
+      *percentiles[next++] = i < BUCKETS - 1 ? bound(i) : 1u << OVERFLOW_BITS;
+    }
+  }
+  if (restart) {
+    windowStart_.count += seen;
+    windowStart_.sumMicros += sum;
+  }
+  return summary;
+}
+
+MetricsWriter::MetricsWriter(char *buffer, size_t size, Flush flush, void *context)
+    : buffer_(buffer), size_(size), length_(0), flush_(flush), context_(context) {}
+
+// Lines are formatted straight into the buffer; one that does not fit
+// flushes what came before and is formatted again at the start
+void MetricsWriter::line(const char *format, ...) {
+  for (int attempt = 0; attempt < 2; attempt++) {
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(buffer_ + length_, size_ - length_, format, args);
+    va_end(args);
+    if (n >= 0 && (size_t)n < size_ - length_) {
+      length_ += n;
+      return;
+    }
+    if (length_ == 0) return;  // longer than the whole buffer: dropped
+    flush_(context_, buffer_, length_);
+    length_ = 0;
+  }
+}
+
+void MetricsWriter::family(const char *name, const char *type, const char *help) {
+  line("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+void MetricsWriter::value(const char *name, const char *labels, uint32_t value) {
+  if (labels) {
+    line("%s{%s} %u\n", name, labels, (unsigned)value);
+  } else {
+    line("%s %u\n", name, (unsigned)value);
+  }
+}
+
+void MetricsWriter::value(const char *name, const char *labels, double value) {
+  if (labels) {
+    line("%s{%s} %.6g\n", name, labels, value);
+  } else {
+    line("%s %.6g\n", name, value);
+  }
+}
+
+void MetricsWriter::histogram(const char *name, const char *labels, const DurationHistogram &histogram) {
+  DurationHistogram::Cumulative totals = histogram.cumulative();
+  const char *separator = labels ? "," : "";
+  if (!labels) labels = "";
+
+  for (uint8_t edge = 0; edge < DurationHistogram::EXPORT_EDGES; edge++) {
+    line("%s_bucket{%s%sle=\"%.6f\"} %u\n", name, labels, separator, DurationHistogram::exportBound(edge) / 1e6,
+         (unsigned)totals.counts[edge]);
+  }
+  line("%s_bucket{%s%sle=\"+Inf\"} %u\n", name, labels, separator, (unsigned)totals.count);
+  const char *open = *labels ? "{" : "";
+  const char *close = *labels ? "}" : "";
+  line("%s_sum%s%s%s %.6f\n", name, open, labels, close, totals.sumMicros / 1e6);
+  line("%s_count%s%s%s %u\n", name, open, labels, close, (unsigned)totals.count);
+}
+
+void MetricsWriter::finish() {
+  if (length_ > 0) flush_(context_, buffer_, length_);
+  length_ = 0;
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// Counters and duration histograms for /metrics, plus a writer for the
+// Prometheus text exposition format.
+//
+// Recording never allocates or blocks and takes constant time: a counter is
+// one relaxed atomic add, a histogram a bit scan and a few stores into a
+// fixed array. Metrics are plain objects owned by whoever records them;
+// the scrape reads them from another task.
+
+// Monotonic event count; safe to add() from any task. Wraps at 2^32, which
+// Prometheus treats as a counter reset.
+class Counter {
+public:
+  Counter() : value_(0) {}
+
+  void add(uint32_t n = 1) { value_.fetch_add(n, std::memory_order_relaxed); }
+  uint32_t value() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+  std::atomic<uint32_t> value_;
+};
+
+// Distribution of durations in microseconds over log-linear buckets, in the
+// manner of HdrHistogram: every power of two is split into SUB_BUCKETS equal
+// parts, so a bucket is at most 1/8 of its value wide from 8 us up to about
+// 67 s. Durations below 8 us are counted exactly; those from 2^26 us on share
+// one overflow bucket. record() finds its bucket from the position of the
+// highest set bit, without a search.
+//
+// Only one task may record() into a given histogram. Updates are published
+// with a sequence count, as SeqLock does, so cumulative() from another task
+// always sees a consistent set of buckets, count and sum. The counts only
+// grow, which is what /metrics needs; summarize() reports percentiles over a
+// window instead. The only other copy kept is the counts seen when the
+// window started: the window's own counts are the difference, taken bucket
+// by bucket as they are read, so neither needs a copy of the live counts.
+class DurationHistogram {
+public:
+  static const uint8_t SUB_BUCKET_BITS = 3;
+  static const uint8_t SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+  static const uint8_t OVERFLOW_BITS = 26;
+  static const uint16_t BUCKETS = SUB_BUCKETS + (OVERFLOW_BITS - SUB_BUCKET_BITS) * SUB_BUCKETS + 1;
+
+  // /metrics exports an `le` edge at every other power of two, 2^4 us to
+  // 2^26 us: a fixed set, so every scrape has the same series
+  static const uint8_t EXPORT_SPAN = 2 * SUB_BUCKETS;
+  static const uint8_t EXPORT_EDGES = (BUCKETS - 1) / EXPORT_SPAN;
+
+  struct Cumulative {
+    uint32_t counts[EXPORT_EDGES];  // at or below exportBound(i)
+    uint32_t count;
+    uint64_t sumMicros;
+  };
+
+  // Percentiles as the highest duration their bucket can hold; anything in
+  // the overflow bucket reads as 2^26 us
+  struct Summary {
+    uint32_t count;
+    uint64_t sumMicros;
+    uint32_t p50, p90, p99, p999, max;
+  };
+
+  DurationHistogram();
+
+  void record(uint32_t micros);
+  Cumulative cumulative() const;
+
+  // Percentiles of what was recorded since the window began, which is boot
+  // until the first call with `restart` set. Only one task may call this.
+  Summary summarize(bool restart);
+
+  static uint16_t bucketFor(uint32_t micros);
+  // Highest duration bucket `i` holds; UINT32_MAX for the overflow bucket
+  static uint32_t bound(uint16_t i);
+  static uint32_t exportBound(uint8_t edge) { return bound((edge + 1) * EXPORT_SPAN - 1); }
+
+private:
+  struct Counts {
+    uint32_t buckets[BUCKETS];  // per bucket, not cumulative
+    uint32_t count;
+    uint64_t sumMicros;
+  };
+
+  std::atomic<uint32_t> sequence_;
+  Counts data_;
+  Counts windowStart_;
+};
+
+// Formats metrics in the Prometheus text format (version 0.0.4) into a
+// caller-supplied buffer, handing it to `flush` whenever it fills up, so a
+// scrape of any size needs only that buffer.
+class MetricsWriter {
+public:
+  typedef void (*Flush)(void *context, const char *data, size_t length);
+
+  MetricsWriter(char *buffer, size_t size, Flush flush, void *context);
+
+  // Starts a metric family: the # HELP and # TYPE lines
+  void family(const char *name, const char *type, const char *help);
+
+  // One sample line; `labels` is e.g. "task=\"http\"", or NULL
+  void value(const char *name, const char *labels, uint32_t value);
+  void value(const char *name, const char *labels, double value);
+
+  // The _bucket, _sum and _count lines of a histogram family in seconds:
+  // the EXPORT_EDGES `le` lines plus +Inf
+  void histogram(const char *name, const char *labels, const DurationHistogram &histogram);
+
+  // Flushes what is left
+  void finish();
+
+private:
+  void line(const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+  char *buffer_;
+  size_t size_;
+  size_t length_;
+  Flush flush_;
+  void *context_;
+};
@@ -0,0 +1,42 @@
+#include "SensorSampler.h"
+
+#include "Log.h"
+#include "Trace.h"
+
+SensorSampler::SensorSampler(ClimateSensor &climate, AnalogInput &mq135)
+    : climate_(climate), mq135_(mq135), lastSampleAt_(0) {
+}
+
+void SensorSampler::begin() {
+  climate_.begin();
+}
+
+bool SensorSampler::poll(bool force) {
+  unsigned long now = millis();
+  if (!force && hasReading() && now - lastSampleAt_ < SAMPLE_INTERVAL_MS) {
+    return false;
+  }
+
+  TRACE_SCOPE("sensor read");
+  // Build the whole snapshot first, then publish it in one store
+  SensorReading reading;
+  reading.takenAt = now;
+  reading.humidity = climate_.readHumidity();
+  reading.temperature = climate_.readTemperature();
+  reading.mq135Raw = mq135_.read();
+  reading.dhtValid = !isnan(reading.humidity) && !isnan(reading.temperature);
+
+  if (!reading.dhtValid) {
+    LOG_WARN("Failed to read from DHT sensor");
+    reading.humidity = NAN;
+    reading.temperature = NAN;
+  }
+
+  lastSampleAt_ = now;
+  latest_.store(reading);
+  return true;
+}
+
+float mq135Voltage(int raw) {
+  return raw * (3.3 / 4095.0);
+}
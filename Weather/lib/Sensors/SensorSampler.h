@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Hal.h"
+#include "SensorInputs.h"
+#include "SeqLock.h"
+
+// One complete set of sensor values, taken together at `takenAt`.
+struct SensorReading {
+  unsigned long takenAt;   // millis() at sample time
+  float temperature;       // °C, NAN when dhtValid is false
+  float humidity;          // %, NAN when dhtValid is false
+  int mq135Raw;            // 12-bit ADC count
+  bool dhtValid;
+};
+
+// Owns the climate sensor (DHT11) and the MQ-135 input and samples them on a
+// fixed schedule.
+//
+// Readers never touch the sensors: they get a copy of the most recent
+// snapshot, so their latency no longer includes the tens of milliseconds a
+// DHT read can block for. poll() must only be called from one task; latest()
+// is safe from any task.
+class SensorSampler {
+public:
+  // The DHT11 cannot deliver fresh data more often than every ~2 seconds
+  static const unsigned long SAMPLE_INTERVAL_MS = 2000;
+
+  SensorSampler(ClimateSensor &climate, AnalogInput &mq135);
+
+  void begin();
+
+  // Takes a new sample if one is due (or `force` is set). Returns true when a
+  // new snapshot was published.
+  bool poll(bool force = false);
+
+  bool hasReading() const { return latest_.version() != 0; }
+  SensorReading latest() const { return latest_.load(); }
+
+private:
+  ClimateSensor &climate_;
+  AnalogInput &mq135_;
+  unsigned long lastSampleAt_;
+  SeqLock<SensorReading> latest_;
+};
+
+float mq135Voltage(int raw);
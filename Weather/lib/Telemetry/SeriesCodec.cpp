@@ -0,0 +1,185 @@
+#include "SeriesCodec.h"
+
+#include "Telemetry.h"
+
+static uint32_t zigzag(int32_t value) {
+  return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static int32_t unzigzag(uint32_t value) {
+  return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+BitWriter::BitWriter(uint8_t *buffer, size_t capacity) : buffer_(buffer), capacity_(capacity), bits_(0) {
+}
+
+bool BitWriter::write(uint32_t value, uint8_t count) {
+  if (bits_ == (size_t)-1 || bits_ + count > capacity_ * 8) {
+    bits_ = (size_t)-1;
+    return false;
+  }
+  // Fill the current byte, then whole bytes, most significant bits first
+  while (count > 0) {
+    uint8_t room = 8 - bits_ % 8;
+    uint8_t take = count < room ? count : room;
+    uint8_t chunk = (value >> (count - take)) & ((1u << take) - 1);
+    if (room == 8) buffer_[bits_ / 8] = 0;
+    buffer_[bits_ / 8] |= chunk << (room - take);
+    bits_ += take;
+    count -= take;
+  }
+  return true;
+}
+
+void BitWriter::rewind(size_t position) {
+  bits_ = position;
+  // Clear what follows inside the last byte so later writes can OR into it
+  if (bits_ % 8 != 0) buffer_[bits_ / 8] &= (uint8_t)(0xff00 >> (bits_ % 8));
+}
+
+BitReader::BitReader(const uint8_t *data, size_t length) : data_(data), length_(length), bits_(0) {
+}
+
+bool BitReader::read(uint8_t count, uint32_t &value) {
+  if (bits_ + count > length_ * 8) return false;
+  value = 0;
+  while (count > 0) {
+    uint8_t room = 8 - bits_ % 8;
+    uint8_t take = count < room ? count : room;
+    uint8_t chunk = (data_[bits_ / 8] >> (room - take)) & ((1u << take) - 1);
+    value = (value << take) | chunk;
+    bits_ += take;
+    count -= take;
+  }
+  return true;
+}
+
+SeriesEncoder::SeriesEncoder(uint8_t *buffer, size_t capacity)
+    : writer_(buffer, capacity), count_(0), lastTime_(0), lastInterval_(0) {
+}
+
+// Prefix and payload go out in one write where they fit in 32 bits
+void SeriesEncoder::writeTimeDelta(int32_t deltaOfDelta) {
+  uint32_t z = zigzag(deltaOfDelta);
+  if (z == 0) {
+    writer_.write(0, 1);
+  } else if (z < (1u << 7)) {
+    writer_.write((0x2u << 7) | z, 2 + 7);
+  } else if (z < (1u << 9)) {
+    writer_.write((0x6u << 9) | z, 3 + 9);
+  } else if (z < (1u << 12)) {
+    writer_.write((0xeu << 12) | z, 4 + 12);
+  } else {
+    writer_.write(0xf, 4);
+    writer_.write(z, 32);
+  }
+}
+
+void SeriesEncoder::writeFieldDelta(uint16_t current, uint16_t previous) {
+  uint32_t z = zigzag((int16_t)(uint16_t)(current - previous)) & 0xffff;
+  if (z == 0) {
+    writer_.write(0, 1);
+  } else if (z < (1u << 5)) {
+    writer_.write((0x2u << 5) | z, 2 + 5);
+  } else if (z < (1u << 9)) {
+    writer_.write((0x6u << 9) | z, 3 + 9);
+  } else if (z < (1u << 12)) {
+    writer_.write((0xeu << 12) | z, 4 + 12);
+  } else {
+    writer_.write((0xfu << 16) | z, 4 + 16);
+  }
+}
+
+bool SeriesEncoder::add(const TelemetryRecord &record) {
+  size_t start = writer_.position();
+  uint32_t interval = 0;
+  const uint16_t fields[3] = {(uint16_t)record.temperatureCenti, record.humidityCenti, record.mq135Raw};
+
+  if (count_ == 0) {
+    writer_.write(record.time, 32);
+    for (int i = 0; i < 3; i++) writer_.write(fields[i], 16);
+  } else {
+    // Modular arithmetic, so any jump in time still round-trips
+    interval = record.time - lastTime_;
+    writeTimeDelta((int32_t)(interval - lastInterval_));
+    for (int i = 0; i < 3; i++) writeFieldDelta(fields[i], last_[i]);
+  }
+
+  // A failed write poisons the writer; undo the whole record instead
+  if (writer_.position() == (size_t)-1) {
+    writer_.rewind(start);
+    return false;
+  }
+  lastTime_ = record.time;
+  lastInterval_ = interval;
+  for (int i = 0; i < 3; i++) last_[i] = fields[i];
+  count_++;
+  return true;
+}
+
+void SeriesDecoder::begin(const uint8_t *data, size_t length) {
+  reader_ = BitReader(data, length);
+  count_ = 0;
+  lastTime_ = 0;
+  lastInterval_ = 0;
+}
+
+bool SeriesDecoder::readTimeDelta(int32_t &deltaOfDelta) {
+  static const uint8_t WIDTHS[] = {7, 9, 12, 32};
+  uint32_t bit, z = 0;
+  unsigned ones = 0;
+  while (ones < 4) {
+    if (!reader_.read(1, bit)) return false;
+    if (!bit) break;
+    ones++;
+  }
+  if (ones > 0 && !reader_.read(WIDTHS[ones - 1], z)) return false;
+  deltaOfDelta = unzigzag(z);
+  return true;
+}
+
+bool SeriesDecoder::readFieldDelta(uint16_t previous, uint16_t &value) {
+  static const uint8_t WIDTHS[] = {5, 9, 12, 16};
+  uint32_t bit, z = 0;
+  unsigned ones = 0;
+  while (ones < 4) {
+    if (!reader_.read(1, bit)) return false;
+    if (!bit) break;
+    ones++;
+  }
+  if (ones > 0 && !reader_.read(WIDTHS[ones - 1], z)) return false;
+  value = previous + (uint16_t)unzigzag(z);
+  return true;
+}
+
+bool SeriesDecoder::next(TelemetryRecord &record) {
+  uint32_t time;
+  uint16_t fields[3];
+  if (count_ == 0) {
+    uint32_t value;
+    if (!reader_.read(32, time)) return false;
+    for (int i = 0; i < 3; i++) {
+      if (!reader_.read(16, value)) return false;
+      fields[i] = value;
+    }
+  } else {
+    int32_t deltaOfDelta;
+    if (!readTimeDelta(deltaOfDelta)) return false;
+    for (int i = 0; i < 3; i++) {
+      if (!readFieldDelta(last_[i], fields[i])) return false;
+    }
+    lastInterval_ += (uint32_t)deltaOfDelta;
+    time = lastTime_ + lastInterval_;
+  }
+
+  lastTime_ = time;
+  for (int i = 0; i < 3; i++) last_[i] = fields[i];
+  count_++;
+
+  record.seq = 0;
+  record.time = time;
+  record.temperatureCenti = (int16_t)fields[0];
+  record.humidityCenti = fields[1];
+  record.mq135Raw = fields[2];
+  return true;
+}
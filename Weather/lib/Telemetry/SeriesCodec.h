@@ -0,0 +1,101 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct TelemetryRecord;
+
+// Bit-packed compression for runs of telemetry records, after Facebook's
+// Gorilla time-series format.
+//
+// The first record is stored in full: 32-bit time and the three 16-bit
+// fields. After that each time is stored as the change in the interval
+// (delta-of-delta), which is zero for a steady sample rate, and each field
+// as the change from the previous record. Both use a zigzag-encoded value
+// behind a short prefix picking its width, most significant bit first:
+//
+//   time delta-of-delta         field delta (mod 2^16)
+//   0                  same     0                  same
+//   10   + 7 bits              10   + 5 bits
+//   110  + 9 bits              110  + 9 bits
+//   1110 + 12 bits             1110 + 12 bits
+//   1111 + 32 bits             1111 + 16 bits
+//
+// A steady, unchanged sample costs 4 bits; record sequence numbers are not
+// stored. Decoding needs the record count, which the caller keeps.
+
+class BitWriter {
+public:
+  BitWriter(uint8_t *buffer, size_t capacity);
+
+  // Appends the low `count` bits of `value` (count <= 32). Once a write
+  // would overflow, it and all later writes fail.
+  bool write(uint32_t value, uint8_t count);
+
+  // Bits written so far; pass to rewind() to undo later writes
+  size_t position() const { return bits_; }
+  void rewind(size_t position);
+
+  size_t bytes() const { return (bits_ + 7) / 8; }
+
+private:
+  uint8_t *buffer_;
+  size_t capacity_;
+  size_t bits_;
+};
+
+class BitReader {
+public:
+  BitReader(const uint8_t *data = NULL, size_t length = 0);
+
+  // Reads `count` bits (count <= 32); false past the end of the data
+  bool read(uint8_t count, uint32_t &value);
+
+private:
+  const uint8_t *data_;
+  size_t length_;
+  size_t bits_;
+};
+
+class SeriesEncoder {
+public:
+  SeriesEncoder(uint8_t *buffer, size_t capacity);
+
+  // Returns false, leaving the output unchanged, when the record would not fit.
+  bool add(const TelemetryRecord &record);
+
+  // Size of the output so far, in whole bytes
+  size_t bytes() const { return writer_.bytes(); }
+  size_t count() const { return count_; }
+
+private:
+  void writeTimeDelta(int32_t deltaOfDelta);
+  void writeFieldDelta(uint16_t current, uint16_t previous);
+
+  BitWriter writer_;
+  size_t count_;
+  uint32_t lastTime_;
+  uint32_t lastInterval_;
+  uint16_t last_[3];
+};
+
+class SeriesDecoder {
+public:
+  SeriesDecoder() { begin(NULL, 0); }
+
+  void begin(const uint8_t *data, size_t length);
+
+  // Yields the next record's time and fields (seq is left at 0). False on
+  // truncated input; the caller stops after the number of records it expects.
+  bool next(TelemetryRecord &record);
+
+private:
+  bool readTimeDelta(int32_t &deltaOfDelta);
+  bool readFieldDelta(uint16_t previous, uint16_t &value);
+
+  BitReader reader_;
+  size_t count_;
+  uint32_t lastTime_;
+  uint32_t lastInterval_;
+  uint16_t last_[3];
+};
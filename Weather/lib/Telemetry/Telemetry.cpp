@@ -0,0 +1,150 @@
+#include "Telemetry.h"
+
+#include <math.h>
+
+static void putU16(uint8_t *p, uint16_t v) {
+  p[0] = v & 0xff;
+  p[1] = v >> 8;
+}
+
+static void putU32(uint8_t *p, uint32_t v) {
+  p[0] = v & 0xff;
+  p[1] = (v >> 8) & 0xff;
+  p[2] = (v >> 16) & 0xff;
+  p[3] = v >> 24;
+}
+
+static uint16_t getU16(const uint8_t *p) {
+  return p[0] | (p[1] << 8);
+}
+
+static uint32_t getU32(const uint8_t *p) {
+  return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static int32_t toFixed(float value, int32_t low, int32_t high) {
+  long scaled = lroundf(value * 100.0f);
+  if (scaled < low) return low;
+  if (scaled > high) return high;
+  return scaled;
+}
+
+TelemetryRecord telemetryRecord(uint32_t time, float temperature, float humidity, uint16_t mq135Raw) {
+  TelemetryRecord record;
+  record.seq = 0;
+  record.time = time;
+  record.temperatureCenti = isnan(temperature) ? TELEMETRY_MISSING
+                                               : (int16_t)toFixed(temperature, INT16_MIN + 1, INT16_MAX);
+  record.humidityCenti = isnan(humidity) ? 0xffff : (uint16_t)toFixed(humidity, 0, 0xfffe);
+  record.mq135Raw = mq135Raw;
+  return record;
+}
+
+TelemetryEncoder::TelemetryEncoder(uint8_t *buffer, size_t capacity, uint32_t firstSeq, uint32_t now,
+                                   bool compressed)
+    : buffer_(buffer), capacity_(capacity), length_(0), count_(0), lastTime_(0), compressed_(compressed),
+      series_(buffer + TELEMETRY_HEADER_SIZE,
+              capacity > TELEMETRY_HEADER_SIZE ? capacity - TELEMETRY_HEADER_SIZE : 0) {
+  if (capacity_ < TELEMETRY_HEADER_SIZE) {
+    capacity_ = 0;
+    return;
+  }
+  buffer_[0] = 'C';
+  buffer_[1] = 'S';
+  buffer_[2] = TELEMETRY_VERSION;
+  buffer_[3] = compressed ? TELEMETRY_COMPRESSED : 0;
+  putU16(buffer_ + 4, 0);
+  putU32(buffer_ + 6, firstSeq);
+  putU32(buffer_ + 10, 0);
+  putU32(buffer_ + 14, now);
+  length_ = TELEMETRY_HEADER_SIZE;
+}
+
+bool TelemetryEncoder::add(const TelemetryRecord &record) {
+  if (capacity_ == 0 || count_ == UINT16_MAX) return false;
+
+  if (compressed_) {
+    if (!series_.add(record)) return false;
+    if (count_ == 0) putU32(buffer_ + 10, record.time);
+    length_ = TELEMETRY_HEADER_SIZE + series_.bytes();
+    count_++;
+    return true;
+  }
+
+  uint32_t delta = count_ == 0 ? 0 : record.time - lastTime_;
+  uint8_t encoded[TELEMETRY_MAX_RECORD_SIZE];
+  size_t n = 0;
+  do {
+    uint8_t byte = delta & 0x7f;
+    delta >>= 7;
+    encoded[n++] = delta ? (byte | 0x80) : byte;
+  } while (delta);
+  putU16(encoded + n, (uint16_t)record.temperatureCenti);
+  putU16(encoded + n + 2, record.humidityCenti);
+  putU16(encoded + n + 4, record.mq135Raw);
+  n += 6;
+
+  if (length_ + n > capacity_) return false;
+  for (size_t i = 0; i < n; i++) buffer_[length_ + i] = encoded[i];
+  length_ += n;
+
+  if (count_ == 0) putU32(buffer_ + 10, record.time);
+  lastTime_ = record.time;
+  count_++;
+  return true;
+}
+
+size_t TelemetryEncoder::finish() {
+  if (capacity_ == 0) return 0;
+  putU16(buffer_ + 4, count_);
+  return length_;
+}
+
+bool TelemetryDecoder::begin(const uint8_t *data, size_t length) {
+  data_ = data;
+  length_ = length;
+  offset_ = TELEMETRY_HEADER_SIZE;
+  index_ = 0;
+  if (length < TELEMETRY_HEADER_SIZE || data[0] != 'C' || data[1] != 'S') return false;
+
+  version_ = data[2];
+  if (version_ < 1 || version_ > TELEMETRY_VERSION) return false;
+  compressed_ = (data[3] & TELEMETRY_COMPRESSED) != 0;
+  if (compressed_ && version_ < 2) return false;
+  if (compressed_) series_.begin(data + TELEMETRY_HEADER_SIZE, length - TELEMETRY_HEADER_SIZE);
+  count_ = getU16(data + 4);
+  firstSeq_ = getU32(data + 6);
+  time_ = getU32(data + 10);
+  encodedAt_ = getU32(data + 14);
+  return true;
+}
+
+bool TelemetryDecoder::next(TelemetryRecord &record) {
+  if (index_ >= count_) return false;
+
+  if (compressed_) {
+    if (!series_.next(record)) return false;
+    record.seq = firstSeq_ + index_;
+    index_++;
+    return true;
+  }
+
+  uint32_t delta = 0;
+  for (unsigned shift = 0;; shift += 7) {
+    if (offset_ >= length_ || shift > 28) return false;
+    uint8_t byte = data_[offset_++];
+    delta |= (uint32_t)(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) break;
+  }
+  if (offset_ + 6 > length_) return false;
+
+  time_ += delta;
+  record.seq = firstSeq_ + index_;
+  record.time = time_;
+  record.temperatureCenti = (int16_t)getU16(data_ + offset_);
+  record.humidityCenti = getU16(data_ + offset_ + 2);
+  record.mq135Raw = getU16(data_ + offset_ + 4);
+  offset_ += 6;
+  index_++;
+  return true;
+}
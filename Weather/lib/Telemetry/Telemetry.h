@@ -0,0 +1,105 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "SeriesCodec.h"
+
+// Compact binary telemetry shared by the firmware and host-side tools.
+//
+// A message is one header followed by `count` records (one for a single
+// reading, many for a batch). All integers are little-endian.
+//
+//   header, 18 bytes
+//     0  'C' 'S'     magic
+//     2  u8          version (TELEMETRY_VERSION; 1 is still decoded)
+//     3  u8          flags: TELEMETRY_COMPRESSED, other bits 0
+//     4  u16         count
+//     6  u32         sequence number of the first record; record i is seq + i
+//    10  u32         device time (ms) of the first record
+//    14  u32         device time (ms) when the message was encoded
+//
+//   record, 7 bytes + varint
+//     varint         ms since the previous record (the first record: 0)
+//     i16            temperature, 0.01 °C (TELEMETRY_MISSING if unknown)
+//     u16            humidity, 0.01 %
+//     u16            MQ-135 raw ADC count
+//
+// At the firmware's 2 s sample period a record is 8 bytes, against ~30 for
+// the equivalent JSON array.
+//
+// With TELEMETRY_COMPRESSED (version 2) the records after the header are
+// instead one SeriesCodec bit stream (see SeriesCodec.h), padded to a whole
+// byte; sequence numbers still follow from the header.
+
+static const uint8_t TELEMETRY_VERSION = 2;
+static const uint8_t TELEMETRY_COMPRESSED = 0x01;
+static const size_t TELEMETRY_HEADER_SIZE = 18;
+// Worst case per record in either encoding: varint + 6 bytes, or 96 bits
+static const size_t TELEMETRY_MAX_RECORD_SIZE = 12;
+static const int16_t TELEMETRY_MISSING = INT16_MIN;
+
+struct TelemetryRecord {
+  uint32_t seq;
+  uint32_t time;              // device ms
+  int16_t temperatureCenti;
+  uint16_t humidityCenti;
+  uint16_t mq135Raw;
+};
+
+// Converts floating-point readings to the record's fixed-point fields; NAN
+// temperature or humidity encodes as missing.
+TelemetryRecord telemetryRecord(uint32_t time, float temperature, float humidity, uint16_t mq135Raw);
+
+class TelemetryEncoder {
+public:
+  // Starts a message in `buffer`. Records must be added in time order.
+  TelemetryEncoder(uint8_t *buffer, size_t capacity, uint32_t firstSeq, uint32_t now,
+                   bool compressed = false);
+
+  // Returns false, leaving the message unchanged, when the record would not fit.
+  bool add(const TelemetryRecord &record);
+
+  // Patches the header and returns the total message size.
+  size_t finish();
+
+  uint16_t count() const { return count_; }
+
+private:
+  uint8_t *buffer_;
+  size_t capacity_;
+  size_t length_;
+  uint16_t count_;
+  uint32_t lastTime_;
+  bool compressed_;
+  SeriesEncoder series_;
+};
+
+class TelemetryDecoder {
+public:
+  // Returns false if the header is truncated, has the wrong magic or an
+  // unsupported version.
+  bool begin(const uint8_t *data, size_t length);
+
+  // Yields the next record; false at the end or on a truncated record.
+  bool next(TelemetryRecord &record);
+
+  uint8_t version() const { return version_; }
+  bool compressed() const { return compressed_; }
+  uint16_t count() const { return count_; }
+  uint32_t firstSeq() const { return firstSeq_; }
+  uint32_t encodedAt() const { return encodedAt_; }
+
+private:
+  const uint8_t *data_;
+  size_t length_;
+  size_t offset_;
+  uint8_t version_;
+  uint16_t count_;
+  uint16_t index_;
+  uint32_t firstSeq_;
+  uint32_t time_;
+  uint32_t encodedAt_;
+  bool compressed_;
+  SeriesDecoder series_;
+};
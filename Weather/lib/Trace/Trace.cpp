@@ -0,0 +1,152 @@
+#include "Trace.h"
+
+#include "Hal.h"
+
+#include <atomic>
+#include <stdarg.h>
+#include <stdio.h>
+
+namespace {
+
+struct TraceEvent {
+  const char *name;
+  uint32_t micros;
+  char phase;
+  uint8_t task;
+};
+
+// An event published the way SeqLock does it. `stamp` is written twice for
+// the event numbered `index`: writingStamp(index) before the fields and
+// publishedStamp(index) after them. The dump takes the event only if both of its
+// reads, before and after copying it, find the published stamp of the number it
+// expects. A slot still being written, or already overwritten by a newer
+// event, fails the check and is skipped.
+struct TraceSlot {
+  std::atomic<uint32_t> stamp;
+  TraceEvent event;
+};
+
+inline uint32_t writingStamp(uint32_t index) { return index * 2 + 1; }
+inline uint32_t publishedStamp(uint32_t index) { return index * 2 + 2; }
+
+// Tasks are numbered in the order they first record an event
+const uint8_t MAX_TASKS = 8;
+const uint8_t UNNUMBERED = 0xff;
+
+// With TRACE_EVENTS 0 nothing records, and the dump is empty
+const uint32_t CAPACITY = TRACE_EVENTS > 0 ? TRACE_EVENTS : 1;
+static_assert((CAPACITY & (CAPACITY - 1)) == 0, "TRACE_EVENTS must be a power of two");
+
+TraceSlot slots[CAPACITY];
+std::atomic<uint32_t> recorded(0);  // wraps; `filled` tells a full ring from an empty one
+std::atomic<bool> filled(false);
+std::atomic<bool> paused(false);
+std::atomic<TaskHandle_t> tasks[MAX_TASKS];
+
+uint8_t numberTask() {
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  for (uint8_t i = 0; i < MAX_TASKS; i++) {
+    TaskHandle_t seen = tasks[i].load(std::memory_order_acquire);
+    if (seen == self) return i;
+    if (seen == NULL && tasks[i].compare_exchange_strong(seen, self, std::memory_order_acq_rel)) return i;
+    if (seen == self) return i;  // another event of this task claimed it first
+  }
+  return MAX_TASKS;  // shown as "other"
+}
+
+// Each task looks itself up in `tasks` on its first event only
+uint8_t currentTask() {
+  static thread_local uint8_t number = UNNUMBERED;
+  if (number == UNNUMBERED) number = numberTask();
+  return number;
+}
+
+// Same buffering as MetricsWriter: lines are formatted in place and the
+// buffer is flushed before one that does not fit
+struct Output {
+  char *buffer;
+  size_t size;
+  size_t length;
+  TraceFlush flush;
+  void *context;
+
+  void line(const char *format, ...) __attribute__((format(printf, 2, 3))) {
+    for (int attempt = 0; attempt < 2; attempt++) {
+      va_list args;
+      va_start(args, format);
+      int n = vsnprintf(buffer + length, size - length, format, args);
+      va_end(args);
+      if (n >= 0 && (size_t)n < size - length) {
+        length += n;
+        return;
+      }
+      if (length == 0) return;
+      flush(context, buffer, length);
+      length = 0;
+    }
+  }
+};
+
+}  // namespace
+
+void traceEvent(const char *name, char phase) {
+  if (paused.load(std::memory_order_relaxed)) return;
+  uint32_t now = micros();
+  uint32_t index = recorded.fetch_add(1, std::memory_order_relaxed);
+  if (index % CAPACITY == CAPACITY - 1) filled.store(true, std::memory_order_relaxed);
+  uint8_t task = currentTask();
+  TraceSlot &slot = slots[index % CAPACITY];
+  slot.stamp.store(writingStamp(index), std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.event.name = name;
+  slot.event.micros = now;
+  slot.event.phase = phase;
+  slot.event.task = task;
+  slot.stamp.store(publishedStamp(index), std::memory_order_release);
+}
+
+// Copies out event `index`; false if its slot is being written or has been
+// reused since
+static bool readEvent(uint32_t index, TraceEvent &event) {
+  const TraceSlot &slot = slots[index % CAPACITY];
+  uint32_t before = slot.stamp.load(std::memory_order_acquire);
+  event = slot.event;
+  std::atomic_thread_fence(std::memory_order_acquire);
+  uint32_t after = slot.stamp.load(std::memory_order_relaxed);
+  return before == publishedStamp(index) && after == before;
+}
+
+void traceDump(char *buffer, size_t size, TraceFlush flush, void *context) {
+  paused.store(true);
+
+  Output out = {buffer, size, 0, flush, context};
+  out.line("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+  const char *separator = "";
+  for (uint8_t i = 0; i < MAX_TASKS; i++) {
+    TaskHandle_t task = tasks[i].load(std::memory_order_acquire);
+    if (task == NULL) break;
+    out.line("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}", separator,
+             i, pcTaskGetName(task));
+    separator = ",\n";
+  }
+
+  uint32_t end = recorded.load();
+  uint32_t begin = filled.load() ? end - CAPACITY : 0;
+  TraceEvent event;
+  bool first = true;
+  uint32_t base = 0;
+  for (uint32_t i = begin; i != end; i++) {
+    if (!readEvent(i, event)) continue;
+    if (first) base = event.micros;
+    first = false;
+    // Relative to the oldest event, so timestamps survive micros() wrapping
+    long long ts = (long long)base + (int32_t)(event.micros - base);
+    out.line("%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%lld,\"pid\":1,\"tid\":%u%s}", separator, event.name,
+             event.phase, ts, event.task, event.phase == 'i' ? ",\"s\":\"t\"" : "");
+    separator = ",\n";
+  }
+  out.line("]}\n");
+  if (out.length > 0) flush(context, buffer, out.length);
+
+  paused.store(false);
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Timeline of what the firmware's tasks spend their time on, for Perfetto
+// (ui.perfetto.dev) or chrome://tracing.
+//
+// TRACE_BEGIN/TRACE_END mark a span on the calling task, TRACE_SCOPE one
+// that ends with the enclosing block, TRACE_INSTANT a point in time. Each
+// records a name, a micros() timestamp and the task into a fixed ring of
+// TRACE_EVENTS events, overwriting the oldest, so the trace always covers
+// the most recent stretch. Recording claims a slot with one atomic
+// increment and publishes it with two stores to the slot's sequence word;
+// it never blocks or allocates. Names must be string literals, or at least
+// outlive the trace.
+//
+// traceDump() writes the ring as Chrome trace_event JSON. Recording pauses
+// while it runs; an event still being written when the dump reaches it is
+// left out rather than shown half-written.
+//
+// -DTRACE_EVENTS=0 compiles every TRACE_ macro to nothing.
+
+#ifndef TRACE_EVENTS
+#define TRACE_EVENTS 512
+#endif
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+
+#if TRACE_EVENTS > 0
+#define TRACE_BEGIN(name) traceEvent(name, 'B')
+#define TRACE_END(name) traceEvent(name, 'E')
+#define TRACE_INSTANT(name) traceEvent(name, 'i')
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope, __LINE__)(name)
+#else
+#define TRACE_BEGIN(name) \
+  do {                    \
+  } while (0)
+#define TRACE_END(name) TRACE_BEGIN(name)
+#define TRACE_INSTANT(name) TRACE_BEGIN(name)
+#define TRACE_SCOPE(name) TRACE_BEGIN(name)
+#endif
+
+// `phase` is a trace_event phase: 'B'egin, 'E'nd or 'i'nstant. Use the
+// TRACE_ macros instead.
+void traceEvent(const char *name, char phase);
+
+class TraceScope {
+public:
+  explicit TraceScope(const char *name) : name_(name) { traceEvent(name, 'B'); }
+  ~TraceScope() { traceEvent(name_, 'E'); }
+
+private:
+  const char *name_;
+};
+
+typedef void (*TraceFlush)(void *context, const char *data, size_t length);
+
+// Formats the recorded events into `buffer`, handing it to `flush` whenever
+// it fills up, as one JSON object. Timestamps are micros() since boot; the
+// ring must span less than the 71 minutes micros() takes to wrap.
+void traceDump(char *buffer, size_t size, TraceFlush flush, void *context);
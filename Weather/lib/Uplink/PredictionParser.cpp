@@ -0,0 +1,268 @@
+#include "PredictionParser.h"
+
+#include <string.h>
+
+static bool isSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static bool isNumberChar(char c) {
+  return (c >= '0' && c <= '9') || c == '.' || c == '-' || c == '+' || c == 'e' || c == 'E';
+}
+
+PredictionParser::PredictionParser() {
+  reset();
+}
+
+void PredictionParser::reset() {
+  memset(&result_, 0, sizeof(result_));
+  state_ = VALUE;
+  depth_ = 0;
+  objects_ = 0;
+  target_ = NONE;
+  pendingValue_ = NONE;
+  inPredictions_ = false;
+  tokenLength_ = 0;
+  errorLength_ = 0;
+}
+
+bool PredictionParser::feed(const char *data, size_t length) {
+  if (state_ == INVALID) return false;
+  for (size_t i = 0; i < length; i++) {
+    char c = data[i];
+
+    // Numbers and literals have no closing character: the first byte that
+    // does not belong to them ends them and is then parsed on its own.
+    if (state_ == NUMBER && !isNumberChar(c)) {
+      endNumber();
+      endValue();
+    } else if (state_ == LITERAL && !(c >= 'a' && c <= 'z')) {
+      endValue();
+    }
+
+    if (!step(c)) {
+      state_ = INVALID;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool PredictionParser::step(char c) {
+  switch (state_) {
+    case VALUE:
+      if (isSpace(c)) return true;
+      // Also accepts "[]": a closing bracket where an array element could go
+      if (c == ']' && depth_ > 0 && !inObject()) return closeContainer();
+      return beginValue(c);
+
+    case KEY_OR_END:
+      if (c == '}') return closeContainer();
+      // fall through
+
+    case KEY:
+      if (isSpace(c)) return true;
+      if (c != '"') return false;
+      target_ = KEY_TEXT;
+      tokenLength_ = 0;
+      state_ = STRING;
+      return true;
+
+    case COLON:
+      if (isSpace(c)) return true;
+      if (c != ':') return false;
+      state_ = VALUE;
+      return true;
+
+    case AFTER_VALUE:
+      if (isSpace(c)) return true;
+      if (depth_ == 0) return false;  // trailing data after the document
+      if (c == ',') {
+        state_ = inObject() ? KEY : VALUE;
+        return true;
+      }
+      if (c == (inObject() ? '}' : ']')) return closeContainer();
+      return false;
+
+    case STRING:
+      if (c == '\\') {
+        state_ = STRING_ESCAPE;
+        return true;
+      }
+      if (c == '"') {
+        if (target_ == KEY_TEXT) {
+          endKey();
+          state_ = COLON;
+        } else {
+          endValue();
+        }
+        return true;
+      }
+      // fall through
+    case STRING_ESCAPE:
+      // Escapes are kept as their second character; none of the keys we
+      // match contain any, and the error text is only for logging.
+      if (state_ == STRING_ESCAPE) state_ = STRING;
+      if (target_ == KEY_TEXT) {
+        if (tokenLength_ < MAX_TOKEN) token_[tokenLength_++] = c;
+      } else if (target_ == ERROR_TEXT && errorLength_ < sizeof(result_.error) - 1) {
+        result_.error[errorLength_++] = c;
+      }
+      return true;
+
+    case NUMBER:
+      return numberChar(c);
+
+    case LITERAL:
+      return true;
+
+    case INVALID:
+      return false;
+  }
+  return false;
+}
+
+bool PredictionParser::beginValue(char c) {
+  target_ = pendingValue_;
+  pendingValue_ = NONE;
+
+  if (c == '{' || c == '[') {
+    if (depth_ >= MAX_DEPTH) return false;
+    if (c == '{') {
+      objects_ |= (1u << depth_);
+    } else {
+      objects_ &= ~(1u << depth_);
+    }
+    depth_++;
+    if (depth_ == 2 && target_ == PREDICTIONS && c == '{') inPredictions_ = true;
+    target_ = NONE;
+    state_ = (c == '{') ? KEY_OR_END : VALUE;
+    return true;
+  }
+
+  if (c == '"') {
+    if (target_ != ERROR_TEXT) target_ = NONE;
+    state_ = STRING;
+    return true;
+  }
+
+  if (c == '-' || (c >= '0' && c <= '9')) {
+    if (target_ != TEMPERATURE && target_ != HUMIDITY && target_ != AQI) target_ = NONE;
+    beginNumber(c);
+    state_ = NUMBER;
+    return true;
+  }
+
+  if (c == 't' || c == 'f' || c == 'n') {
+    target_ = NONE;
+    state_ = LITERAL;
+    return true;
+  }
+
+  return false;
+}
+
+bool PredictionParser::closeContainer() {
+  if (depth_ == 2) inPredictions_ = false;
+  depth_--;
+  endValue();
+  return true;
+}
+
+void PredictionParser::endValue() {
+  if (target_ == ERROR_TEXT) result_.error[errorLength_] = '\0';
+  target_ = NONE;
+  state_ = AFTER_VALUE;
+}
+
+// Decides what the value following this key is for, based on where we are
+void PredictionParser::endKey() {
+  pendingValue_ = NONE;
+  target_ = NONE;
+  if (tokenLength_ >= MAX_TOKEN) return;  // longer than any key we want
+  token_[tokenLength_] = '\0';
+
+  if (depth_ == 1) {
+    if (strcmp(token_, "next_day_predictions") == 0) {
+      pendingValue_ = PREDICTIONS;
+    } else if (strcmp(token_, "error") == 0) {
+      pendingValue_ = ERROR_TEXT;
+    }
+  } else if (depth_ == 2 && inPredictions_) {
+    if (strcmp(token_, "temperature") == 0) {
+      pendingValue_ = TEMPERATURE;
+    } else if (strcmp(token_, "humidity") == 0) {
+      pendingValue_ = HUMIDITY;
+    } else if (strcmp(token_, "aqi") == 0) {
+      pendingValue_ = AQI;
+    }
+  }
+}
+
+void PredictionParser::beginNumber(char c) {
+  mantissa_ = 0;
+  scale_ = 0;
+  exponent_ = 0;
+  numberPart_ = 0;
+  negative_ = (c == '-');
+  exponentNegative_ = false;
+  if (!negative_) mantissa_ = c - '0';
+}
+
+// Accumulates one character of a number. Digits beyond what fits in 32 bits
+// only adjust the scale, which keeps far more precision than a float holds.
+bool PredictionParser::numberChar(char c) {
+  if (c >= '0' && c <= '9') {
+    if (numberPart_ >= 2) {
+      numberPart_ = 3;
+      if (exponent_ < 1000) exponent_ = exponent_ * 10 + (c - '0');
+    } else if (mantissa_ < 400000000u) {
+      mantissa_ = mantissa_ * 10 + (c - '0');
+      if (numberPart_ == 1) scale_--;
+    } else if (numberPart_ == 0) {
+      scale_++;
+    }
+    return true;
+  }
+  if (c == '.' && numberPart_ == 0) {
+    numberPart_ = 1;
+    return true;
+  }
+  if ((c == 'e' || c == 'E') && numberPart_ < 2) {
+    numberPart_ = 2;
+    return true;
+  }
+  if ((c == '-' || c == '+') && numberPart_ == 2) {
+    exponentNegative_ = (c == '-');
+    numberPart_ = 3;
+    return true;
+  }
+  return false;
+}
+
+void PredictionParser::endNumber() {
+  if (target_ == NONE) return;
+
+  int power = scale_ + (exponentNegative_ ? -exponent_ : exponent_);
+  double value = mantissa_;
+  for (; power > 0; power--) value *= 10;
+  for (; power < 0; power++) value /= 10;
+  if (negative_) value = -value;
+
+  switch (target_) {
+    case TEMPERATURE:
+      result_.temperature = value;
+      result_.found |= PredictionResult::TEMPERATURE;
+      break;
+    case HUMIDITY:
+      result_.humidity = value;
+      result_.found |= PredictionResult::HUMIDITY;
+      break;
+    case AQI:
+      result_.aqi = value;
+      result_.found |= PredictionResult::AQI;
+      break;
+    default:
+      break;
+  }
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ResponseSink.h"
+
+// Next-day values extracted from a /predict response body.
+struct PredictionResult {
+  enum Field : uint8_t { TEMPERATURE = 1, HUMIDITY = 2, AQI = 4, ALL = 7 };
+
+  float temperature;
+  float humidity;
+  float aqi;
+  uint8_t found;     // Field bits seen so far
+  char error[64];    // top-level "error" string from the server, if any
+};
+
+// Streaming JSON scanner for the prediction API's reply, e.g.
+//   {"next_day_predictions":{"aqi":104.18,"humidity":73.21,"temperature":31.71}}
+//
+// Bytes are fed as they arrive from the socket and each one is looked at
+// once. Keys are matched by name at their nesting level, so the server may
+// reorder keys, add fields or change whitespace. State is a fixed-size
+// object; nothing is allocated, keys are buffered only up to the longest one
+// we match, and numbers are accumulated digit by digit as they arrive.
+class PredictionParser : public ResponseSink {
+public:
+  static const uint8_t MAX_DEPTH = 16;
+
+  PredictionParser();
+
+  void reset();
+
+  // Returns false once the input is not valid JSON; further bytes are ignored.
+  bool feed(const char *data, size_t length);
+
+  void onBody(const char *data, size_t length) override { feed(data, length); }
+
+  bool failed() const { return state_ == INVALID; }
+  bool complete() const { return result_.found == PredictionResult::ALL; }
+  const PredictionResult &result() const { return result_; }
+
+private:
+  enum State : uint8_t {
+    VALUE,          // expecting any value
+    KEY_OR_END,     // just after '{'
+    KEY,            // after ',' in an object
+    COLON,
+    AFTER_VALUE,    // expecting ',' or a closing bracket
+    STRING,
+    STRING_ESCAPE,
+    NUMBER,
+    LITERAL,        // true / false / null
+    INVALID
+  };
+
+  // What the string or number being read will be used for
+  enum Target : uint8_t { NONE, KEY_TEXT, ERROR_TEXT, PREDICTIONS, TEMPERATURE, HUMIDITY, AQI };
+
+  static const uint8_t MAX_TOKEN = 24;
+
+  bool step(char c);
+  bool beginValue(char c);
+  bool closeContainer();
+  void endValue();
+  void endKey();
+  void beginNumber(char c);
+  bool numberChar(char c);
+  void endNumber();
+  bool inObject() const { return depth_ > 0 && (objects_ & (1u << (depth_ - 1))) != 0; }
+
+  PredictionResult result_;
+  State state_;
+  uint8_t depth_;
+  uint16_t objects_;        // bit n set: container at depth n+1 is an object
+  Target target_;
+  Target pendingValue_;     // set by the last key, consumed by its value
+  bool inPredictions_;      // inside the top-level "next_day_predictions"
+  uint8_t tokenLength_;
+  char token_[MAX_TOKEN];
+  uint8_t errorLength_;
+
+  // Number being read: value = mantissa * 10^(scale + exponent)
+  uint32_t mantissa_;
+  int16_t scale_;
+  int16_t exponent_;
+  uint8_t numberPart_;      // 0 integer, 1 fraction, 2 exponent sign, 3 exponent
+  bool negative_;
+  bool exponentNegative_;
+};
@@ -0,0 +1,278 @@
+#include "PredictionUplink.h"
+
+#include <errno.h>
+
+#include "Trace.h"
+
+// Trace span of each network phase
+static const char *phaseName(PredictionUplink::State state) {
+  switch (state) {
+    case PredictionUplink::CONNECTING: return "uplink connect";
+    case PredictionUplink::SENDING: return "uplink send";
+    case PredictionUplink::AWAITING: return "uplink await";
+    case PredictionUplink::RECEIVING: return "uplink receive";
+    default: return NULL;
+  }
+}
+
+PredictionUplink::PredictionUplink()
+    : port_(80), state_(IDLE), reported_(true), socket_(-1), phaseStart_(0), error_(""),
+      requestHeadLength_(0), requestBody_(NULL), requestBodyLength_(0), sent_(0), sink_(NULL), headLength_(0), terminatorMatched_(0),
+      httpStatus_(0) {
+  host_[0] = '\0';
+  path_[0] = '\0';
+  memset(&address_, 0, sizeof(address_));
+  memset(&timings_, 0, sizeof(timings_));
+}
+
+bool PredictionUplink::begin(const char *url, const UplinkConfig &config) {
+  config_ = config;
+
+  static const char SCHEME[] = "http://";
+  if (strncmp(url, SCHEME, sizeof(SCHEME) - 1) != 0) return false;
+  const char *host = url + sizeof(SCHEME) - 1;
+
+  const char *path = strchr(host, '/');
+  if (!path) path = host + strlen(host);
+  const char *colon = (const char *)memchr(host, ':', path - host);
+  const char *hostEnd = colon ? colon : path;
+
+  size_t hostLength = hostEnd - host;
+  if (hostLength == 0 || hostLength >= sizeof(host_)) return false;
+  memcpy(host_, host, hostLength);
+  host_[hostLength] = '\0';
+
+  port_ = colon ? (uint16_t)atoi(colon + 1) : 80;
+  if (port_ == 0) return false;
+
+  if (*path == '\0') path = "/";
+  if (strlen(path) >= sizeof(path_)) return false;
+  strcpy(path_, path);
+
+  address_.sin_family = AF_INET;
+  address_.sin_port = htons(port_);
+  address_.sin_addr.s_addr = 0;
+  return true;
+}
+
+// IP literals resolve instantly; a hostname costs one DNS lookup, after which
+// the address is reused for every later exchange.
+bool PredictionUplink::resolve() {
+  if (address_.sin_addr.s_addr != 0) return true;
+  if (inet_pton(AF_INET, host_, &address_.sin_addr) == 1) return true;
+
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo *result = NULL;
+  if (getaddrinfo(host_, NULL, &hints, &result) != 0 || result == NULL) return false;
+  address_.sin_addr = ((struct sockaddr_in *)result->ai_addr)->sin_addr;
+  freeaddrinfo(result);
+  return true;
+}
+
+bool PredictionUplink::start(const char *body, size_t length, ResponseSink &sink,
+                             const char *contentType) {
+  if (busy()) return false;
+
+  int headLength = snprintf(requestHead_, sizeof(requestHead_),
+                              "POST %s HTTP/1.1\r\n"
+                              "Host: %s:%u\r\n"
+                              "Content-Type: %s\r\n"
+                              "Content-Length: %u\r\n"
+                              "Connection: close\r\n"
+                              "\r\n",
+                              path_, host_, port_, contentType, (unsigned)length);
+  if (headLength < 0 || (size_t)headLength >= sizeof(requestHead_)) {
+    fail("request head too large");
+    return false;
+  }
+  requestHeadLength_ = headLength;
+  requestBody_ = body;
+  requestBodyLength_ = length;
+  sent_ = 0;
+  sink_ = &sink;
+  headLength_ = 0;
+  terminatorMatched_ = 0;
+  httpStatus_ = 0;
+  memset(&timings_, 0, sizeof(timings_));
+
+  if (!resolve()) {
+    fail("DNS lookup failed");
+    return false;
+  }
+
+  socket_ = socket(AF_INET, SOCK_STREAM, 0);
+  if (socket_ < 0) {
+    fail("socket() failed");
+    return false;
+  }
+  fcntl(socket_, F_SETFL, fcntl(socket_, F_GETFL, 0) | O_NONBLOCK);
+
+  enter(CONNECTING);
+  if (connect(socket_, (struct sockaddr *)&address_, sizeof(address_)) == 0) {
+    timings_.connectMs = networkMillis() - phaseStart_;
+    enter(SENDING);
+  } else if (errno != EINPROGRESS) {
+    fail("connect failed");
+    return false;
+  }
+  return true;
+}
+
+void PredictionUplink::enter(State next) {
+  if (phaseName(state_)) TRACE_END(phaseName(state_));
+  if (phaseName(next)) TRACE_BEGIN(phaseName(next));
+  state_ = next;
+  phaseStart_ = networkMillis();
+}
+
+PredictionUplink::State PredictionUplink::fail(const char *error) {
+  if (socket_ >= 0) {
+    close(socket_);
+    socket_ = -1;
+  }
+  error_ = error;
+  if (phaseName(state_)) TRACE_END(phaseName(state_));
+  TRACE_INSTANT("uplink failed");
+  state_ = FAILED;
+  reported_ = false;
+  return state_;
+}
+
+bool PredictionUplink::timedOut(uint32_t limitMs) const {
+  return networkMillis() - phaseStart_ >= limitMs;
+}
+
+// A finished exchange is reported by exactly one poll(); body() and error()
+// stay valid until the next start()
+PredictionUplink::State PredictionUplink::poll() {
+  if (state_ == DONE || state_ == FAILED) {
+    if (reported_) state_ = IDLE;
+    reported_ = true;
+    return state_;
+  }
+
+  State state = advance();
+  if (state == DONE || state == FAILED) reported_ = true;
+  return state;
+}
+
+PredictionUplink::State PredictionUplink::advance() {
+  switch (state_) {
+    case CONNECTING: {
+      fd_set writable;
+      FD_ZERO(&writable);
+      FD_SET(socket_, &writable);
+      struct timeval noWait = {0, 0};
+      if (select(socket_ + 1, NULL, &writable, NULL, &noWait) <= 0) {
+        if (timedOut(config_.connectTimeoutMs)) return fail("connect timeout");
+        break;
+      }
+
+      int socketError = 0;
+      socklen_t errorLength = sizeof(socketError);
+      getsockopt(socket_, SOL_SOCKET, SO_ERROR, &socketError, &errorLength);
+      if (socketError != 0) return fail("connect refused");
+
+      timings_.connectMs = networkMillis() - phaseStart_;
+      enter(SENDING);
+    }
+      // fall through
+
+    case SENDING: {
+      // Head and body go out from their own buffers; nothing is copied
+      size_t total = requestHeadLength_ + requestBodyLength_;
+      while (sent_ < total) {
+        bool inHead = sent_ < requestHeadLength_;
+        const char *from = inHead ? requestHead_ + sent_ : requestBody_ + (sent_ - requestHeadLength_);
+        size_t remaining = inHead ? requestHeadLength_ - sent_ : total - sent_;
+
+        int n = send(socket_, from, remaining, MSG_DONTWAIT);
+        if (n > 0) {
+          sent_ += n;
+          continue;
+        }
+        if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) return fail("send failed");
+        break;
+      }
+
+      if (sent_ < total) {
+        if (timedOut(config_.sendTimeoutMs)) return fail("send timeout");
+        break;
+      }
+      timings_.sendMs = networkMillis() - phaseStart_;
+      enter(AWAITING);
+    }
+      // fall through
+
+    case AWAITING:
+    case RECEIVING:
+      for (;;) {
+        char chunk[128];
+        int n = recv(socket_, chunk, sizeof(chunk), MSG_DONTWAIT);
+        if (n > 0) {
+          if (state_ == AWAITING) {
+            timings_.awaitMs = networkMillis() - phaseStart_;
+            enter(RECEIVING);
+          }
+          if (!consume(chunk, n)) return fail("malformed response");
+          continue;
+        }
+        if (n == 0) {
+          timings_.receiveMs = networkMillis() - phaseStart_;
+          close(socket_);
+          socket_ = -1;
+          if (httpStatus_ == 0 || terminatorMatched_ != 4) return fail("truncated response");
+          TRACE_END(phaseName(state_));
+          state_ = DONE;
+          reported_ = false;
+          return state_;
+        }
+        if (errno != EAGAIN && errno != EWOULDBLOCK) return fail("receive failed");
+        break;
+      }
+
+      if (state_ == AWAITING && timedOut(config_.responseTimeoutMs)) return fail("response timeout");
+      if (state_ == RECEIVING && timedOut(config_.receiveTimeoutMs)) return fail("receive timeout");
+      break;
+
+    case IDLE:
+    case DONE:
+    case FAILED:
+      break;
+  }
+  return state_;
+}
+
+// Parses the status line, skips the remaining headers and streams whatever
+// follows them to the sink. Returns false on a malformed head.
+bool PredictionUplink::consume(const char *data, size_t length) {
+  static const char TERMINATOR[] = "\r\n\r\n";
+  size_t i = 0;
+
+  while (terminatorMatched_ < 4 && i < length) {
+    char c = data[i++];
+    if (++headLength_ > MAX_RESPONSE_HEAD) return false;
+
+    if (headLength_ <= sizeof(statusLine_) - 1) {
+      statusLine_[headLength_ - 1] = c;
+      if (headLength_ == sizeof(statusLine_) - 1) {
+        statusLine_[headLength_] = '\0';
+        if (strncmp(statusLine_, "HTTP/1.", 7) != 0) return false;
+        httpStatus_ = atoi(statusLine_ + 9);
+        if (httpStatus_ < 100) return false;
+      }
+    }
+
+    if (c == TERMINATOR[terminatorMatched_]) {
+      terminatorMatched_++;
+    } else {
+      terminatorMatched_ = (c == '\r') ? 1 : 0;
+    }
+  }
+
+  if (i < length && httpStatus_ != 0) sink_->onBody(data + i, length - i);
+  return terminatorMatched_ < 4 || httpStatus_ != 0;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Hal.h"
+#include "Sockets.h"
+
+#include "ResponseSink.h"
+
+// Per-phase limits for one uplink exchange, in milliseconds.
+struct UplinkConfig {
+  uint32_t connectTimeoutMs;   // TCP handshake
+  uint32_t sendTimeoutMs;      // writing the request
+  uint32_t responseTimeoutMs;  // request sent -> first response byte
+  uint32_t receiveTimeoutMs;   // first byte -> server closes the connection
+};
+
+// Wall time spent in each phase of the last exchange, in milliseconds.
+struct UplinkTimings {
+  uint32_t connectMs;
+  uint32_t sendMs;
+  uint32_t awaitMs;
+  uint32_t receiveMs;
+};
+
+// Non-blocking HTTP/1.1 POST client for the prediction API.
+//
+// start() only queues the request; poll() advances the exchange through
+// connect, send, await and receive using a non-blocking socket and returns
+// immediately, so the caller's loop keeps running while the server thinks.
+// Each phase has its own timeout from UplinkConfig. DONE or FAILED is
+// returned by exactly one poll(), after which the uplink is IDLE again.
+//
+// The status line is parsed in place and the body is handed to a
+// ResponseSink in socket-sized pieces; the response is never buffered whole.
+class PredictionUplink {
+public:
+  enum State { IDLE, CONNECTING, SENDING, AWAITING, RECEIVING, DONE, FAILED };
+
+  static const size_t MAX_REQUEST_HEAD = 256;
+  static const size_t MAX_RESPONSE_HEAD = 1024;
+
+  PredictionUplink();
+
+  // Parses an "http://host[:port]/path" endpoint. Returns false if malformed.
+  bool begin(const char *url, const UplinkConfig &config);
+
+  // Starts a POST of `body` unless an exchange is already in flight; the
+  // reply body goes to `sink`. `body` is sent in place and must stay valid
+  // until the exchange finishes. Setup errors are reported as FAILED by the
+  // next poll().
+  bool start(const char *body, size_t length, ResponseSink &sink,
+             const char *contentType = "application/json");
+
+  State poll();
+
+  State state() const { return state_; }
+  bool busy() const { return state_ != IDLE && state_ != DONE && state_ != FAILED; }
+
+  // Valid after poll() has returned DONE
+  int httpStatus() const { return httpStatus_; }
+
+  // Valid after poll() has returned FAILED
+  const char *error() const { return error_; }
+
+  const UplinkTimings &timings() const { return timings_; }
+
+private:
+  bool resolve();
+  State advance();
+  void enter(State next);
+  State fail(const char *error);
+  bool consume(const char *data, size_t length);
+  bool timedOut(uint32_t limitMs) const;
+
+  UplinkConfig config_;
+  char host_[64];
+  char path_[64];
+  uint16_t port_;
+  struct sockaddr_in address_;
+
+  State state_;
+  bool reported_;
+  int socket_;
+  unsigned long phaseStart_;
+  UplinkTimings timings_;
+  const char *error_;
+
+  char requestHead_[MAX_REQUEST_HEAD];
+  size_t requestHeadLength_;
+  const char *requestBody_;
+  size_t requestBodyLength_;
+  size_t sent_;
+
+  ResponseSink *sink_;
+  size_t headLength_;
+  uint8_t terminatorMatched_;  // progress through "\r\n\r\n"
+  char statusLine_[13];        // "HTTP/1.1 200"
+  int httpStatus_;
+};
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <stddef.h>
+
+// Receives an HTTP response body as it comes off the socket.
+class ResponseSink {
+public:
+  virtual ~ResponseSink() {}
+  virtual void onBody(const char *data, size_t length) = 0;
+};
@@ -0,0 +1,74 @@
+"""
+PlatformIO pre-build step: gzip the dashboard shell into a flash-resident byte array.
+
+Reads web/index.html, compresses it once at build time and writes include/dashboard_html.h
+with the compressed bytes, the page as is for clients that do not accept gzip, their lengths
+and an ETag for each derived from the content. The header is only rewritten when the page
+changes so incremental builds stay incremental.
+
+Runs automatically via `extra_scripts` in platformio.ini, or by hand:
+    python scripts/embed_web.py
+"""
+
+import gzip
+import hashlib
+import os
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCE_PATH = os.path.join(PROJECT_DIR, "web", "index.html")
+HEADER_PATH = os.path.join(PROJECT_DIR, "include", "dashboard_html.h")
+
+
+def byte_array(name, data):
+    lines = [f"static const uint8_t {name}[] PROGMEM = {{"]
+    for i in range(0, len(data), 16):
+        chunk = data[i:i + 16]
+        lines.append("  " + ", ".join(f"0x{b:02x}" for b in chunk) + ",")
+    lines.append("};")
+    return lines
+
+
+def render_header(raw, compressed):
+    # The two encodings are different representations, so their strong ETags differ
+    etag = hashlib.sha1(raw).hexdigest()[:16]
+    lines = [
+        "// Generated by scripts/embed_web.py from web/index.html - do not edit.",
+        "#pragma once",
+        "",
+        "#include \"Hal.h\"",
+        "",
+        f"// {len(raw)} bytes of HTML, {len(compressed)} bytes gzipped",
+        f"static const char DASHBOARD_ETAG[] = \"\\\"{etag}\\\"\";",
+        f"static const char DASHBOARD_RAW_ETAG[] = \"\\\"{etag}-identity\\\"\";",
+        f"static const size_t DASHBOARD_HTML_GZ_LEN = {len(compressed)};",
+        f"static const size_t DASHBOARD_HTML_LEN = {len(raw)};",
+    ]
+    lines += byte_array("DASHBOARD_HTML_GZ", compressed)
+    lines += byte_array("DASHBOARD_HTML", raw)
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    with open(SOURCE_PATH, "rb") as f:
+        raw = f.read()
+
+    # mtime=0 keeps the output byte-identical across builds
+    compressed = gzip.compress(raw, compresslevel=9, mtime=0)
+    header = render_header(raw, compressed)
+
+    if os.path.exists(HEADER_PATH):
+        with open(HEADER_PATH, "r") as f:
+            if f.read() == header:
+                return
+
+    with open(HEADER_PATH, "w") as f:
+        f.write(header)
+    print(f"Embedded {SOURCE_PATH}: {len(raw)} -> {len(compressed)} bytes gzipped")
+
+
+main()
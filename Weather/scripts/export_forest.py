@@ -0,0 +1,650 @@
+"""
+Export the next-day RandomForest (forecast_model.pkl) to C++ for on-device inference.
+
+Writes lib/Forecast/NextDayModel.cpp, with every tree's nodes in one flat array plus the
+leaf values, and bench/forest_parity_vectors.h, with feature vectors and the outputs the
+model gives for them, which bench/forest_parity.cpp checks the C++ engine against.
+
+It also writes lib/Forecast/NextDayModelQuantized.cpp, the same forest with int16
+features, thresholds and leaf values in breadth-first order (see QuantizedForest.h).
+Trees are ordered greedily, each one the tree that brings the partial forest closest to
+the full one, and a byte budget keeps the longest prefix that fits. --budget takes one or
+more budgets, in bytes or as a percentage of the full forest (default 100% 50% 25%); the
+first is exported, and bench/forest_quantized_budgets.h gets how many of the exported
+trees, nodes and leaves each budget keeps, so bench/forest_quantized_bench.cpp can
+compare the budgets as prefixes of NEXT_DAY_QUANTIZED. A
+size/accuracy table for several prefixes, against the next-day means in sensor_data.csv,
+is printed as well.
+
+Inputs are float32 inside scikit-learn's tree code, so a node sends x left when
+float32(x) <= threshold with a float64 threshold. Thresholds are exported as the largest
+float32 not above the float64 value, which makes the float32 comparison on the device
+give the same answer for every input.
+
+The expected outputs come from model.predict() when scikit-learn is installed; it must be
+the version the model was saved with. The script also replays predict() on the trees read
+from the pickle: float32 inputs, float64 thresholds and leaf values, trees summed in order
+and divided by their count, which is what RandomForestRegressor.predict() computes. The
+replay must agree with predict() to 1e-9, or nothing is written. Without scikit-learn the
+pickle is read directly (numeric arrays only, no code is executed from it) and the replay
+gives the expected outputs.
+
+Run from the repo root or Weather/ whenever the model is retrained:
+    python Weather/scripts/export_forest.py [path/to/forecast_model.pkl] [--budget BYTES|PERCENT ...]
+"""
+
+import argparse
+import csv
+import math
+import os
+import pickle
+import random
+import struct
+import sys
+from collections import OrderedDict
+
+WEATHER_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+REPO_DIR = os.path.dirname(WEATHER_DIR)
+MODEL_PATH = os.path.join(REPO_DIR, "forecast_model.pkl")
+CSV_PATH = os.path.join(REPO_DIR, "sensor_data.csv")
+SOURCE_PATH = os.path.join(WEATHER_DIR, "lib", "Forecast", "NextDayModel.cpp")
+VECTORS_PATH = os.path.join(WEATHER_DIR, "bench", "forest_parity_vectors.h")
+QUANTIZED_PATH = os.path.join(WEATHER_DIR, "lib", "Forecast", "NextDayModelQuantized.cpp")
+BUDGETS_PATH = os.path.join(WEATHER_DIR, "bench", "forest_quantized_budgets.h")
+
+LAG_DAYS = 3
+
+
+class Tree:
+    def __init__(self, left, right, feature, threshold, values):
+        self.left = left            # child ids, -1 at leaves
+        self.right = right
+        self.feature = feature
+        self.threshold = threshold  # float64
+        self.values = values        # per node, one value per output
+
+    def predict(self, x):
+        node = 0
+        while self.left[node] != -1:
+            node = self.left[node] if x[self.feature[node]] <= self.threshold[node] else self.right[node]
+        return self.values[node]
+
+
+# ---------------------------------------------------------------------------
+# Loading
+
+
+def load_with_sklearn(path):
+    import joblib
+    import numpy as np
+    import sklearn
+
+    model = joblib.load(path)
+    saved = getattr(model, "_sklearn_version", None)
+    if saved != sklearn.__version__:
+        sys.exit(f"{os.path.basename(path)} was saved with scikit-learn {saved}, "
+                 f"but {sklearn.__version__} is installed; install {saved} to export it")
+    trees = []
+    for estimator in model.estimators_:
+        t = estimator.tree_
+        trees.append(Tree(t.children_left.tolist(), t.children_right.tolist(), t.feature.tolist(),
+                          t.threshold.tolist(), t.value[:, :, 0].tolist()))
+    names = [str(n) for n in getattr(model, "feature_names_in_", [])]
+
+    def predict(rows):
+        return model.predict(np.array(rows, dtype=np.float32)).tolist()
+
+    source = f"scikit-learn {saved} RandomForestRegressor.predict()"
+    return trees, model.n_outputs_, names, predict, source
+
+
+class _Stub:
+    """Stands in for any class the pickle names; only keeps the state it is given."""
+
+    def __init__(self, *args, **kwargs):
+        self._args = args
+
+    def __setstate__(self, state):
+        self._state = state
+
+
+class _JoblibReader(pickle._Unpickler):
+    """Reads a joblib pickle without numpy: classes become _Stub, arrays become lists."""
+
+    _stubs = {}
+
+    def __init__(self, file):
+        pickle._Unpickler.__init__(self, file)
+        self.file = file
+
+    def find_class(self, module, name):
+        key = (module, name)
+        if key not in self._stubs:
+            self._stubs[key] = type(name, (_Stub,), {})
+        return self._stubs[key]
+
+    def load_build(self):
+        pickle._Unpickler.load_build(self)
+        if type(self.stack[-1]).__name__ == "NumpyArrayWrapper":
+            self.stack[-1] = self.read_array(self.stack[-1]._state)
+
+    dispatch = dict(pickle._Unpickler.dispatch)
+    dispatch[pickle.BUILD[0]] = load_build
+
+    @staticmethod
+    def dtype_layout(dtype):
+        """(struct format, itemsize, fields) for a pickled numpy dtype."""
+        code, state = dtype._args[0], dtype._state
+        if state[4]:
+            fields = {name: (_JoblibReader.dtype_layout(spec[0]), spec[1]) for name, spec in state[4].items()}
+            return None, state[5], fields
+        kind, size = code[0], int(code[1:])
+        if kind == "O":
+            return "O", size, None
+        formats = {"f": {4: "f", 8: "d"}, "i": {1: "b", 2: "h", 4: "i", 8: "q"},
+                   "u": {1: "B", 2: "H", 4: "I", 8: "Q"}, "b": {1: "?"}}
+        return formats[kind][size], size, None
+
+    def read_array(self, wrapper):
+        fmt, itemsize, fields = self.dtype_layout(wrapper["dtype"])
+        count = 1
+        for n in wrapper["shape"]:
+            count *= n
+        if fmt == "O":
+            return _JoblibReader(self.file).load()
+        if wrapper.get("numpy_array_alignment_bytes"):
+            self.file.read(self.file.read(1)[0])
+        raw = self.file.read(count * itemsize)
+        if fields is None:
+            return list(struct.unpack(f"<{count}{fmt}", raw))
+        return [{name: struct.unpack_from("<" + layout[0], raw, i * itemsize + offset)[0]
+                 for name, (layout, offset) in fields.items()} for i in range(count)]
+
+
+def load_without_sklearn(path):
+    with open(path, "rb") as f:
+        state = _JoblibReader(f).load()._state
+
+    n_outputs = state["n_outputs_"]
+    trees = []
+    for estimator in state["estimators_"]:
+        tree = estimator._state["tree_"]._state
+        nodes = tree["nodes"]
+        flat = tree["values"]
+        values = [flat[i * n_outputs:(i + 1) * n_outputs] for i in range(len(nodes))]
+        trees.append(Tree([n["left_child"] for n in nodes], [n["right_child"] for n in nodes],
+                          [n["feature"] for n in nodes], [n["threshold"] for n in nodes], values))
+
+    names = state.get("feature_names_in_")
+    names = list(names._state[4]) if names is not None else []
+    source = (f"scikit-learn {state.get('_sklearn_version')} RandomForestRegressor.predict(), "
+              "replayed on the pickled trees (scikit-learn not installed)")
+    return trees, n_outputs, names, None, source
+
+
+def replay_predict(trees, n_outputs, rows):
+    """RandomForestRegressor.predict() on the trees: each input is cast to float32 and
+    compared with the float64 thresholds, and the float64 leaf values are summed tree by
+    tree, then divided by the number of trees."""
+    out = []
+    for row in rows:
+        x = [float32(v) for v in row]
+        sums = [0.0] * n_outputs
+        for tree in trees:
+            for o, v in enumerate(tree.predict(x)):
+                sums[o] += v
+        out.append([s / len(trees) for s in sums])
+    return out
+
+
+# ---------------------------------------------------------------------------
+# Export
+
+
+def float32(value):
+    return struct.unpack("<f", struct.pack("<f", value))[0]
+
+
+def float32_at_most(value):
+    """Largest float32 <= value, so float32(x) <= it exactly when float32(x) <= value."""
+    f = float32(value)
+    if f <= value:
+        return f
+    bits = struct.unpack("<I", struct.pack("<f", f))[0]
+    bits = bits - 1 if f > 0 else bits + 1
+    return struct.unpack("<f", struct.pack("<I", bits))[0]
+
+
+def c_float(value):
+    text = repr(float32(value))
+    if "e" not in text and "." not in text and "inf" not in text:
+        text += ".0"
+    return text + "f"
+
+
+def flatten(trees):
+    """Nodes of all trees in one list, each tree in preorder, plus roots and leaf rows."""
+    nodes, roots, leaves = [], [], []
+    for tree in trees:
+        roots.append(len(nodes))
+        index = {}
+        order = []
+        stack = [0]
+        while stack:
+            node = stack.pop()
+            index[node] = len(nodes) + len(order)
+            order.append(node)
+            if tree.left[node] != -1:
+                stack.append(tree.right[node])
+                stack.append(tree.left[node])
+        for node in order:
+            if tree.left[node] == -1:
+                nodes.append((0.0, len(leaves), 0, -1))
+                leaves.append(tree.values[node])
+            else:
+                nodes.append((float32_at_most(tree.threshold[node]), index[tree.left[node]],
+                              index[tree.right[node]], tree.feature[node]))
+    return nodes, roots, leaves
+
+
+def render_source(model_path, nodes, roots, leaves, n_features, n_outputs, names):
+    lines = [
+        f"// Generated by scripts/export_forest.py from {os.path.basename(model_path)} - do not edit.",
+        "#include \"NextDayModel.h\"",
+        "",
+        f"// {len(roots)} trees, {len(nodes)} nodes, {len(leaves)} leaves",
+        f"// features: {', '.join(names)}" if names else "// features: unnamed",
+        "static const ForestNode NODES[] = {",
+    ]
+    for threshold, left, right, feature in nodes:
+        lines.append(f"    {{{c_float(threshold)}, {left}, {right}, {feature}}},")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const uint16_t ROOTS[] = {")
+    for i in range(0, len(roots), 12):
+        lines.append("    " + ", ".join(str(r) for r in roots[i:i + 12]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const float LEAF_VALUES[] = {")
+    for leaf in leaves:
+        lines.append("    " + ", ".join(c_float(v) for v in leaf) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("const ForestModel NEXT_DAY_MODEL = {")
+    lines.append(f"    NODES, ROOTS, LEAF_VALUES, {len(roots)}, {len(nodes)}, {len(leaves)}, {n_features}, {n_outputs},")
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+# ---------------------------------------------------------------------------
+# Quantized model
+
+QUANTIZED_NODE_BYTES = 6
+QUANTIZED_LEAF = 0xff
+
+
+def power_of_two_scale(bound, limit):
+    """Largest power of two s with bound * s <= limit."""
+    return 2.0 ** math.floor(math.log2(limit / bound)) if bound > 0 else 1.0
+
+
+def quantize_feature(value, scale):
+    return max(-32768, min(32767, math.floor(float32(value) * scale)))
+
+
+class QuantizedTree:
+    def __init__(self, tree, feature_scale, output_scale):
+        # Breadth-first, with both children of a node appended together
+        self.nodes, self.leaves = [], []
+        order = [0]
+        for node in order:
+            if tree.left[node] == -1:
+                continue
+            order += [tree.left[node], tree.right[node]]
+        index = {node: i for i, node in enumerate(order)}
+        for node in order:
+            if tree.left[node] == -1:
+                self.nodes.append((0, len(self.leaves), QUANTIZED_LEAF))
+                self.leaves.append([round(v * s) for v, s in zip(tree.values[node], output_scale)])
+            else:
+                f = tree.feature[node]
+                # floor(x * s) <= floor(t * s) whenever x <= t; inputs within one step
+                # above t are the only ones that can go the other way
+                threshold = math.floor(tree.threshold[node] * feature_scale[f])
+                self.nodes.append((threshold, index[tree.left[node]], f))
+
+    def predict(self, q):
+        node = 0
+        while self.nodes[node][2] != QUANTIZED_LEAF:
+            threshold, left, feature = self.nodes[node]
+            node = left if q[feature] <= threshold else left + 1
+        return self.leaves[self.nodes[node][1]]
+
+    def bytes(self, n_outputs):
+        return len(self.nodes) * QUANTIZED_NODE_BYTES + len(self.leaves) * n_outputs * 2 + 2
+
+
+def quantize(trees, n_features, n_outputs):
+    # Thresholds stay strictly inside int16, so clamped inputs still compare right
+    feature_bound = [0.0] * n_features
+    for tree in trees:
+        for f, t in zip(tree.feature, tree.threshold):
+            if f >= 0:
+                feature_bound[f] = max(feature_bound[f], abs(t))
+    output_bound = [max(abs(v[o]) for tree in trees for v in tree.values) for o in range(n_outputs)]
+    feature_scale = [power_of_two_scale(b, 32766) for b in feature_bound]
+    output_scale = [power_of_two_scale(b, 32767) for b in output_bound]
+    return [QuantizedTree(t, feature_scale, output_scale) for t in trees], feature_scale, output_scale
+
+
+def order_by_fidelity(qtrees, rows, reference, feature_scale, output_scale):
+    """Greedy tree order: each step adds the tree that brings the mean of the trees
+    chosen so far closest to the full forest on `rows`, per output relative to its spread."""
+    n_outputs = len(output_scale)
+    qrows = [[quantize_feature(v, s) for v, s in zip(row, feature_scale)] for row in rows]
+    leaves = [[tree.predict(q) for q in qrows] for tree in qtrees]
+    weights = []
+    for o in range(n_outputs):
+        column = [r[o] for r in reference]
+        mean = sum(column) / len(column)
+        spread = sum((v - mean) ** 2 for v in column) / len(column)
+        weights.append(1.0 / (max(spread, 1e-6) * output_scale[o] ** 2))
+    targets = [[r[o] * output_scale[o] for o in range(n_outputs)] for r in reference]
+
+    sums = [[0] * n_outputs for _ in rows]
+    remaining = list(range(len(qtrees)))
+    order = []
+    while remaining:
+        k = len(order) + 1
+        best, best_error = None, None
+        for t in remaining:
+            error = 0.0
+            for r, leaf in enumerate(leaves[t]):
+                for o in range(n_outputs):
+                    d = (sums[r][o] + leaf[o]) / k - targets[r][o]
+                    error += d * d * weights[o]
+            if best_error is None or error < best_error:
+                best, best_error = t, error
+        order.append(best)
+        remaining.remove(best)
+        for r, leaf in enumerate(leaves[best]):
+            for o in range(n_outputs):
+                sums[r][o] += leaf[o]
+    return [qtrees[t] for t in order]
+
+
+def quantized_bytes(qtrees, n_features, n_outputs):
+    return sum(t.bytes(n_outputs) for t in qtrees) + (n_features + n_outputs) * 4
+
+
+def quantized_bytes_of(nodes, roots, leaves, n_features, n_outputs):
+    """quantized_bytes() of flattened arrays."""
+    return (len(nodes) * QUANTIZED_NODE_BYTES + len(roots) * 2 + len(leaves) * n_outputs * 2 +
+            (n_features + n_outputs) * 4)
+
+
+def parse_budget(text, full):
+    """Bytes for a --budget value: a byte count, or a percentage of the full forest's size."""
+    try:
+        if text.endswith("%"):
+            return int(full * float(text[:-1]) / 100)
+        return int(text)
+    except ValueError:
+        sys.exit(f"--budget {text}: expected bytes or a percentage such as 50%")
+
+
+def quantized_predict(qtrees, row, feature_scale, output_scale):
+    q = [quantize_feature(v, s) for v, s in zip(row, feature_scale)]
+    sums = [0] * len(output_scale)
+    for tree in qtrees:
+        for o, v in enumerate(tree.predict(q)):
+            sums[o] += v
+    return [s / len(qtrees) / scale for s, scale in zip(sums, output_scale)]
+
+
+def report(qtrees, kept, n_features, feature_scale, output_scale, days, targets, rows, reference):
+    n_outputs = len(output_scale)
+    print(f"{'trees':>5} {'bytes':>6}   MAE vs next day (t / h / aqi)   max diff from float forest")
+    sizes = sorted({n for n in (10, 25, 50, 100, 150, len(qtrees), *kept.values()) if 0 < n <= len(qtrees)})
+    for n in sizes:
+        subset = qtrees[:n]
+        mae = [0.0] * n_outputs
+        for row, target in zip(days, targets):
+            for o, v in enumerate(quantized_predict(subset, row, feature_scale, output_scale)):
+                mae[o] += abs(v - target[o]) / len(days)
+        diff = [0.0] * n_outputs
+        for row, ref in zip(rows, reference):
+            for o, v in enumerate(quantized_predict(subset, row, feature_scale, output_scale)):
+                diff[o] = max(diff[o], abs(v - ref[o]))
+        mark = "".join(f" <- {label}" for label, trees in kept.items() if trees == n)
+        print(f"{n:>5} {quantized_bytes(subset, n_features, n_outputs):>6}   "
+              f"{mae[0]:6.3f} / {mae[1]:6.3f} / {mae[2]:6.3f}      "
+              f"{diff[0]:6.3f} / {diff[1]:6.3f} / {diff[2]:6.3f}{mark}")
+    print(f"  ({len(days)} days of {os.path.basename(CSV_PATH)}, {len(rows)} vectors for the diff)")
+
+
+def flatten_quantized(qtrees):
+    """Nodes of all trees in one list, child and leaf indices made global, plus roots and leaf rows."""
+    nodes, roots, leaves = [], [], []
+    for tree in qtrees:
+        roots.append(len(nodes))
+        base, leaf_base = len(nodes), len(leaves)
+        for threshold, left, feature in tree.nodes:
+            if feature == QUANTIZED_LEAF:
+                nodes.append((0, leaf_base + left, feature))
+            else:
+                nodes.append((threshold, base + left, feature))
+        leaves += tree.leaves
+    return nodes, roots, leaves
+
+
+def render_quantized(model_path, nodes, roots, leaves, n_features, n_outputs, feature_scale, output_scale,
+                     budget, total):
+    lines = [
+        f"// Generated by scripts/export_forest.py from {os.path.basename(model_path)} - do not edit.",
+        "#include \"NextDayModel.h\"",
+        "",
+        f"// {len(roots)} of {total} trees ({budget}), {len(nodes)} nodes, {len(leaves)} leaves,",
+        f"// {quantized_bytes_of(nodes, roots, leaves, n_features, n_outputs)} bytes",
+        "static const QuantizedNode NODES[] = {",
+    ]
+    for threshold, left, feature in nodes:
+        lines.append(f"    {{{threshold}, {left}, {feature}}},")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const uint16_t ROOTS[] = {")
+    for i in range(0, len(roots), 12):
+        lines.append("    " + ", ".join(str(r) for r in roots[i:i + 12]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const int16_t LEAF_VALUES[] = {")
+    for leaf in leaves:
+        lines.append("    " + ", ".join(str(v) for v in leaf) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const float FEATURE_SCALE[] = {" + ", ".join(c_float(s) for s in feature_scale) + "};")
+    lines.append("static const float OUTPUT_SCALE[] = {" + ", ".join(c_float(s) for s in output_scale) + "};")
+    lines.append("")
+    lines.append("const QuantizedForest NEXT_DAY_QUANTIZED = {")
+    lines.append(f"    NODES, ROOTS, LEAF_VALUES, FEATURE_SCALE, OUTPUT_SCALE, {len(roots)}, {len(nodes)}, "
+                 f"{len(leaves)}, {n_features}, {n_outputs},")
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def render_budgets(model_path, nodes, roots, budgets):
+    """Per budget, the prefix of the exported forest (`nodes`, `roots`) it keeps."""
+    lines = [
+        f"// Generated by scripts/export_forest.py from {os.path.basename(model_path)} - do not edit.",
+        "// The prefix of NEXT_DAY_QUANTIZED's trees each --budget keeps; the first budget",
+        "// is the one NextDayModelQuantized.cpp was exported with.",
+        "#pragma once",
+        "",
+        "#include <stddef.h>",
+        "#include <stdint.h>",
+        "",
+        "struct ForestBudget {",
+        "  const char *label;",
+        "  uint16_t trees;  // the first `trees` of NEXT_DAY_QUANTIZED",
+        "  uint16_t nodes;",
+        "  uint16_t leaves;",
+        "};",
+        "",
+        "static const ForestBudget BUDGETS[] = {",
+    ]
+    for label, trees in budgets:
+        end = roots[trees] if trees < len(roots) else len(nodes)
+        leaf_count = sum(1 for _, _, feature in nodes[:end] if feature == QUANTIZED_LEAF)
+        lines.append(f"    {{\"{label}\", {trees}, {end}, {leaf_count}}},")
+    lines.append("};")
+    lines.append(f"static const size_t BUDGET_COUNT = {len(budgets)};")
+    return "\n".join(lines) + "\n"
+
+
+# ---------------------------------------------------------------------------
+# Parity vectors
+
+
+def csv_day(timestamp):
+    """The DD-MM-YYYY date of a sensor_data.csv timestamp, which app.py writes day-first;
+    rows from an earlier /ingest are ISO-8601 with a 'T'."""
+    if "T" in timestamp:
+        return "-".join(reversed(timestamp.split("T")[0].split("-")))
+    return timestamp.split(" ")[0]
+
+
+def daily_means(path):
+    """Per-day (temperature, humidity, aqi) means from the CSV, in date order."""
+    days = OrderedDict()
+    with open(path, newline="") as f:
+        for row in csv.DictReader(f):
+            day = csv_day(row["timestamp"])
+            sums = days.setdefault(day, [0.0, 0.0, 0.0, 0])
+            sums[0] += float(row["temperature_c"])
+            sums[1] += float(row["humidity_pct"])
+            sums[2] += float(row["aqi"])
+            sums[3] += 1
+    return [(t / n, h / n, a / n) for t, h, a, n in days.values()]
+
+
+def lag_rows(means, n_features):
+    """Lag vectors built like the training set (t-1 first) for every day with
+    LAG_DAYS before it, including the day after the last one."""
+    rows = []
+    for day in range(LAG_DAYS, len(means) + 1):
+        row = []
+        for lag in range(1, LAG_DAYS + 1):
+            row += list(means[day - lag])
+        rows.append(row[:n_features])
+    return rows
+
+
+def parity_rows(trees, n_features):
+    """Lag vectors from the CSV plus perturbed copies, and separately copies with
+    one feature sitting exactly on a root split's float32 threshold."""
+    means = daily_means(CSV_PATH) if os.path.exists(CSV_PATH) else []
+    typical = lag_rows(means, n_features)
+    rng = random.Random(0)
+    base = typical or [[30.0, 70.0, 100.0] * LAG_DAYS]
+    while len(typical) < 64:
+        row = rng.choice(base)
+        typical.append([v * rng.uniform(0.9, 1.1) for v in row[:n_features]])
+    boundary = []
+    for tree in trees[:32]:
+        row = list(rng.choice(base))
+        row[tree.feature[0]] = float32(tree.threshold[0])
+        boundary.append(row)
+    return typical, boundary
+
+
+def render_vectors(rows, typical, expected, source):
+    lines = [
+        "// Generated by scripts/export_forest.py - do not edit.",
+        f"// Expected outputs from: {source}",
+        "#pragma once",
+        "",
+        f"static const char PARITY_SOURCE[] = \"{source}\";",
+        f"static const size_t PARITY_COUNT = {len(rows)};",
+        "// Inputs past the first PARITY_TYPICAL have one feature exactly on a split threshold",
+        f"static const size_t PARITY_TYPICAL = {typical};",
+        "static const float PARITY_INPUTS[][9] = {",
+    ]
+    for row in rows:
+        lines.append("    {" + ", ".join(c_float(v) for v in row) + "},")
+    lines.append("};")
+    lines.append("static const double PARITY_EXPECTED[][3] = {")
+    for out in expected:
+        lines.append("    {" + ", ".join(repr(float(v)) for v in out) + "},")
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def write(path, text):
+    with open(path, "w", newline="\n") as f:
+        f.write(text)
+    print(f"wrote {os.path.relpath(path, REPO_DIR)}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Export forecast_model.pkl to C++.")
+    parser.add_argument("model", nargs="?", default=MODEL_PATH)
+    parser.add_argument("--budget", nargs="+", default=["100%", "50%", "25%"],
+                        help="bytes, or a percentage of the full quantized forest, each ensemble may take; "
+                             "the first is exported for the firmware, the rest go to the bench only")
+    args = parser.parse_args()
+    model_path = args.model
+    try:
+        trees, n_outputs, names, predict, source = load_with_sklearn(model_path)
+    except ImportError:
+        trees, n_outputs, names, predict, source = load_without_sklearn(model_path)
+
+    n_features = 1 + max(f for tree in trees for f in tree.feature)
+    if n_features != 9 or n_outputs != 3:
+        sys.exit(f"expected 9 features and 3 outputs, got {n_features} and {n_outputs}")
+    nodes, roots, leaves = flatten(trees)
+    if len(nodes) > 0xffff or len(leaves) > 0xffff:
+        sys.exit(f"{len(nodes)} nodes / {len(leaves)} leaves do not fit 16-bit indices")
+
+    write(SOURCE_PATH, render_source(model_path, nodes, roots, leaves, n_features, n_outputs, names))
+    typical, boundary = parity_rows(trees, n_features)
+    rows = typical + boundary
+    reference = replay_predict(trees, n_outputs, rows)
+    if predict:
+        predicted = predict(rows)
+        error = max(abs(a - b) for r, p in zip(reference, predicted) for a, b in zip(r, p))
+        if error > 1e-9:
+            sys.exit(f"replaying predict() on the trees is off by {error:.3g}; nothing written")
+        reference = predicted
+    write(VECTORS_PATH, render_vectors(rows, len(typical), reference, source))
+
+    # Quantization moves every threshold by up to one step, so the boundary rows
+    # are left out of tree selection and of the comparison with the float forest
+    rows, reference = typical, reference[:len(typical)]
+    qtrees, feature_scale, output_scale = quantize(trees, n_features, n_outputs)
+    qtrees = order_by_fidelity(qtrees, rows, reference, feature_scale, output_scale)
+    full = quantized_bytes(qtrees, n_features, n_outputs)
+    kept = OrderedDict()
+    for text in args.budget:
+        budget = parse_budget(text, full)
+        trees_kept = len(qtrees)
+        while trees_kept > 1 and quantized_bytes(qtrees[:trees_kept], n_features, n_outputs) > budget:
+            trees_kept -= 1
+        kept[text] = trees_kept
+    means = daily_means(CSV_PATH) if os.path.exists(CSV_PATH) else []
+    days = lag_rows(means, n_features)[:-1]
+    report(qtrees, kept, n_features, feature_scale, output_scale, days, means[LAG_DAYS:], rows, reference)
+
+    exported = kept[args.budget[0]]
+    qnodes, qroots, qleaves = flatten_quantized(qtrees[:exported])
+    write(QUANTIZED_PATH, render_quantized(model_path, qnodes, qroots, qleaves, n_features, n_outputs,
+                                           feature_scale, output_scale, f"budget {args.budget[0]}", len(qtrees)))
+    # The bench runs the other budgets as prefixes of the exported forest, so none can be larger
+    for label, trees in kept.items():
+        if trees > exported:
+            print(f"budget {label} keeps {trees} trees, more than the {exported} exported; the bench runs {exported}")
+    budgets = [(label, min(trees, exported)) for label, trees in kept.items()]
+    write(BUDGETS_PATH, render_budgets(model_path, qnodes, qroots, budgets))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,100 @@
+"""
+PlatformIO pre-build step: collect the firmware's log format strings into a decoding table.
+
+With -DLOG_BINARY the device sends the FNV-1a hash of each format string instead of the text
+(see lib/Log/Log.h). This finds every LOG_ERROR/WARN/INFO/DEBUG and LOG_FORMAT_ID call in src/
+and lib/, hashes its format the way the compiler does, and writes one "<hash>\t<format>" line
+per string to log_formats.txt in the build directory, for tools/log_decode.cpp. Two formats
+with the same hash fail the build; rewording either one fixes it.
+
+Runs automatically via `extra_scripts` in platformio.ini, or by hand (to stdout by default):
+    python scripts/log_formats.py [output]
+"""
+
+import os
+import re
+import sys
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+    TABLE_PATH = os.path.join(env.subst("$BUILD_DIR"), "log_formats.txt")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    TABLE_PATH = sys.argv[1] if len(sys.argv) > 1 else None  # stdout
+
+SOURCE_DIRS = ["src", "lib"]
+CALL = re.compile(rb'\b(?:LOG_(?:ERROR|WARN|INFO|DEBUG)|LOG_FORMAT_ID)\s*\(\s*((?:"(?:[^"\\\n]|\\.)*"\s*)+)')
+LITERAL = re.compile(rb'"((?:[^"\\\n]|\\.)*)"')
+ESCAPES = {b"n": b"\n", b"t": b"\t", b"r": b"\r", b"0": b"\0", b"\\": b"\\", b'"': b'"', b"'": b"'"}
+
+
+def unescape(literal):
+    out = bytearray()
+    i = 0
+    while i < len(literal):
+        c = literal[i:i + 1]
+        if c != b"\\":
+            out += c
+            i += 1
+        elif literal[i + 1:i + 2] == b"x":
+            digits = re.match(rb"[0-9a-fA-F]+", literal[i + 2:]).group(0)
+            out.append(int(digits, 16) & 0xff)
+            i += 2 + len(digits)
+        else:
+            out += ESCAPES[literal[i + 1:i + 2]]
+            i += 2
+    return bytes(out)
+
+
+def fnv1a(data):
+    value = 2166136261
+    for b in data:
+        value = ((value ^ b) * 16777619) & 0xffffffff
+    return value
+
+
+def collect():
+    formats = {}
+    for top in SOURCE_DIRS:
+        for root, _, files in os.walk(os.path.join(PROJECT_DIR, top)):
+            for name in sorted(files):
+                if not name.endswith((".cpp", ".h")):
+                    continue
+                path = os.path.join(root, name)
+                with open(path, "rb") as f:
+                    source = f.read()
+                for call in CALL.finditer(source):
+                    text = b"".join(unescape(m.group(1)) for m in LITERAL.finditer(call.group(1)))
+                    key = fnv1a(text)
+                    if formats.get(key, text) != text:
+                        raise SystemExit(f"log_formats: {path}: {text!r} and {formats[key]!r} share hash {key:08x}")
+                    formats[key] = text
+    return formats
+
+
+def render_table(formats):
+    lines = ["# Generated by scripts/log_formats.py - format hash, then the format with \\\\, \\n and \\t escaped"]
+    for key, text in sorted(formats.items()):
+        escaped = text.replace(b"\\", b"\\\\").replace(b"\n", b"\\n").replace(b"\t", b"\\t")
+        lines.append(f"{key:08x}\t" + escaped.decode("utf-8", "replace"))
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    table = render_table(collect())
+    if TABLE_PATH is None:
+        sys.stdout.write(table)
+        return
+    if os.path.exists(TABLE_PATH):
+        with open(TABLE_PATH, "r", encoding="utf-8") as f:
+            if f.read() == table:
+                return
+
+    os.makedirs(os.path.dirname(os.path.abspath(TABLE_PATH)), exist_ok=True)
+    with open(TABLE_PATH, "w", encoding="utf-8") as f:
+        f.write(table)
+    print(f"Wrote {table.count(chr(10)) - 1} log formats to {TABLE_PATH}")
+
+
+main()
@@ -1,663 +1,1058 @@
-#include <WiFi.h>
-#include <HTTPClient.h>
-#include "DHT.h"
-
-#define DHTPIN 4
-#define DHTTYPE DHT11
-#define MQ135PIN 34
-
-// API endpoint configuration
-const char* API_ENDPOINT = "http://10.38.192.228:5000/predict";
-const unsigned long API_INTERVAL = 60000; // Send data every 60 seconds
-
-DHT dht(DHTPIN, DHTTYPE);
-
-const char* ssid = "vivo Y02t";
-const char* password = "sakethwaste";
-
-WiFiServer server(80);
-
-// Global variables to store predictions
-float predictedAQI = 0;
-float predictedHumidity = 0;
-float predictedTemperature = 0;
-bool predictionAvailable = false;
-
-void connectToWiFi() {
-  Serial.printf("Connecting to WiFi SSID: %s\n", ssid);
-  WiFi.begin(ssid, password);
-
-  int retryCount = 0;
-  while (WiFi.status() != WL_CONNECTED && retryCount < 20) {
-    delay(1000);
-    Serial.print(".");
-    retryCount++;
-  }
-
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.println("\nWiFi connected.");
-    Serial.print("IP address: ");
-    Serial.println(WiFi.localIP());
-    server.begin();
-  } else {
-    Serial.println("\nFailed to connect to WiFi.");
-  }
-}
-
-const char* interpretAirQuality(float raw) {
-  if (raw < 150) return "Excellent";
-  else if (raw < 300) return "Good";
-  else if (raw < 450) return "Fair";
-  else if (raw < 600) return "Poor";
-  else return "Very Poor";
-}
-
-void handleClient(WiFiClient &client) {
-  Serial.println("New client connected");
-
-  String request = "";
-  unsigned long timeout = millis() + 2000;
-
-  while (client.connected() && millis() < timeout) {
-    while (client.available()) {
-      char c = client.read();
-      request += c;
-      if (request.endsWith("\r\n\r\n")) {
-        timeout = 0;
-        break;
-      }
-    }
-    delay(1);
-  }
-
-  float humidity = dht.readHumidity();
-  float temperature = dht.readTemperature();
-  int mq135Raw = analogRead(MQ135PIN);
-  float mq135Voltage = mq135Raw * (3.3 / 4095.0);
-  
-
-  if (isnan(humidity) || isnan(temperature)) {
-    Serial.println("Failed to read from DHT sensor!");
-    humidity = 0;
-    temperature = 0;
-  }
-
-  Serial.printf("Temperature: %.1f °C, Humidity: %.1f %%\n", temperature, humidity);
-  Serial.printf("MQ-135 Raw: %d, Voltage: %.2f V\n", mq135Raw, mq135Voltage);
-
-  client.println("HTTP/1.1 200 OK");
-  client.println("Content-Type: text/html; charset=UTF-8");
-  client.println("Connection: close");
-  client.println();
-
-  client.println(R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-<meta charset="UTF-8" />
-<meta name="viewport" content="width=device-width, initial-scale=1" />
-<meta http-equiv="refresh" content="5" />
-<title>ESP32 Environmental Dashboard</title>
-<link href="https://fonts.googleapis.com/css2?family=Poppins:wght@400;600;700&display=swap" rel="stylesheet">
-<style>
-:root {
-  --bg-light: #fdf6e3;
-  --bg-dark: #2b2a28;
-  --card-light: rgba(255, 255, 240, 0.95);
-  --card-dark: rgba(44, 38, 32, 0.85);
-  --prediction-light: rgba(230, 245, 255, 0.95);
-  --prediction-dark: rgba(32, 44, 52, 0.85);
-  --text-light: #222;
-  --text-dark: #eee;
-  --accent-light: #6b8e23;
-  --accent-dark: #a1c181;
-  --prediction-accent-light: #2196F3;
-  --prediction-accent-dark: #64B5F6;
-  --border-color-light: #d2c1a3;
-  --border-color-dark: #5a5045;
-}
-
-html, body {
-  margin: 0;
-  padding: 0;
-  font-family: 'Poppins', sans-serif;
-  transition: background 0.5s, color 0.5s;
-}
-
-body.light {
-  background: var(--bg-light);
-  color: var(--text-light);
-}
-
-body.dark {
-  background: var(--bg-dark);
-  color: var(--text-dark);
-}
-
-header {
-  text-align: center;
-  padding: 30px 40px 10px 40px;
-  position: relative;
-}
-
-.toggle-wrapper {
-  position: absolute;
-  top: 30px;
-  right: 40px;
-}
-
-.logo-title {
-  display: flex;
-  align-items: center;
-  justify-content: center;
-  gap: 12px;
-  margin-bottom: 5px;
-}
-
-.logo {
-  font-size: 2.5rem;
-}
-
-h1 {
-  font-weight: 700;
-  font-size: 2rem;
-  margin: 0;
-  background: linear-gradient(90deg, var(--accent-light), #556b2f);
-  -webkit-background-clip: text;
-  -webkit-text-fill-color: transparent;
-}
-
-.subtitle {
-  font-size: 0.95rem;
-  opacity: 0.8;
-  margin-top: 8px;
-  font-weight: 400;
-}
-
-.toggle-btn {
-  padding: 10px 24px;
-  border: none;
-  border-radius: 25px;
-  cursor: pointer;
-  font-weight: 600;
-  font-size: 0.9rem;
-  background: var(--accent-light);
-  color: #fff;
-  transition: all 0.3s;
-  box-shadow: 0 4px 12px rgba(0,0,0,0.15);
-}
-
-.toggle-btn:hover {
-  background: #556b2f;
-  transform: translateY(-2px);
-  box-shadow: 0 6px 16px rgba(0,0,0,0.25);
-}
-
-.section-title {
-  text-align: center;
-  font-size: 1.5rem;
-  font-weight: 700;
-  margin: 30px 0 10px 0;
-  color: var(--accent-light);
-}
-
-body.dark .section-title {
-  color: var(--accent-dark);
-}
-
-.section-subtitle {
-  text-align: center;
-  font-size: 0.9rem;
-  opacity: 0.7;
-  margin-bottom: 20px;
-}
-
-.grid {
-  display: grid;
-  grid-template-columns: repeat(auto-fit, minmax(280px, 1fr));
-  gap: 32px;
-  padding: 20px 40px;
-  max-width: 1100px;
-  margin: auto;
-}
-
-.card {
-  padding: 24px 28px;
-  border-radius: 16px;
-  backdrop-filter: blur(8px);
-  box-shadow: 0 6px 18px rgba(0,0,0,0.15);
-  display: flex;
-  flex-direction: column;
-  align-items: center;
-  text-align: center;
-  border: 1.5px solid var(--border-color-light);
-  transition: transform 0.3s, box-shadow 0.3s;
-  background: var(--card-light);
-}
-
-body.dark .card {
-  background: var(--card-dark);
-  border-color: var(--border-color-dark);
-}
-
-.card:hover {
-  transform: translateY(-5px);
-  box-shadow: 0 12px 25px rgba(0,0,0,0.25);
-}
-
-.card.prediction {
-  background: var(--prediction-light);
-  border-color: var(--prediction-accent-light);
-}
-
-body.dark .card.prediction {
-  background: var(--prediction-dark);
-  border-color: var(--prediction-accent-dark);
-}
-
-.label {
-  font-weight: 600;
-  font-size: 1.1rem;
-  margin-bottom: 8px;
-}
-
-.prediction-badge {
-  display: inline-block;
-  padding: 4px 12px;
-  border-radius: 12px;
-  font-size: 0.75rem;
-  font-weight: 600;
-  margin-bottom: 8px;
-  background: var(--prediction-accent-light);
-  color: white;
-}
-
-body.dark .prediction-badge {
-  background: var(--prediction-accent-dark);
-}
-
-.value {
-  font-size: 2rem;
-  font-weight: 700;
-  margin-bottom: 6px;
-}
-
-.interpretation {
-  font-size: 1rem;
-  font-weight: 600;
-  color: var(--accent-light);
-}
-
-body.dark .interpretation {
-  color: var(--accent-dark);
-}
-
-.card.prediction .interpretation {
-  color: var(--prediction-accent-light);
-}
-
-body.dark .card.prediction .interpretation {
-  color: var(--prediction-accent-dark);
-}
-
-.info-section {
-  max-width: 1100px;
-  margin: 20px auto;
-  padding: 20px 25px;
-  border-radius: 16px;
-  backdrop-filter: blur(8px);
-  border: 1.5px solid var(--border-color-light);
-  background: var(--card-light);
-}
-
-body.dark .info-section {
-  background: rgba(44, 38, 32, 0.85);
-  border-color: var(--border-color-dark);
-}
-
-.info-section h2 {
-  font-weight: 700;
-  margin-top: 0;
-  color: var(--accent-light);
-}
-
-body.dark .info-section h2 {
-  color: var(--accent-dark);
-}
-
-.info-section ul {
-  padding-left: 20px;
-  line-height: 1.8;
-}
-
-footer {
-  text-align: center;
-  padding: 25px 20px;
-  font-size: 0.9rem;
-  opacity: 0.7;
-}
-
-.no-prediction {
-  font-size: 0.9rem;
-  opacity: 0.7;
-  font-style: italic;
-}
-
-@media (max-width: 768px) {
-  header {
-    padding: 20px;
-  }
-  
-  .toggle-wrapper {
-    position: static;
-    margin-top: 15px;
-  }
-  
-  .grid {
-    padding: 20px;
-  }
-}
-</style>
-</head>
-<body class="light">
-<header>
-  <div class="logo-title">
-    <span class="logo">🌿</span>
-    <h1>ClimeScope</h1>
-  </div>
-  <div class="subtitle">ESP32 Environmental Monitoring Dashboard with AI Predictions</div>
-  <div class="toggle-wrapper">
-    <button class="toggle-btn" onclick="toggleMode()">🌙 Toggle Dark/Light</button>
-  </div>
-</header>
-
-<div class="section-title">📊 Current Readings</div>
-<div class="section-subtitle">Real-time sensor data</div>
-
-<div class="grid">
-  <div class="card">
-    <div class="label">Temperature</div>
-    <div class="value">)rawliteral");
-
-  client.printf("%.1f &deg;C", temperature);
-
-  client.println(R"rawliteral(
-    </div>
-  </div>
-
-  <div class="card">
-    <div class="label">Humidity</div>
-    <div class="value">)rawliteral");
-
-  client.printf("%.1f %%", humidity);
-
-  client.println(R"rawliteral(
-    </div>
-  </div>
-
-  <div class="card">
-    <div class="label">Air Quality (MQ-135)</div>
-    <div class="value">)rawliteral");
-
-  client.printf("%d<br><span style='font-size:1rem;'>%.2f V</span>", mq135Raw, mq135Voltage);
-
-  client.println(R"rawliteral(
-    </div>
-    <div class="interpretation">)rawliteral");
-
-  client.print(interpretAirQuality(mq135Raw));
-
-  client.println(R"rawliteral(
-    </div>
-  </div>
-</div>
-
-<div class="section-title">🔮 Next Day Predictions</div>
-<div class="section-subtitle">AI model predictions (updates every 60 seconds)</div>
-
-<div class="grid">)rawliteral");
-
-  if (predictionAvailable) {
-    // Temperature prediction
-    client.println(R"rawliteral(
-  <div class="card prediction">
-    <div class="prediction-badge">🤖 AI PREDICTED</div>
-    <div class="label">Temperature</div>
-    <div class="value">)rawliteral");
-    
-    client.printf("%.2f &deg;C", predictedTemperature);
-    
-    client.println(R"rawliteral(
-    </div>
-  </div>
-
-  <div class="card prediction">
-    <div class="prediction-badge">🤖 AI PREDICTED</div>
-    <div class="label">Humidity</div>
-    <div class="value">)rawliteral");
-    
-    client.printf("%.2f %%", predictedHumidity);
-    
-    client.println(R"rawliteral(
-    </div>
-  </div>
-
-  <div class="card prediction">
-    <div class="prediction-badge">🤖 AI PREDICTED</div>
-    <div class="label">Air Quality Index</div>
-    <div class="value">)rawliteral");
-    
-    client.printf("%.2f", predictedAQI);
-    
-    client.println(R"rawliteral(
-    </div>
-    <div class="interpretation">)rawliteral");
-    
-    client.print(interpretAirQuality(predictedAQI));
-    
-    client.println(R"rawliteral(
-    </div>
-  </div>)rawliteral");
-  } else {
-    client.println(R"rawliteral(
-  <div class="card prediction">
-    <div class="label">⏳ Predictions Loading...</div>
-    <div class="no-prediction">Waiting for first prediction cycle<br>(Model updates every 60 seconds)</div>
-  </div>)rawliteral");
-  }
-
-  client.println(R"rawliteral(
-</div>
-
-<div class="info-section">
-  <h2>Project Details</h2>
-  <p>This ESP32-based IoT dashboard monitors environmental data using DHT11 (Temperature & Humidity) and MQ-135 (Air Quality) sensors. Real-time data is displayed alongside AI-powered predictions for the next day, updated every minute.</p>
-  <h2>Hardware Components</h2>
-  <ul>
-    <li>ESP32 Dev Board</li>
-    <li>DHT11 Temperature & Humidity Sensor (GPIO 4)</li>
-    <li>MQ-135 Air Quality Sensor (Analog GPIO 34)</li>
-    <li>16x2 LCD with I²C interface (PCF8574T, SDA GPIO 21, SCL GPIO 22)</li>
-    <li>Breadboard + jumper wires</li>
-    <li>USB cable</li>
-  </ul>
-  <h2>Air Quality Interpretation (MQ-135)</h2>
-  <ul>
-    <li>&lt; 150 : Excellent</li>
-    <li>150–299 : Good</li>
-    <li>300–449 : Fair</li>
-    <li>450–599 : Poor</li>
-    <li>≥ 600 : Very Poor</li>
-  </ul>
-  <h2>Features</h2>
-  <ul>
-    <li>WiFi-enabled ESP32 web server (auto-refresh every 5 seconds)</li>
-    <li>AI-powered next day predictions (updated every 60 seconds)</li>
-    <li>Responsive & modern UI with dark/light mode</li>
-    <li>Optional 16x2 I²C LCD display</li>
-    <li>Real-time temperature, humidity, and air quality readings</li>
-  </ul>
-</div>
-
-<footer>Page refreshes every 5 seconds | Predictions update every 60 seconds | MIT License | Designed by ClimeScope</footer>
-
-<script>
-function toggleMode() {
-  const body = document.body;
-  const btn = document.querySelector('.toggle-btn');
-  
-  if (body.classList.contains('light')) {
-    body.classList.remove('light');
-    body.classList.add('dark');
-    btn.textContent = '☀ Toggle Dark/Light';
-  } else {
-    body.classList.remove('dark');
-    body.classList.add('light');
-    btn.textContent = '🌙 Toggle Dark/Light';
-  }
-}
-</script>
-</body>
-</html>
-)rawliteral");
-
-  delay(1);
-  client.stop();
-  Serial.println("Client disconnected");
-}
-
-// Function to send sensor data to API and get predictions
-void getPredictions() {
-  if (WiFi.status() != WL_CONNECTED) {
-    Serial.println("WiFi not connected. Skipping prediction request.");
-    return;
-  }
-
-  HTTPClient http;
-  http.begin(API_ENDPOINT);
-  http.addHeader("Content-Type", "application/json");
-
-  // Read current sensor values
-  float temperature = dht.readTemperature();
-  float humidity = dht.readHumidity();
-  int mq135Raw = analogRead(MQ135PIN);
-
-  if (isnan(temperature) || isnan(humidity)) {
-    Serial.println("Failed to read from DHT sensor! Skipping prediction request.");
-    http.end();
-    return;
-  }
-
-  // Prepare JSON payload
-  char jsonBuffer[128];
-  snprintf(jsonBuffer, sizeof(jsonBuffer),
-           "{\"temperature\": %.2f, \"humidity\": %.2f, \"aqi\": %d}",
-           temperature, humidity, mq135Raw);
-
-  // Send POST request
-  int httpResponseCode = http.POST(jsonBuffer);
-
-  if (httpResponseCode > 0) {
-    String response = http.getString();
-    Serial.println("\n--- Prediction Results ---");
-    Serial.println(response);
-    Serial.println("------------------------");
-    
-    // Simple string parsing for JSON response
-    // Expected format: {"next_day_predictions":{"aqi":104.18,"humidity":73.21,"temperature":31.71}}
-    
-    // First, find the "next_day_predictions" object
-    int predStart = response.indexOf("\"next_day_predictions\":");
-    if (predStart != -1) {
-      // Get the substring starting from predictions object
-      String predSection = response.substring(predStart);
-      
-      // Now find values within this section
-      int aqiIndex = predSection.indexOf("\"aqi\":");
-      int humidityIndex = predSection.indexOf("\"humidity\":");
-      int temperatureIndex = predSection.indexOf("\"temperature\":");
-      
-      if (aqiIndex != -1 && humidityIndex != -1 && temperatureIndex != -1) {
-        // Extract AQI value
-        int aqiStart = aqiIndex + 6;
-        int aqiEnd = predSection.indexOf(",", aqiStart);
-        if (aqiEnd == -1) aqiEnd = predSection.indexOf("}", aqiStart);
-        String aqiStr = predSection.substring(aqiStart, aqiEnd);
-        aqiStr.trim();
-        predictedAQI = aqiStr.toFloat();
-        
-        // Extract Humidity value
-        int humStart = humidityIndex + 11;
-        int humEnd = predSection.indexOf(",", humStart);
-        if (humEnd == -1) humEnd = predSection.indexOf("}", humStart);
-        String humStr = predSection.substring(humStart, humEnd);
-        humStr.trim();
-        predictedHumidity = humStr.toFloat();
-        
-        // Extract Temperature value
-        int tempStart = temperatureIndex + 14;
-        int tempEnd = predSection.indexOf("}", tempStart);
-        if (tempEnd == -1) tempEnd = predSection.indexOf(",", tempStart);
-        String tempStr = predSection.substring(tempStart, tempEnd);
-        tempStr.trim();
-        predictedTemperature = tempStr.toFloat();
-        
-        predictionAvailable = true;
-        
-        Serial.println("Predictions parsed successfully:");
-        Serial.printf("  Predicted Temperature: %.2f °C\n", predictedTemperature);
-        Serial.printf("  Predicted Humidity: %.2f %%\n", predictedHumidity);
-        Serial.printf("  Predicted AQI: %.2f\n", predictedAQI);
-        Serial.println("Raw extracted strings:");
-        Serial.printf("  AQI string: '%s'\n", aqiStr.c_str());
-        Serial.printf("  Humidity string: '%s'\n", humStr.c_str());
-        Serial.printf("  Temperature string: '%s'\n", tempStr.c_str());
-      } else {
-        Serial.println("Failed to find prediction fields in response");
-      }
-    } else {
-      Serial.println("Failed to find 'next_day_predictions' in response");
-    }
-  } else {
-    Serial.printf("Error on sending POST: %s\n", http.errorToString(httpResponseCode).c_str());
-  }
-
-  http.end();
-}
-
-void setup() {
-  Serial.begin(115200);
-
-  Serial.println("Initializing sensors...");
-  dht.begin();
-  delay(2000); // Allow sensors to stabilize
-
-  float initHumidity = dht.readHumidity();
-  float initTemp = dht.readTemperature();
-  if (!isnan(initHumidity) && !isnan(initTemp)) {
-    Serial.printf("Initial Temperature: %.1f °C\n", initTemp);
-    Serial.printf("Initial Humidity: %.1f %%\n", initHumidity);
-  } else {
-    Serial.println("Initial sensor read failed.");
-  }
-
-  connectToWiFi();
-  getPredictions();
-}
-
-void loop() {
-  static unsigned long lastPredictionTime = 0;
-  unsigned long currentMillis = millis();
-
-  // Handle web client requests
-  WiFiClient client = server.available();
-  if (client) {
-    handleClient(client);
-  }
-
-  // Get predictions every API_INTERVAL milliseconds
-  if (currentMillis - lastPredictionTime >= API_INTERVAL) {
-    getPredictions();
-    lastPredictionTime = currentMillis;
-  }
-}
\ No newline at end of file
+#include "Hal.h"
+#include "SensorInputs.h"
+#include "dashboard_html.h"
+#include "HttpServer.h"
+#include "SensorSampler.h"
+#include "SeqLock.h"
+#include "SpscRing.h"
+#include "PredictionUplink.h"
+#include "PredictionParser.h"
+#include "Telemetry.h"
+#include "SampleHistory.h"
+#include "DailyAggregates.h"
+#include "SampleLog.h"
+#include "EspPartitionFlash.h"
+#include "FileFlash.h"
+#include "SimulatedWeather.h"
+#include "NextDayModel.h"
+#include "Metrics.h"
+#include "Log.h"
+#include "Trace.h"
+#include "ResponseWriter.h"
+
+#define DHTPIN 4
+#define DHTTYPE DHT11
+#define MQ135PIN 34
+
+// The native build overrides these from platformio.ini
+#ifndef API_ENDPOINT_URL
+#define API_ENDPOINT_URL "http://10.38.192.228:5000/ingest"
+#endif
+#ifndef HTTP_PORT
+#define HTTP_PORT 80
+#endif
+
+// API endpoint configuration
+const char* API_ENDPOINT = API_ENDPOINT_URL;
+const unsigned long API_INTERVAL = 60000; // Flush buffered samples at least every 60 seconds
+const size_t BATCH_MAX_SAMPLES = 30;      // ...or as soon as this many are waiting
+const size_t REPLAY_BATCH_SAMPLES = 120;  // Samples per batch when draining the flash backlog
+const unsigned long REPLAY_INTERVAL = 2000; // ...sent at most this often
+const size_t SPILL_THRESHOLD = 128;       // Samples kept in RAM before older ones move to flash, a block at a time
+const uint32_t MAX_REPLAY_AGE = 40UL * 86400 * 1000; // Logged samples older than this (ms) are dropped; ages wrap at 49 days
+const unsigned long WIFI_RETRY_INTERVAL = 30000;
+const uint32_t FORECAST_DAY = 86400;        // Length of one lag window for the on-device forecast, s
+const size_t FORECAST_MIN_BUCKETS = 144;    // Five-minute buckets a window needs: half a day
+const uint32_t DAY_MIN_SAMPLES = 10800;     // Readings a calendar day needs for the forecast: half a day at 2 s
+const uint32_t DAILY_SAVE_INTERVAL = 3600;  // Seconds between saves of the daily aggregates to NVS
+const char* TIME_ZONE = "IST-5:30";         // POSIX TZ: calendar days follow local time
+const char* NTP_SERVER = "pool.ntp.org";
+const time_t CLOCK_VALID = 1600000000;      // wallClock() below this: NTP has not set it yet
+// connect, send, wait for the model, read the reply
+const UplinkConfig UPLINK_CONFIG = {3000, 2000, 10000, 5000};
+
+#if defined(ARDUINO_ARCH_ESP32)
+DhtClimateSensor climate(DHTPIN, DHTTYPE);
+PinAnalogInput mq135(MQ135PIN);
+SensorSampler sampler(climate, mq135);
+#else
+SimulatedWeather weather(TIME_ZONE);
+SensorSampler sampler(weather, weather);
+#endif
+
+const char* ssid = "vivo Y02t";
+const char* password = "sakethwaste";
+
+NetServer server(HTTP_PORT);
+
+bool handleRequest(NetClient &client, const HttpRequest &request);
+HttpServer httpServer(server, handleRequest);
+
+// Latest next-day prediction. Written only by the uplink task, read by the
+// HTTP task through the seqlock so the three values always belong together.
+struct Prediction {
+  float temperature;
+  float humidity;
+  float aqi;
+  bool available;
+};
+
+SeqLock<Prediction> latestPrediction;
+// Next-day prediction computed on the device from the local history; the
+// sampler task writes it, the HTTP task reads it.
+SeqLock<Prediction> localPrediction;
+PredictionUplink uplink;
+PredictionParser predictionParser;
+
+// Recent readings at several resolutions for /history. Written by the
+// sampler task, read by the HTTP task; both hold historyLock.
+SampleHistory history;
+SemaphoreHandle_t historyLock;
+
+// Per-calendar-day aggregates for the forecaster's lag vector, kept in NVS
+// so a reboot loses at most DAILY_SAVE_INTERVAL of the current day. Days
+// only count once NTP has set the clock. Guarded by historyLock too.
+DailyAggregates daily;
+Preferences dailyStore;
+
+// Every valid reading waits here until a batch containing it is accepted by
+// the server. Filled by the sampler task, drained by the uplink task.
+SpscRing<SensorReading, 256> pendingSamples;
+
+// Samples that pile up while the server is unreachable move on to a log in
+// the "samplelog" flash partition, and are sent before the RAM queue once it
+// is reachable again. The log survives a restart; an earlier boot's samples
+// are sent once NTP lets this boot date them. Only the uplink task touches
+// the log.
+#if defined(ARDUINO_ARCH_ESP32)
+EspPartitionFlash logFlash;
+#else
+FileFlash logFlash(0x160000);  // the size of "samplelog" in partitions.csv
+#endif
+SampleLog offlineLog(logFlash);
+bool offlineLogReady = false;
+bool bootEpochLogged = false;
+bool replayAwaitsClock = false;  // the backlog starts with an earlier boot's samples
+LogRecord replayRecords[REPLAY_BATCH_SAMPLES];
+
+// The batch being sent; must outlive the exchange, so it is not on the stack
+uint8_t batchBuffer[TELEMETRY_HEADER_SIZE + REPLAY_BATCH_SAMPLES * TELEMETRY_MAX_RECORD_SIZE];
+size_t batchSamples = 0;
+bool batchFromLog = false;
+// Sequence number of the oldest sample in pendingSamples; counts samples
+// that left RAM, either accepted by the server or moved to the flash log,
+// and carries on from the log's after a restart
+uint32_t batchSeq = 0;
+bool lastBatchAccepted = true;
+
+// Counters and timings for /metrics. Each histogram has a single recording
+// task: the sampler records sensor reads and its own iterations, the
+// uplink task round trips and its iterations, the HTTP task its iterations
+// (request timings are kept by HttpServer itself).
+DurationHistogram sensorReadTime;
+Counter sensorReadFailures;
+DurationHistogram uplinkRoundTrip;
+Counter uplinkResponses[4];  // by status class: 2xx, 4xx, 5xx, anything else
+Counter uplinkFailures;
+Counter predictionParseFailures;
+Counter wifiReconnects;
+DurationHistogram samplerIteration;
+DurationHistogram httpIteration;
+DurationHistogram uplinkIteration;
+unsigned long uplinkStartedAt = 0;
+
+// Task layout: the WiFi stack lives on core 0, so the uplink runs next to
+// it; sampling and dashboard serving share core 1.
+const uint32_t SAMPLER_STACK = 4096;
+const uint32_t HTTP_STACK = 6144;
+const uint32_t UPLINK_STACK = 8192;
+const uint32_t LOG_STACK = 3072;
+const UBaseType_t SAMPLER_PRIORITY = 2;
+const UBaseType_t HTTP_PRIORITY = 3;
+const UBaseType_t UPLINK_PRIORITY = 1;
+const UBaseType_t LOG_PRIORITY = 0;  // shares the idle priority: only spare time goes to the UART
+
+void connectToWiFi() {
+  LOG_INFO("Connecting to WiFi SSID: %s", ssid);
+  WiFi.setAutoReconnect(true);
+  WiFi.begin(ssid, password);
+  TRACE_BEGIN("wifi connect");
+
+  int retryCount = 0;
+  while (WiFi.status() != WL_CONNECTED && retryCount < 20) {
+    delay(1000);
+    retryCount++;
+  }
+  TRACE_END("wifi connect");
+
+  if (WiFi.status() == WL_CONNECTED) {
+    LOG_INFO("WiFi connected, IP address %s", WiFi.localIP().toString().c_str());
+  } else {
+    LOG_WARN("Failed to connect to WiFi; retrying in the background");
+  }
+  // Listens on all interfaces, so it also serves once a later reconnect succeeds
+  httpServer.begin();
+}
+
+// Local calendar day, once NTP has set the clock
+bool localDay(uint32_t &day) {
+  time_t now = wallClock();
+  if (now < CLOCK_VALID) return false;
+  struct tm local;
+  localtime_r(&now, &local);
+  day = DailyAggregates::dayNumber(local.tm_year + 1900, local.tm_mon + 1, local.tm_mday);
+  return true;
+}
+
+void saveDaily() {
+  static uint8_t state[DailyAggregates::STATE_SIZE];
+  xSemaphoreTake(historyLock, portMAX_DELAY);
+  size_t length = daily.save(state);
+  xSemaphoreGive(historyLock);
+  if (dailyStore.putBytes("days", state, length) != length) LOG_ERROR("Saving daily aggregates failed");
+}
+
+void loadDaily() {
+  static uint8_t state[DailyAggregates::STATE_SIZE];
+  if (!dailyStore.begin("daily", false)) {
+    LOG_WARN("NVS unavailable; daily aggregates start empty after each boot");
+    return;
+  }
+  size_t length = dailyStore.getBytes("days", state, sizeof(state));
+  if (length > 0 && daily.restore(state, length)) {
+    LOG_INFO("Restored %u days of daily aggregates", (unsigned)daily.size());
+  }
+}
+
+// Every response is assembled here and sent in whole segments (see
+// ResponseWriter.h); only the HTTP task uses it
+char responseBuffer[ResponseWriter::BUFFER_SIZE];
+
+const char* interpretAirQuality(float raw) {
+  if (raw < 150) return "Excellent";
+  else if (raw < 300) return "Good";
+  else if (raw < 450) return "Fair";
+  else if (raw < 600) return "Poor";
+  else return "Very Poor";
+}
+
+// The dashboard shell is static, so it is gzipped into flash at build time
+// (see scripts/embed_web.py) and cached by the browser. Only /api/now changes.
+// Clients that do not accept gzip get the plain copy, under its own ETag.
+bool sendDashboard(NetClient &client, const HttpRequest &request) {
+  const char *etag = request.acceptsGzip ? DASHBOARD_ETAG : DASHBOARD_RAW_ETAG;
+  ResponseWriter out(client, responseBuffer, sizeof(responseBuffer));
+  if (strstr(request.ifNoneMatch, etag) != NULL) {
+    out.appendf("HTTP/1.1 304 Not Modified\r\n"
+                "ETag: %s\r\n", etag);
+    out.literal("Vary: Accept-Encoding\r\n"
+                "Cache-Control: public, max-age=86400\r\n");
+    out.connection(request);
+    out.literal("\r\n");
+    return out.finish();
+  }
+
+  out.literal("HTTP/1.1 200 OK\r\n"
+              "Content-Type: text/html; charset=UTF-8\r\n"
+              "Vary: Accept-Encoding\r\n"
+              "Cache-Control: public, max-age=86400\r\n");
+  out.connection(request);
+  if (request.acceptsGzip) {
+    out.literal("Content-Encoding: gzip\r\n");
+    out.appendf("ETag: %s\r\n"
+                "Content-Length: %u\r\n\r\n", etag, (unsigned)DASHBOARD_HTML_GZ_LEN);
+    out.append(DASHBOARD_HTML_GZ, DASHBOARD_HTML_GZ_LEN);
+  } else {
+    out.appendf("ETag: %s\r\n"
+                "Content-Length: %u\r\n\r\n", etag, (unsigned)DASHBOARD_HTML_LEN);
+    out.append(DASHBOARD_HTML, DASHBOARD_HTML_LEN);
+  }
+  return out.finish();
+}
+
+bool sendLiveData(NetClient &client, const HttpRequest &request) {
+  TRACE_BEGIN("http render");
+  SensorReading reading = sampler.latest();
+  float humidity = reading.dhtValid ? reading.humidity : 0;
+  float temperature = reading.dhtValid ? reading.temperature : 0;
+
+  // The on-device forecast works offline too, so it wins once it has enough history
+  Prediction predicted = localPrediction.load();
+  const char *source = "device";
+  if (!predicted.available) {
+    predicted = latestPrediction.load();
+    source = "server";
+  }
+  char prediction[112] = "null";
+  if (predicted.available) {
+    snprintf(prediction, sizeof(prediction),
+             "{\"t\":%.2f,\"h\":%.2f,\"aqi\":%.2f,\"aq\":\"%s\",\"src\":\"%s\"}",
+             predicted.temperature, predicted.humidity, predicted.aqi,
+             interpretAirQuality(predicted.aqi), source);
+  }
+
+  char body[208];
+  int length = snprintf(body, sizeof(body),
+                        "{\"t\":%.1f,\"h\":%.1f,\"mq\":%d,\"mqv\":%.2f,\"aq\":\"%s\",\"age\":%lu,\"p\":%s}",
+                        temperature, humidity, reading.mq135Raw, mq135Voltage(reading.mq135Raw),
+                        interpretAirQuality(reading.mq135Raw), millis() - reading.takenAt, prediction);
+
+  ResponseWriter out(client, responseBuffer, sizeof(responseBuffer));
+  out.literal("HTTP/1.1 200 OK\r\n"
+              "Content-Type: application/json\r\n"
+              "Cache-Control: no-store\r\n");
+  out.connection(request);
+  out.appendf("Content-Length: %d\r\n\r\n", length);
+  out.append(body, length);
+  TRACE_END("http render");
+  return out.finish();
+}
+
+// Reads a time parameter for /history: seconds since boot, or relative to
+// `now` when zero or negative
+bool historyTimeParam(const HttpRequest &request, const char *name, uint32_t now, uint32_t &out) {
+  char value[16];
+  if (!httpQueryParam(request.path, name, value, sizeof(value))) return false;
+  long seconds = strtol(value, NULL, 10);
+  if (seconds > 0) {
+    out = seconds;
+  } else {
+    out = (uint32_t)-seconds > now ? 0 : now + seconds;
+  }
+  return true;
+}
+
+// Appends a 0.01-unit fixed-point value as a JSON number, or null
+int formatCenti(char *out, size_t size, int32_t value, bool known) {
+  if (!known) return snprintf(out, size, "null");
+  const char *sign = value < 0 ? "-" : "";
+  if (value < 0) value = -value;
+  return snprintf(out, size, "%s%ld.%02ld", sign, (long)(value / 100), (long)(value % 100));
+}
+
+int formatSample(char *out, size_t size, const PackedSample &sample) {
+  bool dht = sample.temperatureCenti != TELEMETRY_MISSING;
+  int length = formatCenti(out, size, sample.temperatureCenti, dht);
+  length += snprintf(out + length, size - length, ",");
+  length += formatCenti(out + length, size - length, sample.humidityCenti, dht);
+  return length;
+}
+
+// GET /history?res=<seconds>&from=<seconds>&to=<seconds>[&format=bin]
+//
+// res picks the tier (2, 60 or 300 s; default 60). from/to are seconds since
+// boot and default to everything stored. JSON, the default, lists only
+// buckets that hold data: [time,t,h,mq] for the raw tier and
+// [time,t,tmin,tmax,h,hmin,hmax,mq,mqmin,mqmax] for the others. format=bin
+// returns every bucket in the range, empty ones included, after a 14-byte
+// header: "CH", version 1, tier, u16 resolution, u32 first time, u32 count.
+// Raw points are i16 temperature, u16 humidity, u16 MQ-135 (6 bytes);
+// aggregated points are mean, min and max of those (18 bytes). Empty
+// buckets have MQ-135 0xffff.
+bool sendHistory(NetClient &client, const HttpRequest &request) {
+  static const size_t CHUNK = 16;
+  static HistoryPoint points[CHUNK];
+
+  char value[8];
+  uint32_t res = 60;
+  if (httpQueryParam(request.path, "res", value, sizeof(value))) res = strtoul(value, NULL, 10);
+  SampleHistory::Tier tier = SampleHistory::tierFor(res);
+  uint32_t step = SampleHistory::resolution(tier);
+  bool binary = httpQueryParam(request.path, "format", value, sizeof(value)) && strcmp(value, "bin") == 0;
+
+  uint32_t now = millis() / 1000;
+  uint32_t first = 0, last = 0;
+  xSemaphoreTake(historyLock, portMAX_DELAY);
+  bool stored = history.span(tier, first, last);
+  xSemaphoreGive(historyLock);
+
+  uint32_t from = first, to = last;
+  historyTimeParam(request, "from", now, from);
+  historyTimeParam(request, "to", now, to);
+  if (from < first) from = first;
+  if (to > last) to = last;
+  uint32_t count = (stored && from <= to) ? to / step - from / step + 1 : 0;
+  from = from / step * step;
+
+  size_t pointSize = tier == SampleHistory::RAW ? 6 : 18;
+  ResponseWriter out(client, responseBuffer, sizeof(responseBuffer));
+  out.literal("HTTP/1.1 200 OK\r\n"
+              "Cache-Control: no-store\r\n");
+  if (binary) {
+    out.literal("Content-Type: application/octet-stream\r\n");
+    out.connection(request);
+    out.appendf("Content-Length: %u\r\n\r\n", (unsigned)(14 + count * pointSize));
+    uint8_t header[14] = {'C', 'H', 1, (uint8_t)tier, (uint8_t)(step & 0xff), (uint8_t)(step >> 8)};
+    for (int i = 0; i < 4; i++) {
+      header[6 + i] = (from >> (8 * i)) & 0xff;
+      header[10 + i] = (count >> (8 * i)) & 0xff;
+    }
+    out.append(header, sizeof(header));
+  } else {
+    out.literal("Content-Type: application/json\r\n"
+                "Connection: close\r\n"
+                "\r\n");
+    out.appendf("{\"res\":%u,\"now\":%u,\"points\":[", step, now);
+  }
+
+  // Copy a few points at a time so the sampler is never held up for long
+  bool firstPoint = true;
+  uint32_t done = 0;
+  while (done < count) {
+    size_t want = count - done < CHUNK ? count - done : CHUNK;
+    xSemaphoreTake(historyLock, portMAX_DELAY);
+    size_t got = history.read(tier, from + done * step, to, points, want);
+    xSemaphoreGive(historyLock);
+    if (got == 0) break;
+    done += got;
+
+    TRACE_BEGIN("http render");
+    for (size_t i = 0; i < got; i++) {
+      const HistoryPoint &point = points[i];
+      // One point at most MAX_FIELD bytes, formatted in place
+      char *buffer = out.reserve();
+      const size_t size = ResponseWriter::MAX_FIELD;
+      size_t length = 0;
+      if (binary) {
+        const PackedSample *parts[3] = {&point.mean, &point.min, &point.max};
+        for (size_t p = 0; p < pointSize / 6; p++) {
+          const uint16_t fields[3] = {(uint16_t)parts[p]->temperatureCenti, parts[p]->humidityCenti,
+                                      parts[p]->mq135Raw};
+          for (int f = 0; f < 3; f++) {
+            buffer[length++] = fields[f] & 0xff;
+            buffer[length++] = fields[f] >> 8;
+          }
+        }
+        out.commit(length);
+        continue;
+      }
+
+      if (point.mean.mq135Raw == HISTORY_EMPTY) continue;
+      length += snprintf(buffer + length, size - length, "%s[%u,", firstPoint ? "" : ",", point.time);
+      firstPoint = false;
+      if (tier == SampleHistory::RAW) {
+        length += formatSample(buffer + length, size - length, point.mean);
+        length += snprintf(buffer + length, size - length, ",%u]", point.mean.mq135Raw);
+      } else {
+        // t,tmin,tmax,h,hmin,hmax: regroup the per-sample fields by quantity
+        bool dht = point.mean.temperatureCenti != TELEMETRY_MISSING;
+        const PackedSample *parts[3] = {&point.mean, &point.min, &point.max};
+        for (int p = 0; p < 3; p++) {
+          length += formatCenti(buffer + length, size - length, parts[p]->temperatureCenti, dht);
+          buffer[length++] = ',';
+        }
+        for (int p = 0; p < 3; p++) {
+          length += formatCenti(buffer + length, size - length, parts[p]->humidityCenti, dht);
+          buffer[length++] = ',';
+        }
+        length += snprintf(buffer + length, size - length, "%u,%u,%u]", point.mean.mq135Raw,
+                           point.min.mq135Raw, point.max.mq135Raw);
+      }
+      out.commit(length);
+    }
+    TRACE_END("http render");
+  }
+
+  if (binary) {
+    // Buckets can age out of the tier while the response is sent; pad with
+    // empty ones so the body still matches its Content-Length
+    static const uint8_t EMPTY[6] = {(uint8_t)TELEMETRY_MISSING, (uint8_t)((uint16_t)TELEMETRY_MISSING >> 8),
+                                     0xff, 0xff, 0xff, 0xff};
+    for (; done < count; done++) {
+      for (size_t p = 0; p < pointSize / 6; p++) out.append(EMPTY, sizeof(EMPTY));
+    }
+  } else {
+    out.literal("]}");
+  }
+  return out.finish();
+}
+
+// GET /daily: the stored calendar-day aggregates, oldest first, as
+// [day,samples,t,tmin,tmax,h,hmin,hmax,mq,mqmin,mqmax] with day counted
+// from 1970-01-01 in local time, plus the forecaster's lag vector
+// ([t,h,mq] of the previous three days, yesterday first) once it is
+// complete. today is null until NTP has set the clock.
+bool sendDaily(NetClient &client, const HttpRequest &request) {
+  static char buffer[DailyAggregates::DAYS * 112 + 192];
+  TRACE_BEGIN("http render");
+  uint32_t today = 0;
+  bool dated = localDay(today);
+
+  xSemaphoreTake(historyLock, portMAX_DELAY);
+  size_t length = dated ? snprintf(buffer, sizeof(buffer), "{\"today\":%u,\"days\":[", today)
+                        : snprintf(buffer, sizeof(buffer), "{\"today\":null,\"days\":[");
+  for (size_t i = 0; i < daily.size(); i++) {
+    const DayAggregate &day = daily.at(i);
+    float t = 0, h = 0, mq = 0;
+    bool dht = DailyAggregates::mean(day, t, h, mq);
+    length += snprintf(buffer + length, sizeof(buffer) - length, "%s[%u,%u,", i ? "," : "", day.day, day.count);
+    if (dht) {
+      length += snprintf(buffer + length, sizeof(buffer) - length, "%.2f,", t);
+    } else {
+      length += snprintf(buffer + length, sizeof(buffer) - length, "null,");
+    }
+    length += formatCenti(buffer + length, sizeof(buffer) - length, day.min.temperatureCenti, dht);
+    buffer[length++] = ',';
+    length += formatCenti(buffer + length, sizeof(buffer) - length, day.max.temperatureCenti, dht);
+    if (dht) {
+      length += snprintf(buffer + length, sizeof(buffer) - length, ",%.2f,", h);
+    } else {
+      length += snprintf(buffer + length, sizeof(buffer) - length, ",null,");
+    }
+    length += formatCenti(buffer + length, sizeof(buffer) - length, day.min.humidityCenti, dht);
+    buffer[length++] = ',';
+    length += formatCenti(buffer + length, sizeof(buffer) - length, day.max.humidityCenti, dht);
+    length += snprintf(buffer + length, sizeof(buffer) - length, ",%.2f,%u,%u]", (double)day.mq135Sum / day.count,
+                       day.min.mq135Raw, day.max.mq135Raw);
+  }
+  float lags[NEXT_DAY_FEATURES];
+  bool complete = dated && daily.lagVector(today, NEXT_DAY_LAGS, DAY_MIN_SAMPLES, lags);
+  xSemaphoreGive(historyLock);
+
+  length += snprintf(buffer + length, sizeof(buffer) - length, "],\"lags\":");
+  if (complete) {
+    for (uint8_t i = 0; i < NEXT_DAY_FEATURES; i++) {
+      length += snprintf(buffer + length, sizeof(buffer) - length, "%c%.2f", i ? ',' : '[', lags[i]);
+    }
+    length += snprintf(buffer + length, sizeof(buffer) - length, "]}");
+  } else {
+    length += snprintf(buffer + length, sizeof(buffer) - length, "null}");
+  }
+
+  ResponseWriter out(client, responseBuffer, sizeof(responseBuffer));
+  out.literal("HTTP/1.1 200 OK\r\n"
+              "Content-Type: application/json\r\n"
+              "Cache-Control: no-store\r\n");
+  out.connection(request);
+  out.appendf("Content-Length: %u\r\n\r\n", (unsigned)length);
+  out.append(buffer, length);
+  TRACE_END("http render");
+  return out.finish();
+}
+
+// GET /metrics: counters, gauges and timing histograms in the Prometheus
+// text format, formatted a line at a time into the response. Request timings cover
+// parsing the head and handling it (rendering and sending the response);
+// task iterations exclude the delay between them.
+bool sendMetrics(NetClient &client) {
+  static char buffer[768];
+  static const char *STATUS_LABELS[4] = {"code=\"2xx\"", "code=\"4xx\"", "code=\"5xx\"", "code=\"other\""};
+  HttpServer::Stats &http = httpServer.stats();
+  TRACE_SCOPE("http render");
+
+  ResponseWriter response(client, responseBuffer, sizeof(responseBuffer));
+  response.literal("HTTP/1.1 200 OK\r\n"
+                   "Content-Type: text/plain; version=0.0.4\r\n"
+                   "Cache-Control: no-store\r\n"
+                   "Connection: close\r\n"
+                   "\r\n");
+
+  MetricsWriter out(buffer, sizeof(buffer), ResponseWriter::sink, &response);
+  out.family("weather_uptime_seconds", "gauge", "Time since boot.");
+  out.value("weather_uptime_seconds", NULL, (uint32_t)(millis() / 1000));
+  out.family("weather_free_heap_bytes", "gauge", "Heap currently free.");
+  out.value("weather_free_heap_bytes", NULL, freeHeap());
+
+  out.family("weather_sensor_read_seconds", "histogram", "Time to read the DHT11 and MQ-135 once.");
+  out.histogram("weather_sensor_read_seconds", NULL, sensorReadTime);
+  out.family("weather_sensor_read_failures_total", "counter", "DHT reads that returned NaN.");
+  out.value("weather_sensor_read_failures_total", NULL, sensorReadFailures.value());
+
+  out.family("weather_http_requests_total", "counter", "Requests parsed and handled.");
+  out.value("weather_http_requests_total", NULL, http.requests.value());
+  out.family("weather_http_rejected_total", "counter", "Requests answered with an error before handling.");
+  out.value("weather_http_rejected_total", "reason=\"malformed\"", http.malformed.value());
+  out.value("weather_http_rejected_total", "reason=\"timeout\"", http.timedOut.value());
+  out.family("weather_http_request_seconds", "histogram", "Time from accepting a connection to the end of its response.");
+  out.histogram("weather_http_request_seconds", NULL, http.request);
+  out.family("weather_http_request_parse_seconds", "histogram", "Time spent parsing a request head.");
+  out.histogram("weather_http_request_parse_seconds", NULL, http.parse);
+  out.family("weather_http_request_handle_seconds", "histogram", "Time to render and send a response.");
+  out.histogram("weather_http_request_handle_seconds", NULL, http.handle);
+  out.family("weather_http_active_connections", "gauge", "Open connections, idle kept-alive ones included.");
+  out.value("weather_http_active_connections", NULL, (uint32_t)httpServer.activeConnections());
+
+  out.family("weather_uplink_round_trip_seconds", "histogram", "Batch POST from start to the end of the reply.");
+  out.histogram("weather_uplink_round_trip_seconds", NULL, uplinkRoundTrip);
+  out.family("weather_uplink_responses_total", "counter", "Replies to batch POSTs by HTTP status class.");
+  for (int i = 0; i < 4; i++) out.value("weather_uplink_responses_total", STATUS_LABELS[i], uplinkResponses[i].value());
+  out.family("weather_uplink_failures_total", "counter", "Batch POSTs that failed to connect, send or get a reply.");
+  out.value("weather_uplink_failures_total", NULL, uplinkFailures.value());
+  out.family("weather_prediction_parse_failures_total", "counter", "Replies without a usable prediction.");
+  out.value("weather_prediction_parse_failures_total", NULL, predictionParseFailures.value());
+  out.family("weather_samples_pending", "gauge", "Samples waiting for upload, in RAM and in the flash log.");
+  out.value("weather_samples_pending", "store=\"ram\"", (uint32_t)pendingSamples.size());
+  out.value("weather_samples_pending", "store=\"flash\"", (uint32_t)offlineLog.size());
+
+  out.family("weather_wifi_reconnects_total", "counter", "Reconnection attempts after losing WiFi.");
+  out.value("weather_wifi_reconnects_total", NULL, wifiReconnects.value());
+  out.family("weather_wifi_connected", "gauge", "1 while associated with the access point.");
+  out.value("weather_wifi_connected", NULL, (uint32_t)(WiFi.status() == WL_CONNECTED));
+
+  out.family("weather_task_iteration_seconds", "histogram", "Work done per task loop iteration.");
+  out.histogram("weather_task_iteration_seconds", "task=\"sampler\"", samplerIteration);
+  out.histogram("weather_task_iteration_seconds", "task=\"http\"", httpIteration);
+  out.histogram("weather_task_iteration_seconds", "task=\"uplink\"", uplinkIteration);
+  out.finish();
+  return response.finish();
+}
+
+unsigned long latencyWindowStartedAt = 0;
+
+size_t formatLatency(char *buffer, size_t size, const char *name, DurationHistogram &histogram, bool restart) {
+  DurationHistogram::Summary s = histogram.summarize(restart);
+  return snprintf(buffer, size, "\"%s\":{\"count\":%u,\"mean\":%u,\"p50\":%u,\"p90\":%u,\"p99\":%u,\"p999\":%u,\"max\":%u}",
+                  name, (unsigned)s.count, (unsigned)(s.count ? s.sumMicros / s.count : 0), (unsigned)s.p50,
+                  (unsigned)s.p90, (unsigned)s.p99, (unsigned)s.p999, (unsigned)s.max);
+}
+
+// GET /latency[?reset=1]: percentiles in microseconds of each timing since
+// the window began, i.e. since boot or the last reset=1, which reports the
+// window it closes. Percentiles are bucket bounds, at most 1/8 above the
+// true value. Only the HTTP task may serve this, as summarize() requires.
+bool sendLatency(NetClient &client, const HttpRequest &request) {
+  static char buffer[1024];
+  char value[4];
+  TRACE_BEGIN("http render");
+  bool restart = httpQueryParam(request.path, "reset", value, sizeof(value)) && strcmp(value, "1") == 0;
+  HttpServer::Stats &http = httpServer.stats();
+  unsigned long now = millis();
+
+  size_t length = snprintf(buffer, sizeof(buffer), "{\"window_s\":%lu,\"unit\":\"us\",\"latency\":{",
+                           (now - latencyWindowStartedAt) / 1000);
+  length += formatLatency(buffer + length, sizeof(buffer) - length, "http_request", http.request, restart);
+  buffer[length++] = ',';
+  length += formatLatency(buffer + length, sizeof(buffer) - length, "http_handle", http.handle, restart);
+  buffer[length++] = ',';
+  length += formatLatency(buffer + length, sizeof(buffer) - length, "uplink_round_trip", uplinkRoundTrip, restart);
+  buffer[length++] = ',';
+  length += formatLatency(buffer + length, sizeof(buffer) - length, "sensor_read", sensorReadTime, restart);
+  buffer[length++] = ',';
+  length += formatLatency(buffer + length, sizeof(buffer) - length, "sampler_iteration", samplerIteration, restart);
+  buffer[length++] = ',';
+  length += formatLatency(buffer + length, sizeof(buffer) - length, "http_iteration", httpIteration, restart);
+  buffer[length++] = ',';
+  length += formatLatency(buffer + length, sizeof(buffer) - length, "uplink_iteration", uplinkIteration, restart);
+  length += snprintf(buffer + length, sizeof(buffer) - length, "}}");
+  if (restart) latencyWindowStartedAt = now;
+
+  ResponseWriter out(client, responseBuffer, sizeof(responseBuffer));
+  out.literal("HTTP/1.1 200 OK\r\n"
+              "Content-Type: application/json\r\n"
+              "Cache-Control: no-store\r\n");
+  out.connection(request);
+  out.appendf("Content-Length: %u\r\n\r\n", (unsigned)length);
+  out.append(buffer, length);
+  TRACE_END("http render");
+  return out.finish();
+}
+
+// GET /trace: the trace ring (Trace.h) as Chrome trace_event JSON, to open
+// in ui.perfetto.dev. Recording pauses while it is sent.
+bool sendTrace(NetClient &client) {
+  static char buffer[1024];
+  ResponseWriter out(client, responseBuffer, sizeof(responseBuffer));
+  out.literal("HTTP/1.1 200 OK\r\n"
+              "Content-Type: application/json\r\n"
+              "Content-Disposition: attachment; filename=\"weather-trace.json\"\r\n"
+              "Cache-Control: no-store\r\n"
+              "Connection: close\r\n"
+              "\r\n");
+  traceDump(buffer, sizeof(buffer), ResponseWriter::sink, &out);
+  return out.finish();
+}
+
+// Called by HttpServer once the request headers have fully arrived; true
+// keeps the connection open for another request
+bool handleRequest(NetClient &client, const HttpRequest &request) {
+  const char *path = request.path;
+
+  if (strcmp(path, "/") == 0 || strcmp(path, "/index.html") == 0) {
+    return sendDashboard(client, request);
+  } else if (strcmp(path, "/api/now") == 0) {
+    return sendLiveData(client, request);
+  } else if (httpPathIs(path, "/history")) {
+    return sendHistory(client, request);
+  } else if (strcmp(path, "/daily") == 0) {
+    return sendDaily(client, request);
+  } else if (strcmp(path, "/metrics") == 0) {
+    return sendMetrics(client);
+  } else if (httpPathIs(path, "/latency")) {
+    return sendLatency(client, request);
+  } else if (strcmp(path, "/trace") == 0) {
+    return sendTrace(client);
+  }
+
+  ResponseWriter out(client, responseBuffer, sizeof(responseBuffer));
+  out.literal("HTTP/1.1 404 Not Found\r\n"
+              "Content-Length: 0\r\n");
+  out.connection(request);
+  out.literal("\r\n");
+  return out.finish();
+}
+
+// Device time of a logged sample on this boot's millis() clock. An earlier
+// boot's sample is dated by that boot's clock marker; false when it has none,
+// or is too old for the telemetry format's 32-bit ages.
+bool replayTime(const LogRecord &logged, uint32_t now, time_t wall, uint32_t &time) {
+  if (!logged.earlierBoot) {
+    time = logged.takenAt;
+    return true;
+  }
+  if (wall < CLOCK_VALID || logged.bootEpoch == 0) return false;
+  int64_t age = ((int64_t)wall - logged.bootEpoch) * 1000 - logged.takenAt;
+  if (age < 0) age = 0;
+  if (age > MAX_REPLAY_AGE) return false;
+  time = now - (uint32_t)age;
+  return true;
+}
+
+// Encodes the flash backlog's oldest samples. A batch must have consecutive
+// sequence numbers, so it ends early at a gap left by a corrupt block, and
+// only samples this boot can date. Returns 0 when the backlog is waiting for
+// NTP, and drops samples that can never be dated.
+size_t encodeLogBatch() {
+  size_t count = offlineLog.peek(replayRecords, REPLAY_BATCH_SAMPLES);
+  if (count == 0) {
+    offlineLog.consume(0, offlineLog.acked());
+    return 0;
+  }
+
+  uint32_t now = millis();
+  time_t wall = wallClock();
+  uint32_t firstSeq = replayRecords[0].seq;
+  uint32_t time;
+  size_t usable = 0;
+  while (usable < count && replayRecords[usable].seq == firstSeq + usable &&
+         replayTime(replayRecords[usable], now, wall, time)) {
+    usable++;
+  }
+
+  if (usable == 0 && wall < CLOCK_VALID) {
+    replayAwaitsClock = true;
+    return 0;
+  }
+  if (usable == 0) {
+    size_t undated = 1;
+    while (undated < count && replayRecords[undated].seq == firstSeq + undated &&
+           !replayTime(replayRecords[undated], now, wall, time)) {
+      undated++;
+    }
+    offlineLog.consume(undated, firstSeq + undated);
+    LOG_WARN("Dropped %u logged samples that cannot be dated", (unsigned)undated);
+    return 0;
+  }
+  count = usable;
+
+  TelemetryEncoder encoder(batchBuffer, sizeof(batchBuffer), firstSeq, now, true);
+  for (size_t i = 0; i < count; i++) {
+    LogRecord &logged = replayRecords[i];
+    replayTime(logged, now, wall, logged.takenAt);
+    TelemetryRecord record = {logged.seq, logged.takenAt, logged.temperatureCenti, logged.humidityCenti,
+                              logged.mq135Raw};
+    encoder.add(record);
+  }
+
+  batchSamples = count;
+  batchFromLog = true;
+  return encoder.finish();
+}
+
+size_t encodeRamBatch() {
+  size_t count = pendingSamples.size();
+  if (count > BATCH_MAX_SAMPLES) count = BATCH_MAX_SAMPLES;
+  if (count == 0) return 0;
+
+  TelemetryEncoder encoder(batchBuffer, sizeof(batchBuffer), batchSeq, millis(), true);
+  for (size_t i = 0; i < count; i++) {
+    const SensorReading &sample = pendingSamples.peek(i);
+    if (!encoder.add(telemetryRecord(sample.takenAt, sample.temperature, sample.humidity,
+                                     sample.mq135Raw))) {
+      break;
+    }
+  }
+
+  batchSamples = encoder.count();
+  batchFromLog = false;
+  return encoder.finish();
+}
+
+// Queues a POST of the oldest unsent samples; uplinkTask drives it to
+// completion. The flash log only ever holds samples older than the RAM
+// queue, so it is drained first. The payload is a compressed telemetry message
+// (see Telemetry.h); the server turns each sample time into a timestamp
+// relative to the time the message was encoded.
+void sendBatch() {
+  if (WiFi.status() != WL_CONNECTED) {
+    LOG_DEBUG("WiFi not connected; keeping samples buffered");
+    lastBatchAccepted = false;
+    return;
+  }
+
+  // Samples the log cannot send yet leave the RAM queue to go on its own
+  size_t length = offlineLog.size() > 0 ? encodeLogBatch() : 0;
+  if (length == 0) length = encodeRamBatch();
+  if (length == 0) return;
+
+  predictionParser.reset();
+  uplink.start((const char *)batchBuffer, length, predictionParser, "application/octet-stream");
+  uplinkStartedAt = micros();
+}
+
+// Moves the oldest samples beyond SPILL_THRESHOLD from RAM to the flash log,
+// in compressed blocks of SampleLog::MAX_BLOCK. Never runs while a batch is
+// in flight, since that batch may be built from exactly those samples.
+void spillToFlash() {
+  static LogRecord block[SampleLog::MAX_BLOCK];
+  while (pendingSamples.size() >= SPILL_THRESHOLD + SampleLog::MAX_BLOCK) {
+    for (size_t i = 0; i < SampleLog::MAX_BLOCK; i++) {
+      const SensorReading &sample = pendingSamples.peek(i);
+      TelemetryRecord packed = telemetryRecord(sample.takenAt, sample.temperature, sample.humidity,
+                                               sample.mq135Raw);
+      LogRecord record = {batchSeq + (uint32_t)i, packed.time, packed.temperatureCenti, packed.humidityCenti,
+                          packed.mq135Raw, false, 0};
+      block[i] = record;
+    }
+    if (!offlineLog.append(block, SampleLog::MAX_BLOCK)) {
+      LOG_ERROR("Offline log write failed; keeping samples in RAM");
+      offlineLogReady = false;
+      return;
+    }
+    pendingSamples.pop(SampleLog::MAX_BLOCK);
+    batchSeq += SampleLog::MAX_BLOCK;
+  }
+}
+
+void handlePredictionResponse() {
+  int status = uplink.httpStatus();
+  uplinkResponses[status / 100 == 2 ? 0 : status / 100 == 4 ? 1 : status / 100 == 5 ? 2 : 3].add();
+  LOG_DEBUG("Uplink HTTP %d, %u samples: connect %u ms, send %u ms, await %u ms, receive %u ms",
+            uplink.httpStatus(), (unsigned)batchSamples, uplink.timings().connectMs, uplink.timings().sendMs,
+            uplink.timings().awaitMs, uplink.timings().receiveMs);
+
+  // Only an accepted batch leaves the buffer; anything else is retried
+  lastBatchAccepted = uplink.httpStatus() == 200;
+  unsigned long now = millis();
+  if (lastBatchAccepted && batchFromLog) {
+    for (size_t i = 0; i < batchSamples; i++) uplinkSampleAccepted(replayRecords[i].takenAt, now);
+    offlineLog.consume(batchSamples, replayRecords[batchSamples - 1].seq + 1);
+  } else if (lastBatchAccepted) {
+    for (size_t i = 0; i < batchSamples; i++) uplinkSampleAccepted(pendingSamples.peek(i).takenAt, now);
+    pendingSamples.pop(batchSamples);
+    batchSeq += batchSamples;
+  }
+  if (lastBatchAccepted) uplinkBatchAccepted(batchSamples);
+
+  // The body was parsed as it streamed in; only the extracted values remain
+  const PredictionResult &result = predictionParser.result();
+  if (predictionParser.complete()) {
+    Prediction predicted;
+    predicted.temperature = result.temperature;
+    predicted.humidity = result.humidity;
+    predicted.aqi = result.aqi;
+    predicted.available = true;
+    latestPrediction.store(predicted);
+
+    LOG_DEBUG("Prediction: %.2f °C, %.2f %%, AQI %.2f", predicted.temperature, predicted.humidity,
+              predicted.aqi);
+  } else if (result.error[0] != '\0') {
+    predictionParseFailures.add();
+    LOG_WARN("Prediction API error: %s", result.error);
+  } else if (predictionParser.failed()) {
+    predictionParseFailures.add();
+    LOG_WARN("Prediction response is not valid JSON");
+  } else {
+    predictionParseFailures.add();
+    LOG_WARN("Failed to find prediction fields in response");
+  }
+}
+
+// Runs the quantized next-day forest on the means of the three previous
+// days, most recent first, as the model was trained on. Those are the
+// calendar days from the daily aggregates once the clock is set and each
+// has DAY_MIN_SAMPLES; otherwise the last three 24 h windows of the history
+// stand in, if each has FORECAST_MIN_BUCKETS. Until either is available
+// the server's prediction is used instead.
+void updateLocalForecast(uint32_t now) {
+  float features[NEXT_DAY_FEATURES];
+  uint32_t today;
+  xSemaphoreTake(historyLock, portMAX_DELAY);
+  bool complete = localDay(today) && daily.lagVector(today, NEXT_DAY_LAGS, DAY_MIN_SAMPLES, features);
+  if (!complete && now >= NEXT_DAY_LAGS * FORECAST_DAY) {
+    complete = true;
+    for (uint8_t lag = 0; lag < NEXT_DAY_LAGS && complete; lag++) {
+      uint32_t to = now - lag * FORECAST_DAY;
+      float *day = &features[lag * 3];
+      complete = history.windowMean(to - FORECAST_DAY, to, FORECAST_MIN_BUCKETS, day[0], day[1], day[2]);
+    }
+  }
+  xSemaphoreGive(historyLock);
+  if (!complete) return;
+
+  int16_t quantized[NEXT_DAY_FEATURES];
+  float outputs[NEXT_DAY_OUTPUTS];
+  quantizeFeatures(NEXT_DAY_QUANTIZED, features, quantized);
+  quantizedPredict(NEXT_DAY_QUANTIZED, quantized, outputs);
+  Prediction predicted;
+  predicted.temperature = outputs[0];
+  predicted.humidity = outputs[1];
+  predicted.aqi = outputs[2];
+  predicted.available = true;
+  localPrediction.store(predicted);
+}
+
+// Refreshes the sensor snapshot when due and queues each valid reading for
+// upload; nothing else touches the sensors. The local forecast is refreshed
+// whenever a five-minute history bucket completes, and the daily aggregates
+// are saved when a day starts and every DAILY_SAVE_INTERVAL.
+void samplerTask(void *) {
+  uint32_t forecastBucket = UINT32_MAX;
+  uint32_t savedDay = 0;
+  uint32_t lastSave = 0;
+  for (;;) {
+    unsigned long iteration = micros();
+    if (sampler.poll()) {
+      sensorReadTime.record(micros() - iteration);
+      SensorReading reading = sampler.latest();
+      uint32_t seconds = reading.takenAt / 1000;
+      LOG_DEBUG("Sample %.1f °C, %.1f %%, MQ-135 %d", reading.temperature, reading.humidity, reading.mq135Raw);
+      if (reading.dhtValid) {
+        pendingSamples.push(reading);
+      } else {
+        sensorReadFailures.add();
+      }
+
+      uint32_t day;
+      bool dated = localDay(day);
+      xSemaphoreTake(historyLock, portMAX_DELAY);
+      history.add(seconds, reading.temperature, reading.humidity, reading.mq135Raw);
+      if (dated) daily.add(day, reading.temperature, reading.humidity, reading.mq135Raw);
+      xSemaphoreGive(historyLock);
+
+      if (dated && (day != savedDay || seconds - lastSave >= DAILY_SAVE_INTERVAL)) {
+        saveDaily();
+        savedDay = day;
+        lastSave = seconds;
+      }
+
+      if (seconds / 300 != forecastBucket) {
+        forecastBucket = seconds / 300;
+        updateLocalForecast(seconds);
+      }
+    }
+    samplerIteration.record(micros() - iteration);
+    vTaskDelay(pdMS_TO_TICKS(100));
+  }
+}
+
+// Services web clients without blocking on any single one
+void httpTask(void *) {
+  for (;;) {
+    unsigned long iteration = micros();
+    httpServer.poll();
+    httpIteration.record(micros() - iteration);
+    vTaskDelay(1);
+  }
+}
+
+// Flushes buffered samples once BATCH_MAX_SAMPLES are waiting or
+// API_INTERVAL has passed, starting with the first sample after boot. A
+// backlog in the flash log goes out in REPLAY_BATCH_SAMPLES batches every
+// REPLAY_INTERVAL while the server keeps accepting them. After a failure
+// only the interval applies, so an unreachable server is retried at that
+// pace. Each accepted batch also returns a fresh prediction. The exchange
+// itself is non-blocking, so one slow reply only delays the next batch.
+void uplinkTask(void *) {
+  unsigned long lastFlush = 0;
+  unsigned long lastWiFiAttempt = millis();
+  bool flushed = false;
+  bool wasConnected = WiFi.status() == WL_CONNECTED;
+
+  for (;;) {
+    unsigned long iteration = micros();
+    bool connected = WiFi.status() == WL_CONNECTED;
+    if (connected != wasConnected) TRACE_INSTANT(connected ? "wifi connected" : "wifi disconnected");
+    wasConnected = connected;
+
+    if (!connected && millis() - lastWiFiAttempt >= WIFI_RETRY_INTERVAL) {
+      LOG_INFO("Reconnecting to WiFi");
+      TRACE_INSTANT("wifi reconnect");
+      wifiReconnects.add();
+      WiFi.reconnect();
+      lastWiFiAttempt = millis();
+    }
+
+    // Lets later boots date this one's logged samples
+    if (offlineLogReady && !bootEpochLogged && wallClock() >= CLOCK_VALID) {
+      bootEpochLogged = offlineLog.setBootEpoch(wallClock() - millis() / 1000);
+      replayAwaitsClock = false;
+    }
+    if (offlineLogReady && !uplink.busy()) spillToFlash();
+
+    size_t waiting = pendingSamples.size();
+    bool backlog = offlineLog.size() > 0 && !replayAwaitsClock;
+    unsigned long sinceFlush = millis() - lastFlush;
+    bool keepingUp = lastBatchAccepted &&
+                     (waiting >= BATCH_MAX_SAMPLES || (backlog && sinceFlush >= REPLAY_INTERVAL));
+    bool due = (waiting > 0 || backlog) && (!flushed || sinceFlush >= API_INTERVAL || keepingUp);
+    if (!uplink.busy() && due) {
+      sendBatch();
+      lastFlush = millis();
+      flushed = true;
+    }
+
+    PredictionUplink::State state = uplink.poll();
+    if (state == PredictionUplink::DONE) {
+      uplinkRoundTrip.record(micros() - uplinkStartedAt);
+      handlePredictionResponse();
+    } else if (state == PredictionUplink::FAILED) {
+      uplinkFailures.add();
+      lastBatchAccepted = false;
+      LOG_WARN("Error on sending POST: %s", uplink.error());
+    }
+
+    uplinkIteration.record(micros() - iteration);
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+}
+
+void writeToSerial(void *, const char *data, size_t length) {
+  Serial.write((const uint8_t *)data, length);
+}
+
+// Writes queued log lines to the UART. Runs at the lowest priority, so a
+// full UART FIFO only ever stalls this task. Sending 't' over the serial
+// port dumps the trace ring there, as /trace would.
+void logTask(void *) {
+  static char traceBuffer[256];
+  for (;;) {
+    logDrain();
+    if (Serial.available() > 0 && Serial.read() == 't') {
+      traceDump(traceBuffer, sizeof(traceBuffer), writeToSerial, NULL);
+    }
+    vTaskDelay(pdMS_TO_TICKS(20));
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+  xTaskCreatePinnedToCore(logTask, "log", LOG_STACK, NULL, LOG_PRIORITY, NULL, 1);
+
+  LOG_INFO("Initializing sensors");
+  sampler.begin();
+  delay(2000); // Allow sensors to stabilize
+
+  sampler.poll(true);
+  SensorReading initial = sampler.latest();
+  if (initial.dhtValid) {
+    LOG_INFO("Initial temperature %.1f °C, humidity %.1f %%", initial.temperature, initial.humidity);
+  } else {
+    LOG_WARN("Initial sensor read failed");
+  }
+
+  offlineLogReady = logFlash.begin("samplelog") && offlineLog.begin();
+  if (offlineLogReady) {
+    batchSeq = offlineLog.nextSeq();
+    LOG_INFO("Offline log ready: %u KB, %u samples left from earlier boots",
+             (unsigned)(offlineLog.capacity() * SampleLog::SLOT_SIZE / 1024), (unsigned)offlineLog.size());
+  } else {
+    LOG_WARN("No samplelog partition; samples are buffered in RAM only");
+  }
+
+  connectToWiFi();
+  configTzTime(TIME_ZONE, NTP_SERVER);
+  if (!uplink.begin(API_ENDPOINT, UPLINK_CONFIG)) {
+    LOG_ERROR("Invalid API endpoint: %s", API_ENDPOINT);
+  }
+
+  historyLock = xSemaphoreCreateMutex();
+  loadDaily();
+  xTaskCreatePinnedToCore(samplerTask, "sampler", SAMPLER_STACK, NULL, SAMPLER_PRIORITY, NULL, 1);
+  xTaskCreatePinnedToCore(httpTask, "http", HTTP_STACK, NULL, HTTP_PRIORITY, NULL, 1);
+  xTaskCreatePinnedToCore(uplinkTask, "uplink", UPLINK_STACK, NULL, UPLINK_PRIORITY, NULL, 0);
+}
+
+// All work happens in the tasks started from setup()
+void loop() {
+  vTaskDelete(NULL);
+}
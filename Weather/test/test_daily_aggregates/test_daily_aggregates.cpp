@@ -0,0 +1,176 @@
+// DailyAggregates: statistics per calendar day, the roll-over to a new day
+// and out of the ring, the model's lag vector, and save()/restore().
+//   pio test -e native -f test_daily_aggregates
+
+#include <math.h>
+#include <string.h>
+#include <unity.h>
+
+#include "DailyAggregates.h"
+
+static uint32_t firstDay;
+
+void setUp() {
+  firstDay = DailyAggregates::dayNumber(2025, 3, 1);
+}
+
+void tearDown() {}
+
+void test_day_number() {
+  TEST_ASSERT_EQUAL_UINT32(0, DailyAggregates::dayNumber(1970, 1, 1));
+  TEST_ASSERT_EQUAL_UINT32(20089, DailyAggregates::dayNumber(2025, 1, 1));
+  // Across a leap day
+  TEST_ASSERT_EQUAL_UINT32(DailyAggregates::dayNumber(2024, 2, 28) + 2, DailyAggregates::dayNumber(2024, 3, 1));
+}
+
+void test_mean_min_max() {
+  DailyAggregates days;
+  days.add(firstDay, 20.0f, 60.0f, 100);
+  days.add(firstDay, 30.0f, 80.0f, 300);
+  days.add(firstDay, NAN, NAN, 200);
+
+  TEST_ASSERT_EQUAL(1, days.size());
+  const DayAggregate &day = days.at(0);
+  TEST_ASSERT_EQUAL_UINT32(firstDay, day.day);
+  TEST_ASSERT_EQUAL_UINT32(3, day.count);
+  TEST_ASSERT_EQUAL_UINT32(2, day.dhtCount);
+  TEST_ASSERT_EQUAL_INT16(2000, day.min.temperatureCenti);
+  TEST_ASSERT_EQUAL_INT16(3000, day.max.temperatureCenti);
+  TEST_ASSERT_EQUAL_UINT16(6000, day.min.humidityCenti);
+  TEST_ASSERT_EQUAL_UINT16(8000, day.max.humidityCenti);
+  TEST_ASSERT_EQUAL_UINT16(100, day.min.mq135Raw);
+  TEST_ASSERT_EQUAL_UINT16(300, day.max.mq135Raw);
+
+  float temperature, humidity, mq135;
+  TEST_ASSERT_TRUE(DailyAggregates::mean(day, temperature, humidity, mq135));
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 25.0f, temperature);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 70.0f, humidity);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 200.0f, mq135);
+
+  // A day with only failed DHT reads has no mean
+  days.add(firstDay + 1, NAN, 50.0f, 100);
+  TEST_ASSERT_FALSE(DailyAggregates::mean(days.at(1), temperature, humidity, mq135));
+}
+
+// A reading for a later day starts it; once DAYS are stored the oldest
+// drops out. Readings for an earlier day, e.g. after the clock stepped
+// back, are ignored.
+void test_roll_over() {
+  DailyAggregates days;
+  for (uint32_t d = 0; d < DailyAggregates::DAYS + 3; d++) {
+    days.add(firstDay + d, 20.0f + d, 50.0f, 100);
+    days.add(firstDay + d, 22.0f + d, 50.0f, 100);
+  }
+  TEST_ASSERT_EQUAL(DailyAggregates::DAYS, days.size());
+  TEST_ASSERT_EQUAL_UINT32(firstDay + 3, days.at(0).day);
+  TEST_ASSERT_EQUAL_UINT32(firstDay + DailyAggregates::DAYS + 2, days.at(DailyAggregates::DAYS - 1).day);
+  TEST_ASSERT_NULL(days.find(firstDay + 2));
+  TEST_ASSERT_NOT_NULL(days.find(firstDay + 3));
+
+  const DayAggregate *newest = days.find(firstDay + DailyAggregates::DAYS + 2);
+  days.add(firstDay + 4, -40.0f, 0.0f, 0);
+  TEST_ASSERT_EQUAL_UINT32(2, newest->count);
+  TEST_ASSERT_EQUAL_UINT32(2, days.find(firstDay + 4)->count);
+
+  // Skipped days leave no entry
+  days.add(firstDay + DailyAggregates::DAYS + 10, 20.0f, 50.0f, 100);
+  TEST_ASSERT_NULL(days.find(firstDay + DailyAggregates::DAYS + 9));
+  TEST_ASSERT_EQUAL_UINT32(firstDay + 4, days.at(0).day);
+}
+
+void test_lag_vector() {
+  DailyAggregates days;
+  for (uint32_t d = 0; d < 4; d++) {
+    for (int i = 0; i < 10; i++) days.add(firstDay + d, 20.0f + d, 60.0f + d, 100 + d);
+  }
+
+  float features[9];
+  TEST_ASSERT_TRUE(days.lagVector(firstDay + 4, 3, 10, features));
+  // The day before first
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 23.0f, features[0]);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 63.0f, features[1]);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 103.0f, features[2]);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 21.0f, features[6]);
+
+  // Too few samples or a missing day leaves the features alone
+  features[0] = -1;
+  TEST_ASSERT_FALSE(days.lagVector(firstDay + 4, 3, 11, features));
+  TEST_ASSERT_FALSE(days.lagVector(firstDay + 6, 3, 1, features));
+  TEST_ASSERT_FALSE(days.lagVector(firstDay + 4, DailyAggregates::DAYS + 1, 1, features));
+  TEST_ASSERT_EQUAL_FLOAT(-1.0f, features[0]);
+}
+
+// The saved state brings back every day, and a restored ring keeps rolling
+void test_save_restore() {
+  DailyAggregates days;
+  for (uint32_t d = 0; d < DailyAggregates::DAYS + 2; d++) days.add(firstDay + d, 20.0f + d, 55.0f, 150 + d);
+
+  uint8_t state[DailyAggregates::STATE_SIZE];
+  size_t length = days.save(state);
+  TEST_ASSERT_EQUAL(DailyAggregates::STATE_SIZE, length);
+
+  DailyAggregates restored;
+  TEST_ASSERT_TRUE(restored.restore(state, length));
+  TEST_ASSERT_EQUAL(days.size(), restored.size());
+  for (size_t i = 0; i < days.size(); i++) {
+    TEST_ASSERT_EQUAL_MEMORY(&days.at(i), &restored.at(i), sizeof(DayAggregate));
+  }
+
+  days.add(firstDay + DailyAggregates::DAYS + 2, 30.0f, 55.0f, 150);
+  restored.add(firstDay + DailyAggregates::DAYS + 2, 30.0f, 55.0f, 150);
+  for (size_t i = 0; i < days.size(); i++) {
+    TEST_ASSERT_EQUAL_MEMORY(&days.at(i), &restored.at(i), sizeof(DayAggregate));
+  }
+
+  // An empty state round-trips too
+  DailyAggregates empty, fromEmpty;
+  length = empty.save(state);
+  TEST_ASSERT_TRUE(fromEmpty.restore(state, length));
+  TEST_ASSERT_EQUAL(0, fromEmpty.size());
+}
+
+// A state this version did not write is refused and changes nothing
+void test_restore_rejects_bad_state() {
+  DailyAggregates days;
+  for (uint32_t d = 0; d < 3; d++) days.add(firstDay + d, 20.0f, 55.0f, 150);
+  uint8_t state[DailyAggregates::STATE_SIZE];
+  size_t length = days.save(state);
+
+  DailyAggregates target;
+  target.add(firstDay - 10, 1.0f, 2.0f, 3);
+  uint8_t bad[DailyAggregates::STATE_SIZE];
+
+  TEST_ASSERT_FALSE(target.restore(state, length - 1));
+  TEST_ASSERT_FALSE(target.restore(state, 3));
+
+  memcpy(bad, state, length);
+  bad[0] = 'X';
+  TEST_ASSERT_FALSE(target.restore(bad, length));
+
+  memcpy(bad, state, length);
+  bad[2]++;
+  TEST_ASSERT_FALSE(target.restore(bad, length));
+
+  memcpy(bad, state, length);
+  bad[3] = DailyAggregates::DAYS + 1;
+  TEST_ASSERT_FALSE(target.restore(bad, length));
+
+  // Days out of order
+  memcpy(bad, state, length);
+  memcpy(bad + 4, state + 4 + sizeof(DayAggregate), sizeof(DayAggregate));
+  TEST_ASSERT_FALSE(target.restore(bad, length));
+
+  TEST_ASSERT_EQUAL(1, target.size());
+  TEST_ASSERT_EQUAL_UINT32(firstDay - 10, target.at(0).day);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_day_number);
+  RUN_TEST(test_mean_min_max);
+  RUN_TEST(test_roll_over);
+  RUN_TEST(test_lag_vector);
+  RUN_TEST(test_save_restore);
+  RUN_TEST(test_restore_rejects_bad_state);
+  return UNITY_END();
+}
@@ -0,0 +1,210 @@
+// HttpParser and the request-target helpers.
+//   pio test -e native -f test_http_parser
+
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+
+#include "HttpParser.h"
+
+static const char REQUEST[] =
+    "GET /api/now?tier=1 HTTP/1.1\r\n"
+    "Host: 192.168.1.42\r\n"
+    "Connection: keep-alive\r\n"
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) "
+    "Chrome/124.0.0.0 Safari/537.36\r\n"
+    "Accept: */*\r\n"
+    "Accept-Encoding: gzip, deflate\r\n"
+    "If-None-Match: \"33e1fff039c275eb\"\r\n"
+    "\r\n";
+
+// Feeds `text` in pieces of `chunk` bytes until the parser stops asking for more
+static HttpParser::Result feedInChunks(HttpParser &parser, const char *text, size_t length, size_t chunk) {
+  HttpParser::Result result = HttpParser::NEED_MORE;
+  for (size_t offset = 0; offset < length && result == HttpParser::NEED_MORE; offset += chunk) {
+    size_t piece = length - offset < chunk ? length - offset : chunk;
+    result = parser.feed(text + offset, piece);
+  }
+  return result;
+}
+
+static void checkRequest(const HttpRequest &request) {
+  TEST_ASSERT_EQUAL_STRING("GET", request.method);
+  TEST_ASSERT_EQUAL_STRING("/api/now?tier=1", request.path);
+  TEST_ASSERT_EQUAL_STRING("\"33e1fff039c275eb\"", request.ifNoneMatch);
+  TEST_ASSERT_TRUE(request.acceptsGzip);
+  TEST_ASSERT_TRUE(request.keepAlive);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_whole_request() {
+  HttpParser parser;
+  size_t consumed = 0;
+  TEST_ASSERT_EQUAL(HttpParser::DONE, parser.feed(REQUEST, sizeof(REQUEST) - 1, &consumed));
+  TEST_ASSERT_EQUAL(sizeof(REQUEST) - 1, consumed);
+  checkRequest(parser.request());
+}
+
+// Every way of splitting the head, down to a byte at a time, gives the same request
+void test_split_reads() {
+  HttpParser parser;
+  for (size_t chunk = 1; chunk < sizeof(REQUEST); chunk++) {
+    parser.reset();
+    TEST_ASSERT_EQUAL(HttpParser::DONE, feedInChunks(parser, REQUEST, sizeof(REQUEST) - 1, chunk));
+    checkRequest(parser.request());
+  }
+
+  // A split right inside "\r\n\r\n"
+  const size_t split = sizeof(REQUEST) - 3;
+  parser.reset();
+  TEST_ASSERT_EQUAL(HttpParser::NEED_MORE, parser.feed(REQUEST, split));
+  TEST_ASSERT_EQUAL(HttpParser::DONE, parser.feed(REQUEST + split, 2));
+}
+
+// Parsing stops after the blank line, leaving the next pipelined request
+void test_stops_at_end_of_head() {
+  static const char TWO[] = "GET /a HTTP/1.1\r\n\r\nGET /b HTTP/1.1\r\n\r\n";
+  HttpParser parser;
+  size_t consumed = 0;
+  TEST_ASSERT_EQUAL(HttpParser::DONE, parser.feed(TWO, sizeof(TWO) - 1, &consumed));
+  TEST_ASSERT_EQUAL(19, consumed);
+  TEST_ASSERT_EQUAL_STRING("/a", parser.request().path);
+
+  // Further bytes are not consumed until reset()
+  TEST_ASSERT_EQUAL(HttpParser::DONE, parser.feed(TWO + consumed, sizeof(TWO) - 1 - consumed, &consumed));
+  TEST_ASSERT_EQUAL(0, consumed);
+  parser.reset();
+  TEST_ASSERT_EQUAL(HttpParser::DONE, parser.feed(TWO + 19, sizeof(TWO) - 1 - 19));
+  TEST_ASSERT_EQUAL_STRING("/b", parser.request().path);
+}
+
+void test_connection_close_and_http10() {
+  HttpParser parser;
+  static const char CLOSE[] = "GET / HTTP/1.1\r\nConnection: Close\r\n\r\n";
+  TEST_ASSERT_EQUAL(HttpParser::DONE, parser.feed(CLOSE, sizeof(CLOSE) - 1));
+  TEST_ASSERT_FALSE(parser.request().keepAlive);
+
+  parser.reset();
+  static const char HTTP10[] = "GET / HTTP/1.0\n\n";
+  TEST_ASSERT_EQUAL(HttpParser::DONE, parser.feed(HTTP10, sizeof(HTTP10) - 1));
+  TEST_ASSERT_FALSE(parser.request().keepAlive);
+  TEST_ASSERT_FALSE(parser.request().acceptsGzip);
+  TEST_ASSERT_EQUAL_STRING("", parser.request().ifNoneMatch);
+
+  parser.reset();
+  static const char HTTP10_KEEP[] = "GET / HTTP/1.0\r\nconnection: keep-alive\r\n\r\n";
+  TEST_ASSERT_EQUAL(HttpParser::DONE, parser.feed(HTTP10_KEEP, sizeof(HTTP10_KEEP) - 1));
+  TEST_ASSERT_TRUE(parser.request().keepAlive);
+}
+
+// Accept-Encoding is a list with q-values, and q=0 refuses a coding
+void test_accept_encoding() {
+  struct {
+    const char *value;
+    bool gzip;
+  } cases[] = {
+      {"gzip", true},
+      {"deflate, GZIP", true},
+      {"br;q=1.0, gzip;q=0.8", true},
+      {"gzip;q=0.001", true},
+      {"gzip;q=0", false},
+      {"gzip; q=0.000, deflate", false},
+      {"deflate, x-gzip", false},
+      {"*", true},
+      {"*;q=0", false},
+      {"gzip;q=0, *", false},
+      {"identity", false},
+  };
+  for (const auto &c : cases) {
+    char head[128];
+    int length = snprintf(head, sizeof(head), "GET / HTTP/1.1\r\nAccept-Encoding: %s\r\n\r\n", c.value);
+    HttpParser parser;
+    TEST_ASSERT_EQUAL(HttpParser::DONE, parser.feed(head, length));
+    TEST_ASSERT_EQUAL_MESSAGE(c.gzip, parser.request().acceptsGzip, c.value);
+  }
+}
+
+// A head past MAX_HEAD_SIZE fails with 431 however it arrives, and stays failed
+void test_oversized_headers() {
+  static char head[HttpParser::MAX_HEAD_SIZE + 64];
+  size_t length = 0;
+  length += sprintf(head, "GET / HTTP/1.1\r\n");
+  while (length < HttpParser::MAX_HEAD_SIZE) {
+    length += sprintf(head + length, "X-Filler: %040d\r\n", 0);
+  }
+  length += sprintf(head + length, "\r\n");
+
+  const size_t chunks[] = {1, 536, sizeof(head)};
+  for (size_t chunk : chunks) {
+    HttpParser parser;
+    TEST_ASSERT_EQUAL(HttpParser::ERROR, feedInChunks(parser, head, length, chunk));
+    TEST_ASSERT_EQUAL_STRING("431 Request Header Fields Too Large", parser.errorStatus());
+    TEST_ASSERT_EQUAL(HttpParser::ERROR, parser.feed("\r\n", 2));
+  }
+
+  // One long header value is skipped, not stored, as long as the head fits
+  HttpParser parser;
+  length = sprintf(head, "GET / HTTP/1.1\r\nCookie: ");
+  memset(head + length, 'x', 1500);
+  length += 1500;
+  length += sprintf(head + length, "\r\nAccept-Encoding: gzip\r\n\r\n");
+  TEST_ASSERT_EQUAL(HttpParser::DONE, feedInChunks(parser, head, length, 64));
+  TEST_ASSERT_TRUE(parser.request().acceptsGzip);
+}
+
+void test_malformed_requests() {
+  struct {
+    const char *text;
+    const char *status;
+  } cases[] = {
+      {"get / HTTP/1.1\r\n\r\n", "400 Bad Request"},
+      {" / HTTP/1.1\r\n\r\n", "400 Bad Request"},
+      {"GET / HTTP/2.0\r\n\r\n", "400 Bad Request"},
+      {"GET / HTTP/1.2\r\n\r\n", "505 HTTP Version Not Supported"},
+      {"GET / HTTP/1.1\rX\n\r\n", "400 Bad Request"},
+      {"GET / HTTP/1.1\r\nBad Header: x\r\n\r\n", "400 Bad Request"},
+  };
+  for (const auto &c : cases) {
+    HttpParser parser;
+    TEST_ASSERT_EQUAL(HttpParser::ERROR, parser.feed(c.text, strlen(c.text)));
+    TEST_ASSERT_EQUAL_STRING(c.status, parser.errorStatus());
+  }
+
+  char longPath[HttpRequest::MAX_PATH + 32] = "GET /";
+  memset(longPath + 5, 'a', HttpRequest::MAX_PATH);
+  strcpy(longPath + 5 + HttpRequest::MAX_PATH, " HTTP/1.1\r\n\r\n");
+  HttpParser parser;
+  TEST_ASSERT_EQUAL(HttpParser::ERROR, parser.feed(longPath, strlen(longPath)));
+  TEST_ASSERT_EQUAL_STRING("414 URI Too Long", parser.errorStatus());
+}
+
+void test_path_and_query_helpers() {
+  TEST_ASSERT_TRUE(httpPathIs("/api/now", "/api/now"));
+  TEST_ASSERT_TRUE(httpPathIs("/api/now?tier=1", "/api/now"));
+  TEST_ASSERT_FALSE(httpPathIs("/api/nowx", "/api/now"));
+  TEST_ASSERT_FALSE(httpPathIs("/api", "/api/now"));
+
+  char value[8];
+  TEST_ASSERT_TRUE(httpQueryParam("/h?from=10&tier=2", "tier", value, sizeof(value)));
+  TEST_ASSERT_EQUAL_STRING("2", value);
+  TEST_ASSERT_TRUE(httpQueryParam("/h?from=10&tier=2", "from", value, sizeof(value)));
+  TEST_ASSERT_EQUAL_STRING("10", value);
+  TEST_ASSERT_FALSE(httpQueryParam("/h?atier=2", "tier", value, sizeof(value)));
+  TEST_ASSERT_FALSE(httpQueryParam("/h", "tier", value, sizeof(value)));
+  TEST_ASSERT_FALSE(httpQueryParam("/h?tier=123456789", "tier", value, sizeof(value)));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_whole_request);
+  RUN_TEST(test_split_reads);
+  RUN_TEST(test_stops_at_end_of_head);
+  RUN_TEST(test_connection_close_and_http10);
+  RUN_TEST(test_accept_encoding);
+  RUN_TEST(test_oversized_headers);
+  RUN_TEST(test_malformed_requests);
+  RUN_TEST(test_path_and_query_helpers);
+  return UNITY_END();
+}
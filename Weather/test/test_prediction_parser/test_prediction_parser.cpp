@@ -0,0 +1,135 @@
+// PredictionParser fed the /predict reply one byte at a time, as it can
+// arrive off the socket, in the layouts the server may send.
+//   pio test -e native -f test_prediction_parser
+
+#include <string.h>
+#include <unity.h>
+
+#include "PredictionParser.h"
+
+static PredictionParser parser;
+
+// Feeds `body` one byte at a time; false once the parser rejects it
+static bool feedBytes(const char *body) {
+  parser.reset();
+  for (size_t i = 0; body[i] != '\0'; i++) {
+    if (!parser.feed(body + i, 1)) return false;
+  }
+  return true;
+}
+
+static void assertPrediction(float temperature, float humidity, float aqi) {
+  TEST_ASSERT_TRUE(parser.complete());
+  TEST_ASSERT_FLOAT_WITHIN(0.0001f, temperature, parser.result().temperature);
+  TEST_ASSERT_FLOAT_WITHIN(0.0001f, humidity, parser.result().humidity);
+  TEST_ASSERT_FLOAT_WITHIN(0.0001f, aqi, parser.result().aqi);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_flask_jsonify() {
+  TEST_ASSERT_TRUE(
+      feedBytes("{\"next_day_predictions\":{\"aqi\":104.18,\"humidity\":73.21,\"temperature\":31.71}}\n"));
+  assertPrediction(31.71f, 73.21f, 104.18f);
+  TEST_ASSERT_EQUAL_STRING("", parser.result().error);
+}
+
+void test_pretty_printed() {
+  TEST_ASSERT_TRUE(feedBytes(
+      "{\n  \"next_day_predictions\" : {\n    \"aqi\" : 104.18,\n    \"humidity\" : 73.21,\n"
+      "    \"temperature\" : 31.71\n  }\n}\n"));
+  assertPrediction(31.71f, 73.21f, 104.18f);
+}
+
+// Keys in another order, fields the parser does not know, and the same key
+// names outside "next_day_predictions", which must not count
+void test_reordered_with_extra_fields() {
+  TEST_ASSERT_TRUE(feedBytes(
+      "{\"model\":{\"temperature\":1,\"trees\":200},\"next_day_predictions\":"
+      "{\"temperature\":31.71,\"humidity\":73.21,\"aqi\":104.18,\"label\":\"Clear\","
+      "\"nested\":{\"aqi\":1},\"history\":[1,2.5,{\"humidity\":0}],\"ok\":true,\"none\":null}}"));
+  assertPrediction(31.71f, 73.21f, 104.18f);
+}
+
+void test_number_forms() {
+  TEST_ASSERT_TRUE(feedBytes(
+      "{\"next_day_predictions\":{\"temperature\":-2.5e1,\"humidity\":7321E-2,\"aqi\":1.0418e+2}}"));
+  assertPrediction(-25.0f, 73.21f, 104.18f);
+
+  // More digits than fit in 32 bits only lose precision a float lacks anyway
+  TEST_ASSERT_TRUE(feedBytes(
+      "{\"next_day_predictions\":{\"temperature\":31.710000000000000001,\"humidity\":73212345678901e-12,"
+      "\"aqi\":104}}"));
+  assertPrediction(31.71f, 73.212345678901f, 104.0f);
+}
+
+void test_escaped_strings() {
+  TEST_ASSERT_TRUE(feedBytes(
+      "{\"note\":\"a \\\"quoted\\\" } brace\",\"next_day_predictions\":{\"label\":\"\\\\\",\"temperature\":1,"
+      "\"humidity\":2,\"aqi\":3}}"));
+  assertPrediction(1.0f, 2.0f, 3.0f);
+}
+
+void test_error_reply() {
+  TEST_ASSERT_TRUE(feedBytes("{\"error\":\"Not enough data for prediction\"}"));
+  TEST_ASSERT_FALSE(parser.complete());
+  TEST_ASSERT_EQUAL_STRING("Not enough data for prediction", parser.result().error);
+}
+
+// Cut off inside a key; a number only counts once the byte after it arrives
+void test_incomplete_reply() {
+  TEST_ASSERT_TRUE(feedBytes("{\"next_day_predictions\":{\"aqi\":104.18,\"humidity\":73.21,\"temper"));
+  TEST_ASSERT_FALSE(parser.complete());
+  TEST_ASSERT_EQUAL(PredictionResult::AQI | PredictionResult::HUMIDITY, parser.result().found);
+
+  TEST_ASSERT_TRUE(feedBytes("{\"next_day_predictions\":{\"aqi\":104.18,\"humidity\":73.21,\"temperature\":31"));
+  TEST_ASSERT_FALSE(parser.complete());
+  TEST_ASSERT_TRUE(parser.feed("}", 1));
+  assertPrediction(31.0f, 73.21f, 104.18f);
+}
+
+// Invalid JSON is rejected at the offending byte, and everything after it ignored
+void test_invalid_json() {
+  const char *bodies[] = {
+      "<html>502 Bad Gateway</html>",
+      "{\"next_day_predictions\":{\"aqi\" 104}}",
+      "{\"next_day_predictions\":{\"aqi\":104,}}",
+      "{\"next_day_predictions\":{\"aqi\":1.2.3}}",
+      "{\"a\":[1,2}",
+      "{\"a\":1}}",
+  };
+  for (const char *body : bodies) {
+    TEST_ASSERT_FALSE(feedBytes(body));
+    TEST_ASSERT_TRUE(parser.failed());
+    TEST_ASSERT_FALSE(parser.feed("{}", 2));
+  }
+}
+
+// Feeding through the ResponseSink interface in uneven pieces gives the same
+void test_response_sink_pieces() {
+  static const char BODY[] = "{\"next_day_predictions\":{\"aqi\":104.18,\"humidity\":73.21,\"temperature\":31.71}}";
+  for (size_t chunk = 1; chunk < sizeof(BODY); chunk++) {
+    parser.reset();
+    ResponseSink &sink = parser;
+    for (size_t offset = 0; offset < sizeof(BODY) - 1; offset += chunk) {
+      size_t piece = sizeof(BODY) - 1 - offset < chunk ? sizeof(BODY) - 1 - offset : chunk;
+      sink.onBody(BODY + offset, piece);
+    }
+    assertPrediction(31.71f, 73.21f, 104.18f);
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_flask_jsonify);
+  RUN_TEST(test_pretty_printed);
+  RUN_TEST(test_reordered_with_extra_fields);
+  RUN_TEST(test_number_forms);
+  RUN_TEST(test_escaped_strings);
+  RUN_TEST(test_error_reply);
+  RUN_TEST(test_incomplete_reply);
+  RUN_TEST(test_invalid_json);
+  RUN_TEST(test_response_sink_pieces);
+  return UNITY_END();
+}
@@ -0,0 +1,251 @@
+// SampleLog on simulated NOR flash: delivery, wrap-around, restarts and
+// CRC rejection of damaged blocks.
+//   pio test -e native -f test_sample_log
+
+#include <algorithm>
+#include <unity.h>
+
+#include "SampleLog.h"
+#include "SimulatedFlash.h"
+
+// Sixteen sectors, so the log wraps after a few thousand records
+static const size_t SMALL_PARTITION = 16 * 4096;
+static const size_t BATCH = 120;
+
+static LogRecord sample(uint32_t seq) {
+  LogRecord record = {seq, seq * 2000, (int16_t)(2500 + seq % 300), (uint16_t)(6000 + seq % 900),
+                      (uint16_t)(1200 + seq % 400), false, 0};
+  return record;
+}
+
+static void assertSample(uint32_t seq, const LogRecord &record) {
+  LogRecord expected = sample(seq);
+  TEST_ASSERT_EQUAL_UINT32(expected.seq, record.seq);
+  TEST_ASSERT_EQUAL_UINT32(expected.takenAt, record.takenAt);
+  TEST_ASSERT_EQUAL_INT16(expected.temperatureCenti, record.temperatureCenti);
+  TEST_ASSERT_EQUAL_UINT16(expected.humidityCenti, record.humidityCenti);
+  TEST_ASSERT_EQUAL_UINT16(expected.mq135Raw, record.mq135Raw);
+}
+
+// Appends records [from, to) in blocks, as spillToFlash() does
+static void appendRange(SampleLog &log, uint32_t from, uint32_t to) {
+  LogRecord block[SampleLog::MAX_BLOCK];
+  while (from < to) {
+    size_t count = to - from < SampleLog::MAX_BLOCK ? to - from : SampleLog::MAX_BLOCK;
+    for (size_t i = 0; i < count; i++) block[i] = sample(from + i);
+    TEST_ASSERT_TRUE(log.append(block, count));
+    from += count;
+  }
+}
+
+static uint32_t eraseSpread(const SimulatedFlash &flash) {
+  const std::vector<uint32_t> &erases = flash.erases();
+  return *std::max_element(erases.begin(), erases.end()) - *std::min_element(erases.begin(), erases.end());
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_rejects_tiny_region() {
+  SimulatedFlash flash(4096);
+  SampleLog log(flash);
+  TEST_ASSERT_FALSE(log.begin());
+}
+
+// Records come back in order, in batches that end part way into a block
+void test_append_peek_consume() {
+  SimulatedFlash flash(SMALL_PARTITION);
+  SampleLog log(flash);
+  TEST_ASSERT_TRUE(log.begin());
+  appendRange(log, 0, 1000);
+  TEST_ASSERT_EQUAL(1000, log.size());
+  TEST_ASSERT_EQUAL_UINT32(1000, log.nextSeq());
+
+  static LogRecord batch[BATCH];
+  uint32_t expected = 0;
+  while (log.size() > 0) {
+    size_t count = log.peek(batch, BATCH);
+    TEST_ASSERT_GREATER_THAN(0, count);
+    for (size_t i = 0; i < count; i++) assertSample(expected++, batch[i]);
+    log.consume(count, batch[count - 1].seq + 1);
+  }
+  TEST_ASSERT_EQUAL_UINT32(1000, expected);
+  TEST_ASSERT_EQUAL_UINT32(1000, log.acked());
+  TEST_ASSERT_EQUAL(0, log.peek(batch, BATCH));
+  TEST_ASSERT_EQUAL(0, flash.badWrites());
+}
+
+// A full log drops its oldest sector's records and keeps the newest, in order
+void test_wrap_drops_oldest() {
+  SimulatedFlash flash(SMALL_PARTITION);
+  SampleLog log(flash);
+  log.begin();
+  const uint32_t total = 20000;
+  appendRange(log, 0, total);
+
+  TEST_ASSERT_GREATER_THAN(0, log.dropped());
+  TEST_ASSERT_EQUAL(total, log.size() + log.dropped());
+  static LogRecord batch[BATCH];
+  uint32_t expected = log.dropped();
+  while (log.size() > 0) {
+    size_t count = log.peek(batch, BATCH);
+    TEST_ASSERT_GREATER_THAN(0, count);
+    for (size_t i = 0; i < count; i++) assertSample(expected++, batch[i]);
+    log.consume(count, batch[count - 1].seq + 1);
+  }
+  TEST_ASSERT_EQUAL_UINT32(total, expected);
+  TEST_ASSERT_EQUAL(0, flash.badWrites());
+  TEST_ASSERT_LESS_OR_EQUAL(1, eraseSpread(flash));
+}
+
+// Repeated outages, each drained afterwards, deliver every record exactly
+// once, through many wraps, without a 0 -> 1 write and with even wear
+void test_outage_replay_cycles() {
+  SimulatedFlash flash(SMALL_PARTITION);
+  SampleLog log(flash);
+  log.begin();
+  static LogRecord batch[BATCH];
+  uint32_t seq = 0, expected = 0, replayed = 0;
+  for (int outage = 0; outage < 100; outage++) {
+    uint32_t length = 50 + (outage * 7919) % 3000;
+    appendRange(log, seq, seq + length);
+    seq += length;
+    while (log.size() > 0) {
+      size_t count = log.peek(batch, BATCH);
+      for (size_t i = 0; i < count; i++) {
+        TEST_ASSERT_TRUE(batch[i].seq >= expected);
+        assertSample(batch[i].seq, batch[i]);
+        expected = batch[i].seq + 1;
+      }
+      replayed += count;
+      log.consume(count, count > 0 ? batch[count - 1].seq + 1 : log.acked());
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(seq, replayed + log.dropped());
+  TEST_ASSERT_EQUAL(0, flash.badWrites());
+  TEST_ASSERT_LESS_OR_EQUAL(1, eraseSpread(flash));
+}
+
+// Restarting every few hundred samples keeps the unsent backlog, the
+// sequence numbers and even wear. Each boot delivers one batch, which ends
+// part way into a block.
+void test_restarts_keep_backlog() {
+  SimulatedFlash flash(4 * SMALL_PARTITION);
+  static LogRecord batch[BATCH];
+  uint32_t seq = 0, oldest = 0;
+  for (int boot = 0; boot < 100; boot++) {
+    SampleLog log(flash);
+    log.begin();
+    TEST_ASSERT_EQUAL_UINT32(seq, log.nextSeq());
+    if (boot > 0) {
+      TEST_ASSERT_EQUAL(1, log.peek(batch, 1));
+      TEST_ASSERT_EQUAL_UINT32(oldest, batch[0].seq);
+    }
+
+    appendRange(log, seq, seq + 300);
+    seq += 300;
+    size_t count = log.peek(batch, BATCH);
+    log.consume(count, batch[count - 1].seq + 1);
+    log.peek(batch, 1);
+    oldest = batch[0].seq;
+  }
+  TEST_ASSERT_LESS_OR_EQUAL(1, eraseSpread(flash));
+}
+
+// Records left by earlier boots come back after a restart, from the first
+// one not acknowledged, dated by their own boot's clock when it had one
+void test_reboots_resume_at_ack() {
+  SimulatedFlash flash(SMALL_PARTITION);
+  static LogRecord batch[BATCH];
+  {
+    SampleLog log(flash);
+    log.begin();
+    appendRange(log, 0, 10);
+    log.setBootEpoch(1700000000);
+    appendRange(log, 10, 100);
+    size_t count = log.peek(batch, 40);
+    log.consume(count, batch[count - 1].seq + 1);
+  }
+  {
+    SampleLog log(flash);
+    log.begin();
+    appendRange(log, log.nextSeq(), 150);
+  }
+
+  SampleLog log(flash);
+  log.begin();
+  TEST_ASSERT_EQUAL_UINT32(40, log.acked());
+  appendRange(log, log.nextSeq(), 151);
+  size_t count = log.peek(batch, BATCH);
+  TEST_ASSERT_EQUAL(111, count);
+  TEST_ASSERT_EQUAL(111, log.size());
+  TEST_ASSERT_EQUAL_UINT32(151, log.nextSeq());
+  for (size_t i = 0; i < count; i++) {
+    assertSample(40 + i, batch[i]);
+    TEST_ASSERT_EQUAL(i < 110, batch[i].earlierBoot);
+    if (i < 110) TEST_ASSERT_EQUAL_UINT32(i < 60 ? 1700000000 : 0, batch[i].bootEpoch);
+  }
+}
+
+// Power lost while programming a block's payload: only some of its bits
+// cleared. The block fails its CRC and is skipped, not replayed.
+void test_torn_block_rejected() {
+  SimulatedFlash flash(SMALL_PARTITION);
+  SampleLog log(flash);
+  log.begin();
+  appendRange(log, 0, 10);
+  appendRange(log, 10, 20);
+  appendRange(log, 20, 30);
+
+  uint8_t partial[8] = {0};
+  flash.tearWrite(SampleLog::HEADER_SIZE + SampleLog::SLOT_SIZE + 4, partial, sizeof(partial));
+
+  LogRecord records[30];
+  size_t count = log.peek(records, 30);
+  TEST_ASSERT_EQUAL(20, count);
+  assertSample(10, records[0]);
+  assertSample(29, records[19]);
+  log.consume(count, records[count - 1].seq + 1);
+  TEST_ASSERT_EQUAL(0, log.size());
+}
+
+// A damaged block header is skipped as well, and so is the block after a
+// restart, which rebuilds the log from the same CRCs
+void test_damaged_header_rejected() {
+  SimulatedFlash flash(SMALL_PARTITION);
+  {
+    SampleLog log(flash);
+    log.begin();
+    appendRange(log, 0, 10);
+    appendRange(log, 10, 20);
+  }
+
+  // No clock was set, so the first slot is block 0's header; clear one
+  // bit of its record count
+  uint8_t header[SampleLog::SLOT_SIZE];
+  flash.read(SampleLog::HEADER_SIZE, header, sizeof(header));
+  TEST_ASSERT_EQUAL_UINT8(10, header[4]);
+  uint8_t damaged = header[4] & ~2;
+  flash.write(SampleLog::HEADER_SIZE + 4, &damaged, 1);
+
+  SampleLog log(flash);
+  log.begin();
+  LogRecord records[20];
+  size_t count = log.peek(records, 20);
+  TEST_ASSERT_EQUAL(10, count);
+  assertSample(10, records[0]);
+  TEST_ASSERT_EQUAL_UINT32(20, log.nextSeq());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_rejects_tiny_region);
+  RUN_TEST(test_append_peek_consume);
+  RUN_TEST(test_wrap_drops_oldest);
+  RUN_TEST(test_outage_replay_cycles);
+  RUN_TEST(test_restarts_keep_backlog);
+  RUN_TEST(test_reboots_resume_at_ack);
+  RUN_TEST(test_torn_block_rejected);
+  RUN_TEST(test_damaged_header_rejected);
+  return UNITY_END();
+}
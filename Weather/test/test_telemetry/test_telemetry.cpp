@@ -0,0 +1,187 @@
+// SeriesCodec and the telemetry message format, with plain records and
+// compressed (TELEMETRY_COMPRESSED).
+//   pio test -e native -f test_telemetry
+
+#include <math.h>
+#include <string.h>
+#include <unity.h>
+
+#include "SeriesCodec.h"
+#include "Telemetry.h"
+
+static const size_t COUNT = 300;
+static TelemetryRecord records[COUNT];
+
+static void assertSame(const TelemetryRecord &expected, const TelemetryRecord &actual) {
+  TEST_ASSERT_EQUAL_UINT32(expected.time, actual.time);
+  TEST_ASSERT_EQUAL_INT16(expected.temperatureCenti, actual.temperatureCenti);
+  TEST_ASSERT_EQUAL_UINT16(expected.humidityCenti, actual.humidityCenti);
+  TEST_ASSERT_EQUAL_UINT16(expected.mq135Raw, actual.mq135Raw);
+}
+
+// A 2 s series with jitter, a gap, a missing DHT reading and fields that
+// jump across the whole 16-bit range, so every prefix width is used
+void setUp() {
+  uint32_t time = 3600000;
+  for (size_t i = 0; i < COUNT; i++) {
+    time += 2000 + (i % 3);
+    if (i == 100) time += 600000;
+    if (i == 200) time += 0x12345678;
+    records[i] = telemetryRecord(time, 28.0f + 3.0f * sinf(i * 0.1f) + 0.01f * (i % 7),
+                                 70.0f + 5.0f * cosf(i * 0.1f), 1500 + (i * 37) % 200);
+    if (i == 150) records[i].temperatureCenti = TELEMETRY_MISSING;
+    if (i == 151) records[i].humidityCenti = 0xffff;
+    if (i == 250) records[i].mq135Raw = 0;
+    if (i == 251) records[i].mq135Raw = 0xffff;
+  }
+}
+
+void tearDown() {}
+
+void test_series_round_trip() {
+  uint8_t buffer[COUNT * TELEMETRY_MAX_RECORD_SIZE];
+  SeriesEncoder encoder(buffer, sizeof(buffer));
+  for (size_t i = 0; i < COUNT; i++) TEST_ASSERT_TRUE(encoder.add(records[i]));
+  TEST_ASSERT_EQUAL(COUNT, encoder.count());
+  TEST_ASSERT_LESS_OR_EQUAL(COUNT * 10, encoder.bytes());
+
+  SeriesDecoder decoder;
+  decoder.begin(buffer, encoder.bytes());
+  TelemetryRecord record;
+  for (size_t i = 0; i < COUNT; i++) {
+    TEST_ASSERT_TRUE(decoder.next(record));
+    assertSame(records[i], record);
+  }
+}
+
+// A steady, unchanged series costs 4 bits a sample after the first two
+void test_series_steady_samples() {
+  uint8_t buffer[64];
+  SeriesEncoder encoder(buffer, sizeof(buffer));
+  for (uint32_t i = 0; i < 66; i++) {
+    TEST_ASSERT_TRUE(encoder.add(telemetryRecord(i * 2000, 30.0f, 70.0f, 1500)));
+  }
+  TEST_ASSERT_LESS_OR_EQUAL(10 + 7 + 32, encoder.bytes());
+}
+
+// A record that does not fit is refused and the output stays decodable
+void test_series_full_buffer() {
+  uint8_t buffer[40];
+  SeriesEncoder encoder(buffer, sizeof(buffer));
+  size_t added = 0;
+  while (added < COUNT && encoder.add(records[added])) added++;
+  TEST_ASSERT_GREATER_THAN(1, added);
+  TEST_ASSERT_TRUE(added < COUNT);
+  TEST_ASSERT_LESS_OR_EQUAL(sizeof(buffer), encoder.bytes());
+  TEST_ASSERT_FALSE(encoder.add(records[added]));
+
+  SeriesDecoder decoder;
+  decoder.begin(buffer, encoder.bytes());
+  TelemetryRecord record;
+  for (size_t i = 0; i < added; i++) {
+    TEST_ASSERT_TRUE(decoder.next(record));
+    assertSame(records[i], record);
+  }
+}
+
+void test_series_truncated_input() {
+  uint8_t buffer[COUNT * TELEMETRY_MAX_RECORD_SIZE];
+  SeriesEncoder encoder(buffer, sizeof(buffer));
+  for (size_t i = 0; i < COUNT; i++) encoder.add(records[i]);
+
+  SeriesDecoder decoder;
+  decoder.begin(buffer, encoder.bytes() / 2);
+  TelemetryRecord record;
+  size_t decoded = 0;
+  while (decoded < COUNT && decoder.next(record)) decoded++;
+  TEST_ASSERT_TRUE(decoded < COUNT);
+}
+
+// Both message versions give back the records, numbered from the header's seq
+static void roundTrip(bool compressed) {
+  uint8_t message[TELEMETRY_HEADER_SIZE + COUNT * TELEMETRY_MAX_RECORD_SIZE];
+  TelemetryEncoder encoder(message, sizeof(message), 1000, 7654321, compressed);
+  for (size_t i = 0; i < COUNT; i++) TEST_ASSERT_TRUE(encoder.add(records[i]));
+  size_t length = encoder.finish();
+  TEST_ASSERT_EQUAL(COUNT, encoder.count());
+
+  TelemetryDecoder decoder;
+  TEST_ASSERT_TRUE(decoder.begin(message, length));
+  TEST_ASSERT_EQUAL(TELEMETRY_VERSION, decoder.version());
+  TEST_ASSERT_EQUAL(compressed, decoder.compressed());
+  TEST_ASSERT_EQUAL(COUNT, decoder.count());
+  TEST_ASSERT_EQUAL_UINT32(1000, decoder.firstSeq());
+  TEST_ASSERT_EQUAL_UINT32(7654321, decoder.encodedAt());
+  TelemetryRecord record;
+  for (size_t i = 0; i < COUNT; i++) {
+    TEST_ASSERT_TRUE(decoder.next(record));
+    TEST_ASSERT_EQUAL_UINT32(1000 + i, record.seq);
+    assertSame(records[i], record);
+  }
+  TEST_ASSERT_FALSE(decoder.next(record));
+}
+
+void test_message_round_trip_plain() {
+  roundTrip(false);
+}
+
+// Version 1 messages, which only had plain records, still decode
+void test_message_version_1() {
+  uint8_t message[TELEMETRY_HEADER_SIZE + 2 * TELEMETRY_MAX_RECORD_SIZE];
+  TelemetryEncoder encoder(message, sizeof(message), 7, 0);
+  encoder.add(records[0]);
+  encoder.add(records[1]);
+  size_t length = encoder.finish();
+  message[2] = 1;
+
+  TelemetryDecoder decoder;
+  TEST_ASSERT_TRUE(decoder.begin(message, length));
+  TEST_ASSERT_EQUAL(1, decoder.version());
+  TelemetryRecord record;
+  TEST_ASSERT_TRUE(decoder.next(record));
+  TEST_ASSERT_TRUE(decoder.next(record));
+  TEST_ASSERT_EQUAL_UINT32(8, record.seq);
+  assertSame(records[1], record);
+}
+
+void test_message_round_trip_compressed() {
+  roundTrip(true);
+}
+
+void test_message_rejects_bad_headers() {
+  uint8_t message[TELEMETRY_HEADER_SIZE + 4 * TELEMETRY_MAX_RECORD_SIZE];
+  TelemetryEncoder encoder(message, sizeof(message), 1, 2, true);
+  for (size_t i = 0; i < 4; i++) encoder.add(records[i]);
+  size_t length = encoder.finish();
+
+  TelemetryDecoder decoder;
+  TEST_ASSERT_FALSE(decoder.begin(message, TELEMETRY_HEADER_SIZE - 1));
+  message[0] = 'X';
+  TEST_ASSERT_FALSE(decoder.begin(message, length));
+  message[0] = 'C';
+  message[2] = TELEMETRY_VERSION + 1;
+  TEST_ASSERT_FALSE(decoder.begin(message, length));
+}
+
+void test_record_conversion() {
+  TelemetryRecord record = telemetryRecord(5, 21.456f, 55.5f, 1234);
+  TEST_ASSERT_EQUAL_INT16(2146, record.temperatureCenti);
+  TEST_ASSERT_EQUAL_UINT16(5550, record.humidityCenti);
+  TEST_ASSERT_EQUAL_UINT16(1234, record.mq135Raw);
+  record = telemetryRecord(5, NAN, NAN, 0);
+  TEST_ASSERT_EQUAL_INT16(TELEMETRY_MISSING, record.temperatureCenti);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_series_round_trip);
+  RUN_TEST(test_series_steady_samples);
+  RUN_TEST(test_series_full_buffer);
+  RUN_TEST(test_series_truncated_input);
+  RUN_TEST(test_message_round_trip_plain);
+  RUN_TEST(test_message_version_1);
+  RUN_TEST(test_message_round_trip_compressed);
+  RUN_TEST(test_message_rejects_bad_headers);
+  RUN_TEST(test_record_conversion);
+  return UNITY_END();
+}
@@ -0,0 +1,363 @@
+// Load generator for the dashboard's HTTP server.
+//
+// Simulates N browsers viewing the dashboard, against the native build or a
+// board on the LAN. Each viewer loads "/" once, then fetches /api/now and
+// waits --refresh ms after each reply before the next, as the page's
+// refresh() does, reloading "/" with If-None-Match every --reload seconds if
+// asked. Viewers start spread over the first refresh period, like browsers
+// opened independently; --refresh 0 sends back to back instead, for peak
+// throughput.
+//
+// With --mode fresh (the default) every request opens a new connection.
+// --mode keepalive asks to keep the connection and reuses it whenever the
+// response allows, as browsers do; the firmware keeps it for every response
+// with a Content-Length. Like a browser, a viewer whose kept connection was
+// closed before any reply arrived (the server gave the idle slot to someone
+// else) retries once on a new one; those are counted as "stale".
+//
+// Reports requests, throughput, errors by kind and p50/p95/p99/max latency
+// per path, measured from connect (or send, on a reused connection) to the
+// last byte of the response.
+//
+// Build and run from Weather/:
+//   g++ -O2 -std=c++17 -pthread tools/dashboard_load.cpp -o dashboard_load
+//   ./dashboard_load --host 127.0.0.1 --port 8080 --clients 20 --duration 60
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+struct Options {
+  const char *host = "127.0.0.1";
+  const char *port = "8080";
+  int clients = 10;
+  double duration = 30;     // s
+  int refresh = 5000;       // ms between a reply and the next /api/now
+  double reload = 0;        // s between reloads of "/", 0 for never
+  int timeout = 5000;       // ms per request
+  bool keepAlive = false;
+};
+
+enum Error { CONNECT, SEND, TIMEOUT, CLOSED, BAD_RESPONSE, BAD_STATUS, ERROR_KINDS };
+static const char *ERROR_NAMES[ERROR_KINDS] = {"connect", "send", "timeout", "closed early", "malformed",
+                                               "non-2xx/304"};
+
+enum Path { DASHBOARD, CACHED_DASHBOARD, LIVE_DATA, PATHS };
+static const char *PATH_LABELS[PATHS] = {"/", "/ (If-None-Match)", "/api/now"};
+static const char *PATH_URLS[PATHS] = {"/", "/", "/api/now"};
+
+// Per-viewer results, merged at the end
+struct Tally {
+  std::vector<uint32_t> latencies[PATHS];  // us
+  uint64_t bytes = 0;
+  uint64_t connections = 0;
+  uint64_t reused = 0;
+  uint64_t stale = 0;
+  uint64_t errors[ERROR_KINDS] = {};
+};
+
+static const int ERROR_BACKOFF_MS = 10;
+
+static Options options;
+static struct addrinfo *server = NULL;
+static std::atomic<bool> stopping(false);
+
+static int connectToServer() {
+  int fd = socket(server->ai_family, SOCK_STREAM, 0);
+  if (fd < 0) return -1;
+  struct timeval limit = {options.timeout / 1000, (options.timeout % 1000) * 1000};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &limit, sizeof(limit));
+  setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &limit, sizeof(limit));
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  if (connect(fd, server->ai_addr, server->ai_addrlen) != 0) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+static bool sendAll(int fd, const char *data, size_t length) {
+  while (length > 0) {
+    ssize_t n = send(fd, data, length, MSG_NOSIGNAL);
+    if (n <= 0) return false;
+    data += n;
+    length -= n;
+  }
+  return true;
+}
+
+// Case-insensitive lookup of a header's value within `head`
+static bool header(const std::string &head, const char *name, std::string &value) {
+  size_t nameLength = strlen(name);
+  for (size_t line = head.find("\r\n"); line != std::string::npos; line = head.find("\r\n", line + 2)) {
+    size_t start = line + 2;
+    if (head.size() - start > nameLength && strncasecmp(head.c_str() + start, name, nameLength) == 0 &&
+        head[start + nameLength] == ':') {
+      size_t end = head.find("\r\n", start);
+      value = head.substr(start + nameLength + 1, end - start - nameLength - 1);
+      value.erase(0, value.find_first_not_of(' '));
+      return true;
+    }
+  }
+  return false;
+}
+
+// Reads one response. Returns false with `error` set on failure; `reusable`
+// tells whether the connection can carry another request.
+static bool readResponse(int fd, Tally &tally, std::string &etag, bool &reusable, Error &error) {
+  std::string data;
+  char buffer[4096];
+  size_t headEnd = std::string::npos;
+  while (headEnd == std::string::npos) {
+    ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+    if (n <= 0) {
+      error = (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) ? TIMEOUT : CLOSED;
+      return false;
+    }
+    data.append(buffer, n);
+    headEnd = data.find("\r\n\r\n");
+  }
+  std::string head = data.substr(0, headEnd + 2);
+  size_t received = data.size() - headEnd - 4;
+  tally.bytes += data.size();
+
+  int status = 0;
+  if (sscanf(head.c_str(), "HTTP/1.%*d %d", &status) != 1) {
+    error = BAD_RESPONSE;
+    return false;
+  }
+
+  // Persistent unless the server says otherwise, as HTTP/1.1 defaults to
+  std::string value;
+  bool close = header(head, "Connection", value) && strcasecmp(value.c_str(), "close") == 0;
+  bool sized = header(head, "Content-Length", value);
+  size_t length = sized ? strtoul(value.c_str(), NULL, 10) : 0;
+  if (status == 304) {
+    sized = true;
+    length = 0;
+  }
+  if (header(head, "ETag", value)) etag = value;
+
+  // Without a length the body ends when the server closes the connection
+  while (!sized || received < length) {
+    ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+    if (n < 0) {
+      error = (errno == EAGAIN || errno == EWOULDBLOCK) ? TIMEOUT : CLOSED;
+      return false;
+    }
+    if (n == 0) {
+      if (sized) {
+        error = CLOSED;
+        return false;
+      }
+      close = true;
+      break;
+    }
+    received += n;
+    tally.bytes += n;
+  }
+
+  reusable = !close && sized;
+  if ((status < 200 || status >= 300) && status != 304) {
+    error = BAD_STATUS;
+    return false;
+  }
+  return true;
+}
+
+// One request on `fd`, opening a connection first if it is -1
+static bool request(int &fd, Path path, Tally &tally, std::string &etag) {
+  Clock::time_point start = Clock::now();
+retry:
+  bool reused = fd >= 0;
+  uint64_t bytesBefore = tally.bytes;
+  if (fd < 0) {
+    fd = connectToServer();
+    if (fd < 0) {
+      tally.errors[CONNECT]++;
+      return false;
+    }
+    tally.connections++;
+  } else {
+    tally.reused++;
+  }
+
+  char head[512];
+  int length = snprintf(head, sizeof(head),
+                        "GET %s HTTP/1.1\r\nHost: %s\r\nConnection: %s\r\nAccept: */*\r\n"
+                        "Accept-Encoding: gzip, deflate\r\n%s%s%s\r\n",
+                        PATH_URLS[path], options.host, options.keepAlive ? "keep-alive" : "close",
+                        path == CACHED_DASHBOARD ? "If-None-Match: " : "",
+                        path == CACHED_DASHBOARD ? etag.c_str() : "", path == CACHED_DASHBOARD ? "\r\n" : "");
+
+  bool reusable = false;
+  Error error = CLOSED;
+  bool ok = sendAll(fd, head, length);
+  if (!ok) error = SEND;
+  if (ok) ok = readResponse(fd, tally, etag, reusable, error);
+  if (!ok && reused && (error == SEND || error == CLOSED) && tally.bytes == bytesBefore) {
+    tally.stale++;
+    close(fd);
+    fd = -1;
+    goto retry;
+  }
+  if (ok) {
+    tally.latencies[path].push_back(
+        (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count());
+  } else {
+    tally.errors[error]++;
+  }
+  if (!ok || !options.keepAlive || !reusable) {
+    close(fd);
+    fd = -1;
+  }
+  return ok;
+}
+
+// Sleeps until `until`, or less if the run ends first
+static void pause(Clock::time_point until) {
+  while (!stopping && Clock::now() < until) {
+    std::this_thread::sleep_for(std::min(until - Clock::now(), Clock::duration(std::chrono::milliseconds(50))));
+  }
+}
+
+static void viewer(int index, Tally *tally) {
+  Clock::duration refresh = std::chrono::milliseconds(options.refresh);
+  pause(Clock::now() + refresh * index / options.clients);
+
+  int fd = -1;
+  std::string etag;
+  Clock::time_point nextReload = Clock::now() + std::chrono::milliseconds((long)(options.reload * 1000));
+  if (!stopping) request(fd, DASHBOARD, *tally, etag);
+  while (!stopping) {
+    if (options.reload > 0 && Clock::now() >= nextReload && !etag.empty()) {
+      request(fd, CACHED_DASHBOARD, *tally, etag);
+      nextReload = Clock::now() + std::chrono::milliseconds((long)(options.reload * 1000));
+    }
+    bool ok = request(fd, LIVE_DATA, *tally, etag);
+    // Back to back, a server that is down would otherwise be hammered
+    pause(Clock::now() + (ok || options.refresh > 0 ? refresh : std::chrono::milliseconds(ERROR_BACKOFF_MS)));
+  }
+  if (fd >= 0) close(fd);
+}
+
+static double percentile(const std::vector<uint32_t> &sorted, double fraction) {
+  size_t index = (size_t)(fraction * (sorted.size() - 1) + 0.5);
+  return sorted[index] / 1000.0;
+}
+
+static void usage(const char *program) {
+  fprintf(stderr,
+          "usage: %s [--host H] [--port P] [--clients N] [--duration S] [--refresh MS] [--reload S]\n"
+          "          [--timeout MS] [--mode fresh|keepalive]\n"
+          "  --clients N     simultaneous viewers (default 10)\n"
+          "  --duration S    length of the run (default 30)\n"
+          "  --refresh MS    pause after each /api/now reply (default 5000; 0: back to back)\n"
+          "  --reload S      reload \"/\" with If-None-Match this often (default never)\n"
+          "  --timeout MS    per-request send/receive timeout (default 5000)\n"
+          "  --mode M        fresh connection per request, or keepalive (default fresh)\n",
+          program);
+  exit(2);
+}
+
+int main(int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    const char *value = i + 1 < argc ? argv[++i] : NULL;
+    if (!value) usage(argv[0]);
+    if (strcmp(arg, "--host") == 0) {
+      options.host = value;
+    } else if (strcmp(arg, "--port") == 0) {
+      options.port = value;
+    } else if (strcmp(arg, "--clients") == 0) {
+      options.clients = atoi(value);
+    } else if (strcmp(arg, "--duration") == 0) {
+      options.duration = atof(value);
+    } else if (strcmp(arg, "--refresh") == 0) {
+      options.refresh = atoi(value);
+    } else if (strcmp(arg, "--reload") == 0) {
+      options.reload = atof(value);
+    } else if (strcmp(arg, "--timeout") == 0) {
+      options.timeout = atoi(value);
+    } else if (strcmp(arg, "--mode") == 0 && strcmp(value, "fresh") == 0) {
+      options.keepAlive = false;
+    } else if (strcmp(arg, "--mode") == 0 && strcmp(value, "keepalive") == 0) {
+      options.keepAlive = true;
+    } else {
+      usage(argv[0]);
+    }
+  }
+  if (options.clients <= 0 || options.duration <= 0 || options.refresh < 0 || options.timeout <= 0) usage(argv[0]);
+
+  struct addrinfo hints = {};
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  int status = getaddrinfo(options.host, options.port, &hints, &server);
+  if (status != 0) {
+    fprintf(stderr, "%s: %s\n", options.host, gai_strerror(status));
+    return 2;
+  }
+
+  printf("%d viewers on http://%s:%s/ for %.0f s, %s connections, refresh %d ms\n", options.clients,
+         options.host, options.port, options.duration, options.keepAlive ? "keep-alive" : "fresh",
+         options.refresh);
+  std::vector<Tally> tallies(options.clients);
+  std::vector<std::thread> threads;
+  Clock::time_point start = Clock::now();
+  for (int i = 0; i < options.clients; i++) threads.emplace_back(viewer, i, &tallies[i]);
+  std::this_thread::sleep_for(std::chrono::milliseconds((long)(options.duration * 1000)));
+  stopping = true;
+  for (std::thread &thread : threads) thread.join();
+  double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+  Tally total;
+  for (const Tally &tally : tallies) {
+    for (int p = 0; p < PATHS; p++) {
+      total.latencies[p].insert(total.latencies[p].end(), tally.latencies[p].begin(), tally.latencies[p].end());
+    }
+    total.bytes += tally.bytes;
+    total.connections += tally.connections;
+    total.reused += tally.reused;
+    total.stale += tally.stale;
+    for (int e = 0; e < ERROR_KINDS; e++) total.errors[e] += tally.errors[e];
+  }
+
+  uint64_t succeeded = 0, failed = 0;
+  for (int p = 0; p < PATHS; p++) succeeded += total.latencies[p].size();
+  for (int e = 0; e < ERROR_KINDS; e++) failed += total.errors[e];
+  printf("%llu requests in %.1f s: %.1f req/s, %.1f KB/s; %llu connections opened, %llu reused, %llu stale\n",
+         (unsigned long long)(succeeded + failed), seconds, (succeeded + failed) / seconds,
+         total.bytes / seconds / 1024, (unsigned long long)total.connections, (unsigned long long)total.reused,
+         (unsigned long long)total.stale);
+  printf("errors: %llu", (unsigned long long)failed);
+  for (int e = 0; e < ERROR_KINDS; e++) {
+    if (total.errors[e]) printf(", %s %llu", ERROR_NAMES[e], (unsigned long long)total.errors[e]);
+  }
+  printf("\n\n%-20s %8s %9s %9s %9s %9s\n", "latency, ms", "ok", "p50", "p95", "p99", "max");
+  for (int p = 0; p < PATHS; p++) {
+    std::vector<uint32_t> &sorted = total.latencies[p];
+    if (sorted.empty()) continue;
+    std::sort(sorted.begin(), sorted.end());
+    printf("%-20s %8zu %9.2f %9.2f %9.2f %9.2f\n", PATH_LABELS[p], sorted.size(), percentile(sorted, 0.50),
+           percentile(sorted, 0.95), percentile(sorted, 0.99), sorted.back() / 1000.0);
+  }
+  freeaddrinfo(server);
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,224 @@
+// Host-side decoder for binary log frames (firmware built with -DLOG_BINARY,
+// see lib/Log/Log.h).
+//
+// Reads the raw serial stream from a capture file, or stdin when none is
+// given, and prints each frame as the text build would have logged it,
+// "<seconds since boot> <E|W|I|D> <text>". The format strings come from the
+// table scripts/log_formats.py writes at build time; it must be from the
+// same build as the firmware. Bytes outside frames, such as the ROM
+// bootloader's messages, are passed through unchanged.
+//
+// Build and run from Weather/:
+//   g++ -O2 -std=c++17 -Ilib/Log tools/log_decode.cpp -o log_decode
+//   pio device monitor --raw | ./log_decode .pio/build/esp32dev/log_formats.txt
+//   ./log_decode .pio/build/esp32dev/log_formats.txt capture.bin
+
+#include <unistd.h>
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Log.h"
+
+static bool loadTable(const char *path, std::map<uint32_t, std::string> &formats) {
+  FILE *file = fopen(path, "r");
+  if (!file) return false;
+
+  char line[1024];
+  while (fgets(line, sizeof(line), file)) {
+    if (line[0] == '#') continue;
+    char *tab = strchr(line, '\t');
+    if (!tab) continue;
+    uint32_t id = strtoul(line, NULL, 16);
+
+    std::string format;
+    for (const char *c = tab + 1; *c && *c != '\n'; c++) {
+      if (*c == '\\' && c[1]) {
+        c++;
+        format += *c == 'n' ? '\n' : *c == 't' ? '\t' : *c;
+      } else {
+        format += *c;
+      }
+    }
+    formats[id] = format;
+  }
+  fclose(file);
+  return true;
+}
+
+// Pulls one encoded argument off the front of `args`
+struct ArgumentReader {
+  const uint8_t *data;
+  size_t length;
+
+  bool take(void *out, size_t size) {
+    if (size > length) return false;
+    memcpy(out, data, size);
+    data += size;
+    length -= size;
+    return true;
+  }
+};
+
+// Expands `format` the way printf would have on the device
+static std::string render(const std::string &format, ArgumentReader args) {
+  std::string out;
+  char piece[512];
+
+  for (size_t i = 0; i < format.size(); i++) {
+    if (format[i] != '%') {
+      out += format[i];
+      continue;
+    }
+    if (i + 1 < format.size() && format[i + 1] == '%') {
+      out += '%';
+      i++;
+      continue;
+    }
+
+    // %[flags][width][.precision][length]conversion
+    size_t end = i + 1;
+    std::string spec = "%";
+    while (end < format.size() && strchr("-+ #0", format[end])) spec += format[end++];
+    while (end < format.size() && (isdigit((unsigned char)format[end]) || format[end] == '.')) spec += format[end++];
+    std::string length;
+    while (end < format.size() && strchr("hljztLq", format[end])) length += format[end++];
+    if (end >= format.size()) {
+      out += format.substr(i);
+      break;
+    }
+    char conversion = format[end];
+    i = end;
+
+    bool ok = true;
+    if (strchr("diuoxXc", conversion)) {
+      bool wide = length == "ll" || length == "j" || length == "q";
+      if (conversion == 'c') {
+        uint32_t value = 0;
+        ok = args.take(&value, 4);
+        snprintf(piece, sizeof(piece), (spec + "c").c_str(), (int)value);
+      } else if (wide) {
+        uint64_t value = 0;
+        ok = args.take(&value, 8);
+        snprintf(piece, sizeof(piece), (spec + "ll" + conversion).c_str(), value);
+      } else {
+        uint32_t value = 0;
+        ok = args.take(&value, 4);
+        long long extended = strchr("di", conversion) ? (long long)(int32_t)value : (long long)value;
+        snprintf(piece, sizeof(piece), (spec + "ll" + conversion).c_str(), extended);
+      }
+    } else if (strchr("fFeEgGaA", conversion)) {
+      float value = 0;
+      ok = args.take(&value, 4);
+      snprintf(piece, sizeof(piece), (spec + conversion).c_str(), (double)value);
+    } else if (conversion == 's') {
+      uint8_t size = 0;
+      char text[256];
+      ok = args.take(&size, 1) && args.take(text, size);
+      text[ok ? size : 0] = '\0';
+      snprintf(piece, sizeof(piece), (spec + "s").c_str(), text);
+    } else if (conversion == 'p') {
+      uint32_t value = 0;
+      ok = args.take(&value, 4);
+      snprintf(piece, sizeof(piece), "0x%08x", value);
+    } else {
+      snprintf(piece, sizeof(piece), "%s%s%c", spec.c_str(), length.c_str(), conversion);
+    }
+    out += ok ? piece : "<truncated>";
+    if (!ok) break;
+  }
+  return out;
+}
+
+// Decodes the frames at the front of `buffer` and returns how many bytes it
+// used; a frame cut off at the end is left for the next read
+static size_t decode(const std::map<uint32_t, std::string> &formats, const std::vector<uint8_t> &buffer, bool atEnd,
+                     size_t &frames, size_t &corrupt) {
+  static const char LEVELS[] = "?EWID";
+  size_t at = 0;
+
+  while (at < buffer.size()) {
+    if (buffer[at] != LOG_FRAME_START) {
+      size_t next = at;
+      while (next < buffer.size() && buffer[next] != LOG_FRAME_START) next++;
+      fwrite(buffer.data() + at, 1, next - at, stdout);
+      at = next;
+      continue;
+    }
+    if (buffer.size() - at < 2) break;
+    size_t length = buffer[at + 1];
+    if (buffer.size() - at < length + 3) {
+      if (atEnd) {
+        corrupt++;
+        at = buffer.size();
+      }
+      break;
+    }
+
+    const uint8_t *payload = buffer.data() + at + 2;
+    uint8_t check = 0;
+    for (size_t i = 0; i < length; i++) check ^= payload[i];
+    if (length < LOG_FRAME_HEADER || check != payload[length]) {
+      corrupt++;
+      at++;  // not a frame after all; resynchronise on the next start byte
+      continue;
+    }
+
+    uint32_t id, millis;
+    memcpy(&id, payload, 4);
+    memcpy(&millis, payload + 4, 4);
+    uint8_t level = payload[8];
+    ArgumentReader args = {payload + LOG_FRAME_HEADER, length - LOG_FRAME_HEADER};
+
+    printf("%u.%03u %c ", millis / 1000, millis % 1000, level < sizeof(LEVELS) - 1 ? LEVELS[level] : '?');
+    std::map<uint32_t, std::string>::const_iterator format = formats.find(id);
+    if (format == formats.end()) {
+      printf("<unknown format %08x, %zu argument bytes>\n", id, args.length);
+    } else {
+      printf("%s\n", render(format->second, args).c_str());
+    }
+    frames++;
+    at += length + 3;
+  }
+  return at;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2 || argc > 3) {
+    fprintf(stderr, "usage: %s log_formats.txt [capture]\n", argv[0]);
+    return 2;
+  }
+
+  std::map<uint32_t, std::string> formats;
+  if (!loadTable(argv[1], formats)) {
+    fprintf(stderr, "%s: cannot read format table\n", argv[1]);
+    return 1;
+  }
+  FILE *input = argc == 3 ? fopen(argv[2], "rb") : stdin;
+  if (!input) {
+    fprintf(stderr, "%s: cannot open\n", argv[2]);
+    return 1;
+  }
+
+  std::vector<uint8_t> buffer;
+  uint8_t chunk[4096];
+  size_t frames = 0, corrupt = 0;
+  // read() rather than fread(), so a live stream is decoded as it arrives
+  for (;;) {
+    ssize_t n = read(fileno(input), chunk, sizeof(chunk));
+    if (n < 0) n = 0;
+    buffer.insert(buffer.end(), chunk, chunk + n);
+    size_t used = decode(formats, buffer, n == 0, frames, corrupt);
+    buffer.erase(buffer.begin(), buffer.begin() + used);
+    fflush(stdout);
+    if (n == 0) break;
+  }
+
+  fprintf(stderr, "%zu frames decoded, %zu corrupt\n", frames, corrupt);
+  return corrupt ? 1 : 0;
+}
@@ -0,0 +1,78 @@
+// Host-side decoder for binary telemetry messages (see lib/Telemetry).
+//
+// Reads one message per file, or from stdin when no file is given, and
+// prints its records as CSV. Useful for inspecting captured uplink payloads,
+// e.g. a body saved with `tcpdump` or from the server's request log.
+//
+// Build and run from Weather/:
+//   g++ -O2 -std=c++17 -Ilib/Telemetry tools/telemetry_decode.cpp lib/Telemetry/Telemetry.cpp lib/Telemetry/SeriesCodec.cpp -o telemetry_decode
+//   ./telemetry_decode batch.bin
+
+#include <cstdio>
+#include <vector>
+
+#include "Telemetry.h"
+
+static bool readAll(FILE *file, std::vector<uint8_t> &data) {
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    data.insert(data.end(), chunk, chunk + n);
+  }
+  return !ferror(file);
+}
+
+static bool decode(const char *name, const std::vector<uint8_t> &data) {
+  TelemetryDecoder decoder;
+  if (!decoder.begin(data.data(), data.size())) {
+    fprintf(stderr, "%s: not a telemetry message of version 1..%u\n", name, TELEMETRY_VERSION);
+    return false;
+  }
+
+  printf("# %s: version %u%s, %u records, encoded at %u ms, %zu bytes\n", name, decoder.version(),
+         decoder.compressed() ? " compressed" : "", decoder.count(), decoder.encodedAt(), data.size());
+  printf("seq,device_ms,age_ms,temperature_c,humidity_pct,mq135_raw\n");
+  TelemetryRecord record;
+  uint16_t decoded = 0;
+  while (decoder.next(record)) {
+    printf("%u,%u,%u,", record.seq, record.time, decoder.encodedAt() - record.time);
+    if (record.temperatureCenti == TELEMETRY_MISSING) {
+      printf(",");
+    } else {
+      printf("%.2f,", record.temperatureCenti / 100.0);
+    }
+    if (record.humidityCenti == 0xffff) {
+      printf(",");
+    } else {
+      printf("%.2f,", record.humidityCenti / 100.0);
+    }
+    printf("%u\n", record.mq135Raw);
+    decoded++;
+  }
+
+  if (decoded != decoder.count()) {
+    fprintf(stderr, "%s: truncated after %u of %u records\n", name, decoded, decoder.count());
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char **argv) {
+  bool ok = true;
+  if (argc < 2) {
+    std::vector<uint8_t> data;
+    ok = readAll(stdin, data) && decode("stdin", data);
+  }
+  for (int i = 1; i < argc; i++) {
+    FILE *file = fopen(argv[i], "rb");
+    if (!file) {
+      perror(argv[i]);
+      ok = false;
+      continue;
+    }
+    std::vector<uint8_t> data;
+    ok = readAll(file, data) && decode(argv[i], data) && ok;
+    fclose(file);
+  }
+  return ok ? 0 : 1;
+}
@@ -1,73 +1,272 @@
-from flask import Flask, request, jsonify
-from flask_cors import CORS
-import joblib
-import os
-import numpy as np
-import pandas as pd
-
-
-app = Flask(__name__)
-CORS(app)  # Enable CORS for all routes
-
-# Absolute path to the model file (one level above src/)
-BASE_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
-MODEL_PATH = os.path.join(BASE_DIR, "forecast_model.pkl")
-CSV_PATH = os.path.join(BASE_DIR, "sensor_data.csv")
-
-# Try to load the trained RandomForest model
-try:
-    model = joblib.load(MODEL_PATH)
-    print(f"✅ Loaded model from {MODEL_PATH}")
-except FileNotFoundError:
-    print(f"❌ Error: forecast_model.pkl not found at {MODEL_PATH}")
-    model = None
-except Exception as e:
-    print(f"❌ Error loading model: {e}")
-    model = None
-
-
-@app.route('/predict', methods=['POST'])
-def predict():
-    if model is None:
-        return jsonify({'error': 'Model not loaded'}), 500
-    try:
-        data = request.get_json(force=True)
-        temperature = float(data.get('temperature'))
-        humidity = float(data.get('humidity'))
-        aqi = float(data.get('aqi'))
-
-        # load last 3 days of averages
-        df = pd.read_csv(CSV_PATH)
-        df["timestamp"] = pd.to_datetime(df["timestamp"])
-        daily = df.groupby(df["timestamp"].dt.date).agg(
-            temp_mean=("temperature_c", "mean"),
-            hum_mean=("humidity_pct", "mean"),
-            aqi_mean=("aqi", "mean")
-        ).tail(3)
-
-        # flatten to [t-1_temp, t-1_hum, t-1_aqi, ...]
-        features = []
-        for _, row in daily.iterrows():
-            features += [row["temp_mean"], row["hum_mean"], row["aqi_mean"]]
-
-        # append today's live reading as the most recent point
-        features += [temperature, humidity, aqi]
-
-        X_pred = np.array(features[-9:]).reshape(1, -1)
-        y_pred = model.predict(X_pred)[0]
-
-        return jsonify({
-            "next_day_predictions": {
-                "temperature": round(float(y_pred[0]), 2),
-                "humidity": round(float(y_pred[1]), 2),
-                "aqi": round(float(y_pred[2]), 2)
-            }
-        })
-
-    except Exception as e:
-        return jsonify({'error': f'Prediction error: {str(e)}'}), 500
-
-
-if __name__ == '__main__':
-    print("🚀 Flask Weather API running on http://localhost:5000")
-    app.run(host='0.0.0.0', port=5000)
+from flask import Flask, request, jsonify
+from flask_cors import CORS
+from datetime import datetime
+import csv
+import joblib
+import math
+import os
+import numpy as np
+import pandas as pd
+import struct
+import threading
+
+
+app = Flask(__name__)
+CORS(app)  # Enable CORS for all routes
+
+# Absolute path to the model file (one level above src/)
+BASE_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+MODEL_PATH = os.path.join(BASE_DIR, "forecast_model.pkl")
+# /ingest appends samples here, and predictions use its daily means. It is the model's training
+# data, so a native --replay of it should run against a server with its own copy:
+#   WEATHER_INGEST_CSV=/tmp/replay.csv python app.py
+CSV_PATH = os.environ.get("WEATHER_INGEST_CSV") or os.path.join(BASE_DIR, "sensor_data.csv")
+
+# Try to load the trained RandomForest model
+try:
+    model = joblib.load(MODEL_PATH)
+    print(f"✅ Loaded model from {MODEL_PATH}")
+except FileNotFoundError:
+    print(f"❌ Error: forecast_model.pkl not found at {MODEL_PATH}")
+    model = None
+except Exception as e:
+    print(f"❌ Error loading model: {e}")
+    model = None
+
+
+# Binary telemetry from the ESP32; layout documented in Weather/lib/Telemetry/Telemetry.h
+# and, for compressed messages, Weather/lib/Telemetry/SeriesCodec.h
+TELEMETRY_VERSION = 2
+TELEMETRY_COMPRESSED = 0x01
+TELEMETRY_HEADER = struct.Struct("<2sBBHIII")
+TELEMETRY_FIELDS = struct.Struct("<hHH")
+TELEMETRY_MISSING = -32768
+
+
+class _BitReader:
+    def __init__(self, data):
+        self.value = int.from_bytes(data, "big")
+        self.remaining = len(data) * 8
+
+    def read(self, count):
+        if count > self.remaining:
+            raise ValueError("compressed telemetry truncated")
+        self.remaining -= count
+        return (self.value >> self.remaining) & ((1 << count) - 1)
+
+    def read_delta(self, widths):
+        """Zigzag value behind a 0 / 10 / 110 / 1110 / 1111 width prefix."""
+        ones = 0
+        while ones < 4 and self.read(1):
+            ones += 1
+        z = self.read(widths[ones - 1]) if ones else 0
+        return (z >> 1) ^ -(z & 1)
+
+
+def _decode_series(data, count):
+    """Yield (device_ms, temp, hum, raw) as fixed-point ints from a SeriesCodec stream."""
+    bits = _BitReader(data)
+    time = bits.read(32)
+    fields = [bits.read(16) for _ in range(3)]
+    interval = 0
+    for i in range(count):
+        if i > 0:
+            interval = (interval + bits.read_delta((7, 9, 12, 32))) & 0xFFFFFFFF
+            time = (time + interval) & 0xFFFFFFFF
+            fields = [(f + bits.read_delta((5, 9, 12, 16))) & 0xFFFF for f in fields]
+        temp = fields[0] - 0x10000 if fields[0] >= 0x8000 else fields[0]
+        yield time, temp, fields[1], fields[2]
+
+
+def _decode_plain(data, time, count):
+    offset = 0
+    for i in range(count):
+        delta, shift = 0, 0
+        while True:
+            byte = data[offset]
+            offset += 1
+            delta |= (byte & 0x7F) << shift
+            shift += 7
+            if not byte & 0x80:
+                break
+        temp, hum, raw = TELEMETRY_FIELDS.unpack_from(data, offset)
+        offset += TELEMETRY_FIELDS.size
+        time = (time + delta) & 0xFFFFFFFF
+        yield time, temp, hum, raw
+
+
+def decode_telemetry(payload):
+    """Decode a telemetry message into (encoded_at_ms, [(seq, device_ms, temp, hum, raw), ...])."""
+    if len(payload) < TELEMETRY_HEADER.size:
+        raise ValueError("telemetry message truncated")
+    magic, version, flags, count, first_seq, time, encoded_at = TELEMETRY_HEADER.unpack_from(payload)
+    if magic != b"CS" or not 1 <= version <= TELEMETRY_VERSION:
+        raise ValueError(f"unsupported telemetry message (magic {magic!r}, version {version})")
+
+    body = payload[TELEMETRY_HEADER.size:]
+    if count == 0:
+        rows = []
+    elif version >= 2 and flags & TELEMETRY_COMPRESSED:
+        rows = _decode_series(body, count)
+    else:
+        rows = _decode_plain(body, time, count)
+
+    records = []
+    for i, (t, temp, hum, raw) in enumerate(rows):
+        records.append((first_seq + i, t,
+                        None if temp == TELEMETRY_MISSING else temp / 100.0,
+                        None if hum == 0xFFFF else hum / 100.0,
+                        raw))
+    return encoded_at, records
+
+
+# Ingest writes the CSV's day-first format, to the second so samples 2 s apart stay distinct.
+# Older rows are to the minute, or ISO-8601 with a 'T' from an earlier /ingest; the native
+# firmware's --replay and scripts/sensor_forecast.py read all three as well.
+CSV_TIME_FORMAT = "%d-%m-%Y %H:%M:%S"
+LEGACY_CSV_TIME_FORMATS = ("%d-%m-%Y %H:%M", "%Y-%m-%dT%H:%M:%S")
+
+
+def parse_csv_timestamp(text):
+    for time_format in (CSV_TIME_FORMAT,) + LEGACY_CSV_TIME_FORMATS:
+        try:
+            return datetime.strptime(text, time_format)
+        except ValueError:
+            pass
+    raise ValueError(f"unrecognised timestamp {text!r}")
+
+
+class DailyMeans:
+    """
+    Per-day sums of the CSV's temperature, humidity and AQI, read from the file once at startup
+    and updated with each ingested row, so a prediction never re-reads the whole file. Missing
+    values are skipped, as pandas' mean() does.
+    """
+
+    COLUMNS = ("temperature_c", "humidity_pct", "aqi")
+
+    def __init__(self):
+        self.days = {}  # date -> [sum, count] per column
+        self.lock = threading.Lock()
+
+    def load(self, path):
+        if not os.path.exists(path):
+            return
+        with open(path, newline="") as f:
+            for row in csv.DictReader(f):
+                try:
+                    day = parse_csv_timestamp(row["timestamp"].strip()).date()
+                except (ValueError, AttributeError):
+                    continue
+                self.add(day, [row.get(column) for column in self.COLUMNS])
+
+    def add(self, day, values):
+        with self.lock:
+            totals = self.days.setdefault(day, [[0.0, 0] for _ in self.COLUMNS])
+            for total, value in zip(totals, values):
+                try:
+                    value = float(value)
+                except (TypeError, ValueError):
+                    continue
+                if math.isnan(value):
+                    continue
+                total[0] += value
+                total[1] += 1
+
+    def latest(self, count):
+        """Means of the newest `count` days, oldest first; NaN for a column with no values."""
+        with self.lock:
+            days = sorted(self.days)[-count:]
+            return [[s / n if n else float("nan") for s, n in self.days[day]] for day in days]
+
+
+daily_means = DailyMeans()
+daily_means.load(CSV_PATH)
+# Appending to the CSV and to daily_means happens together, so both see batches in one order
+csv_lock = threading.Lock()
+
+
+def predict_next_day(temperature, humidity, aqi):
+    """Predict next-day averages from the last 3 daily means plus a live reading."""
+    # flatten the last 3 days of averages to [t-1_temp, t-1_hum, t-1_aqi, ...]
+    features = []
+    for means in daily_means.latest(3):
+        features += means
+
+    # append today's live reading as the most recent point
+    features += [temperature, humidity, aqi]
+
+    X_pred = np.array(features[-9:]).reshape(1, -1)
+    y_pred = model.predict(X_pred)[0]
+
+    return {
+        "temperature": round(float(y_pred[0]), 2),
+        "humidity": round(float(y_pred[1]), 2),
+        "aqi": round(float(y_pred[2]), 2)
+    }
+
+
+@app.route('/predict', methods=['POST'])
+def predict():
+    if model is None:
+        return jsonify({'error': 'Model not loaded'}), 500
+    try:
+        data = request.get_json(force=True)
+        temperature = float(data.get('temperature'))
+        humidity = float(data.get('humidity'))
+        aqi = float(data.get('aqi'))
+
+        return jsonify({"next_day_predictions": predict_next_day(temperature, humidity, aqi)})
+
+    except Exception as e:
+        return jsonify({'error': f'Prediction error: {str(e)}'}), 500
+
+
+@app.route('/ingest', methods=['POST'])
+def ingest():
+    """
+    Batch upload from the ESP32, either a binary telemetry message (application/octet-stream)
+    or JSON {"now": <device ms>, "samples": [[<device ms>, temp, hum, aqi], ...]}.
+    The device has no wall clock, so each sample is timestamped by its age relative to "now".
+    Samples are appended to the CSV, and a prediction for the newest one is returned.
+    """
+    if model is None:
+        return jsonify({'error': 'Model not loaded'}), 500
+    try:
+        if request.mimetype == 'application/octet-stream':
+            device_now, records = decode_telemetry(request.get_data())
+            samples = [(t, temp, hum, raw) for _seq, t, temp, hum, raw in records
+                       if temp is not None and hum is not None]
+        else:
+            data = request.get_json(force=True)
+            device_now = int(data.get('now'))
+            samples = data.get('samples') or []
+        if not samples:
+            return jsonify({'error': 'No samples in batch'}), 400
+
+        received_at = pd.Timestamp.now()
+        taken_at = [received_at - pd.Timedelta(milliseconds=(device_now - int(s[0])) & 0xFFFFFFFF)
+                    for s in samples]
+        rows = pd.DataFrame({
+            "timestamp": [t.strftime(CSV_TIME_FORMAT) for t in taken_at],
+            "temperature_c": [round(float(s[1]), 2) for s in samples],
+            "humidity_pct": [round(float(s[2]), 2) for s in samples],
+            "aqi": [int(s[3]) for s in samples],
+        })
+        with csv_lock:
+            rows.to_csv(CSV_PATH, mode="a", header=not os.path.exists(CSV_PATH), index=False)
+            for t, (_, row) in zip(taken_at, rows.iterrows()):
+                daily_means.add(t.date(), [row["temperature_c"], row["humidity_pct"], row["aqi"]])
+
+        latest = rows.iloc[-1]
+        prediction = predict_next_day(latest["temperature_c"], latest["humidity_pct"], latest["aqi"])
+        return jsonify({"ingested": len(rows), "next_day_predictions": prediction})
+
+    except Exception as e:
+        return jsonify({'error': f'Ingest error: {str(e)}'}), 500
+
+
+if __name__ == '__main__':
+    print("🚀 Flask Weather API running on http://localhost:5000")
+    print(f"📄 Ingesting into {CSV_PATH}")
+    app.run(host='0.0.0.0', port=5000)